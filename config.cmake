@@ -29,3 +29,27 @@ set(CMAKE_C_FLAGS "-O3 -DNDEBUG -march=native -fopenmp"
 set(CMAKE_Fortran_FLAGS "-O3 -ffree-line-length-none -march=native -fopenmp"
     CACHE STRING "Fortran compile flags")
 
+
+# Storage reserved for each VOFTools polyhedron. These must match NS and NV
+# in VOFTools/dim.h, so VOFTools has to be rebuilt after changing them.
+# The defaults are those distributed with VOFTools. Smaller values shrink the
+# cache footprint, but must still fit the largest clipped polyhedron.
+set(VOFTOOLS_NS "100" CACHE STRING "Maximum faces per VOFTools polyhedron")
+set(VOFTOOLS_NV "140" CACHE STRING "Maximum vertices per VOFTools polyhedron")
+
+# Count links visited, planes tested and truncations in the distribution
+# tests (case 2). Adds columns to distribution_timing.txt; leave OFF for
+# timings, so the counting code is compiled out.
+set(TRAVERSAL_STATS OFF CACHE BOOL "Collect graph traversal counters")
+
+# Count heap allocations per call in the Cartesian resolution sweep
+# (case 6). Adds columns to distribution_sweep_timing.txt; leave OFF for
+# timings, so the global operator new is not replaced.
+set(ALLOCATION_COUNTS OFF CACHE BOOL "Count heap allocations")
+
+# Also distribute each trial of the distribution tests (case 2) by
+# clipping against every cell and against the cells found by a box tree,
+# and by the in-repo traversal with and without its early exit. Each adds
+# columns to distribution_timing.txt and runs every trial again.
+set(DISTRIBUTION_BASELINES OFF CACHE BOOL "Run the distribution baselines")
+set(EARLY_EXIT OFF CACHE BOOL "Run the early exit distribution traversal")
@@ -11,7 +11,7 @@ cases = (["Prism",
          "Stellated Dodecahedron", 
          "Stellated Icosahedron"])
 
-tools = (["irl","r3d","voftools"])
+tools = (["irl","r3d","voftools","r3d_prototype","voftools_prototype"])
 
 def readFile(filename):
     read_file = open(filename,'r')
@@ -62,7 +62,9 @@ def getTimingHeader():
     return "NPlane".center(11) + \
         "IRL".center(csize) + "IRL/IRL".center(csize) +\
         "R3D".center(csize) + "R3D/IRL".center(csize) + \
-        "VOFTOOLS".center(csize) + "VOFTOOLS/IRL".center(csize)
+        "VOFTOOLS".center(csize) + "VOFTOOLS/IRL".center(csize) + \
+        "R3D-PROTO".center(csize) + "R3D-PROTO/IRL".center(csize) + \
+        "VOF-PROTO".center(csize) + "VOF-PROTO/IRL".center(csize)
 
 def getTimes(timing_dict, case, max_planes):
     s = ""
@@ -198,6 +200,8 @@ if __name__ == "__main__":
         "irl": readFile("irl_timing.txt"),
         "r3d": readFile("r3d_timing.txt"),
         "voftools": readFile("voftools_timing.txt"),        
+        "r3d_prototype": readFile("r3d_prototype_timing.txt"),
+        "voftools_prototype": readFile("voftools_prototype_timing.txt"),
         })
     max_planes, initialization_comp, intersection_comp, volume_comp, total_comp  = processFileOutput(file_dict)
 
@@ -0,0 +1,179 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/irl_gvm/cell_box_tree.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <numeric>
+
+// IRL source directory
+#include "src/geometry/general/plane.h"
+#include "src/parameters/defined_types.h"
+
+constexpr int CellBoxTree::kLeafSize;
+
+// Box around the vertices of a_localizer. Each vertex is where three
+// planes meet, found with Cramer's rule, and kept if it is on or below
+// every plane.
+static std::array<double, 6> getLocalizerBox(
+    const IRL::PlanarLocalizer& a_localizer) {
+  std::array<double, 6> box{
+      {DBL_MAX, DBL_MAX, DBL_MAX, -DBL_MAX, -DBL_MAX, -DBL_MAX}};
+  const IRL::UnsignedIndex_t number_of_planes = a_localizer.getNumberOfPlanes();
+  for (IRL::UnsignedIndex_t p0 = 0; p0 < number_of_planes; ++p0) {
+    const auto& n0 = a_localizer[p0].normal();
+    for (IRL::UnsignedIndex_t p1 = p0 + 1; p1 < number_of_planes; ++p1) {
+      const auto& n1 = a_localizer[p1].normal();
+      for (IRL::UnsignedIndex_t p2 = p1 + 1; p2 < number_of_planes; ++p2) {
+        const auto& n2 = a_localizer[p2].normal();
+        const double c12[3] = {n1[1] * n2[2] - n1[2] * n2[1],
+                               n1[2] * n2[0] - n1[0] * n2[2],
+                               n1[0] * n2[1] - n1[1] * n2[0]};
+        const double c20[3] = {n2[1] * n0[2] - n2[2] * n0[1],
+                               n2[2] * n0[0] - n2[0] * n0[2],
+                               n2[0] * n0[1] - n2[1] * n0[0]};
+        const double c01[3] = {n0[1] * n1[2] - n0[2] * n1[1],
+                               n0[2] * n1[0] - n0[0] * n1[2],
+                               n0[0] * n1[1] - n0[1] * n1[0]};
+        const double det = n0[0] * c12[0] + n0[1] * c12[1] + n0[2] * c12[2];
+        if (std::fabs(det) < 1.0e-12) {
+          continue;
+        }
+        const double d0 = a_localizer[p0].distance();
+        const double d1 = a_localizer[p1].distance();
+        const double d2 = a_localizer[p2].distance();
+        const IRL::Pt vertex((d0 * c12[0] + d1 * c20[0] + d2 * c01[0]) / det,
+                             (d0 * c12[1] + d1 * c20[1] + d2 * c01[1]) / det,
+                             (d0 * c12[2] + d1 * c20[2] + d2 * c01[2]) / det);
+        bool inside = true;
+        for (IRL::UnsignedIndex_t p = 0; p < number_of_planes; ++p) {
+          if (a_localizer[p].signedDistanceToPoint(vertex) > 1.0e-10) {
+            inside = false;
+            break;
+          }
+        }
+        if (inside) {
+          for (int d = 0; d < 3; ++d) {
+            box[d] = std::min(box[d], vertex[d]);
+            box[3 + d] = std::max(box[3 + d], vertex[d]);
+          }
+        }
+      }
+    }
+  }
+  return box;
+}
+
+CellBoxTree::CellBoxTree(void) : setup_time_m(0.0) {}
+
+CellBoxTree CellBoxTree::fromMesh(const LocalizerMesh& a_mesh) {
+  CellBoxTree tree;
+  double start = omp_get_wtime();
+  const int number_of_cells = a_mesh.getNumberOfCells();
+  tree.cell_boxes_m.resize(number_of_cells);
+#pragma omp parallel for schedule(static)
+  for (int c = 0; c < number_of_cells; ++c) {
+    tree.cell_boxes_m[c] = getLocalizerBox(a_mesh.getLocalizer(c));
+  }
+  tree.cells_m.resize(number_of_cells);
+  std::iota(tree.cells_m.begin(), tree.cells_m.end(), 0);
+  tree.nodes_m.reserve(2 * (number_of_cells / kLeafSize + 1));
+  tree.nodes_m.push_back(Node());
+  tree.buildNode(0, 0, number_of_cells);
+  double end = omp_get_wtime();
+  tree.setup_time_m = end - start;
+  return tree;
+}
+
+void CellBoxTree::buildNode(const int a_node, const int a_first,
+                            const int a_count) {
+  Box box{{DBL_MAX, DBL_MAX, DBL_MAX, -DBL_MAX, -DBL_MAX, -DBL_MAX}};
+  for (int n = a_first; n < a_first + a_count; ++n) {
+    const auto& cell_box = cell_boxes_m[cells_m[n]];
+    for (int d = 0; d < 3; ++d) {
+      box[d] = std::min(box[d], cell_box[d]);
+      box[3 + d] = std::max(box[3 + d], cell_box[3 + d]);
+    }
+  }
+  nodes_m[a_node].box_m = box;
+  if (a_count <= kLeafSize) {
+    nodes_m[a_node].first_m = a_first;
+    nodes_m[a_node].count_m = a_count;
+    nodes_m[a_node].left_m = -1;
+    return;
+  }
+
+  int axis = 0;
+  for (int d = 1; d < 3; ++d) {
+    if (box[3 + d] - box[d] > box[3 + axis] - box[axis]) {
+      axis = d;
+    }
+  }
+  const int half = a_count / 2;
+  std::nth_element(cells_m.begin() + a_first, cells_m.begin() + a_first + half,
+                   cells_m.begin() + a_first + a_count,
+                   [this, axis](const int a_lhs, const int a_rhs) {
+                     return cell_boxes_m[a_lhs][axis] +
+                                cell_boxes_m[a_lhs][3 + axis] <
+                            cell_boxes_m[a_rhs][axis] +
+                                cell_boxes_m[a_rhs][3 + axis];
+                   });
+  // Children are appended before recursing, so nodes_m may grow, and
+  // only indices into it are kept
+  const int left = static_cast<int>(nodes_m.size());
+  nodes_m.push_back(Node());
+  nodes_m.push_back(Node());
+  nodes_m[a_node].first_m = a_first;
+  nodes_m[a_node].count_m = 0;
+  nodes_m[a_node].left_m = left;
+  buildNode(left, a_first, half);
+  buildNode(left + 1, a_first + half, a_count - half);
+}
+
+void CellBoxTree::getOverlappingCells(const std::array<IRL::Pt, 2>& a_box,
+                                      std::vector<int>* a_cells) const {
+  if (nodes_m.empty() || cells_m.empty()) {
+    return;
+  }
+  auto overlaps = [&a_box](const Box& a_other) {
+    return a_other[0] <= a_box[1][0] && a_other[3] >= a_box[0][0] &&
+           a_other[1] <= a_box[1][1] && a_other[4] >= a_box[0][1] &&
+           a_other[2] <= a_box[1][2] && a_other[5] >= a_box[0][2];
+  };
+  // Tree depth is about log2(cells / kLeafSize), so the stack stays small
+  int stack[128];
+  int top = 0;
+  stack[top++] = 0;
+  while (top > 0) {
+    const Node& node = nodes_m[stack[--top]];
+    if (!overlaps(node.box_m)) {
+      continue;
+    }
+    if (node.count_m > 0) {
+      for (int n = node.first_m; n < node.first_m + node.count_m; ++n) {
+        if (overlaps(cell_boxes_m[cells_m[n]])) {
+          a_cells->push_back(cells_m[n]);
+        }
+      }
+    } else {
+      stack[top++] = node.left_m;
+      stack[top++] = node.left_m + 1;
+    }
+  }
+}
+
+std::size_t CellBoxTree::getMemoryFootprint(void) const {
+  return nodes_m.capacity() * sizeof(Node) +
+         cell_boxes_m.capacity() * sizeof(Box) +
+         cells_m.capacity() * sizeof(int);
+}
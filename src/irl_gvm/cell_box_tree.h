@@ -0,0 +1,75 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Axis-aligned bounding box tree over the cells of a LocalizerMesh, used
+// to find the cells a polyhedron may overlap without walking the mesh
+// graph. The box of each cell is found from the vertices of its
+// PlanarLocalizer (every point where three of its planes meet that lies
+// on or below all of the others), so any mesh type with bounded cells can
+// be used. The tree is built once, like the mesh, and only read
+// afterwards, so it can be shared between threads.
+
+#ifndef SRC_IRL_GVM_CELL_BOX_TREE_H_
+#define SRC_IRL_GVM_CELL_BOX_TREE_H_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "src/irl_gvm/localizer_mesh.h"
+
+// IRL source directory
+#include "src/geometry/general/pt.h"
+
+class CellBoxTree {
+ public:
+  // Tree over the cells of a_mesh. Cell boxes are found with all OpenMP
+  // threads, then the cells are split at the median box center along the
+  // widest axis until at most kLeafSize cells remain in each leaf.
+  static CellBoxTree fromMesh(const LocalizerMesh& a_mesh);
+
+  // Appends to a_cells every cell whose box overlaps the box between the
+  // two points of a_box
+  void getOverlappingCells(const std::array<IRL::Pt, 2>& a_box,
+                           std::vector<int>* a_cells) const;
+
+  // Wall time in seconds taken to find the cell boxes and build the tree
+  double getSetupTime(void) const { return setup_time_m; }
+
+  // Bytes held by the nodes, cell boxes and cell order of the tree
+  std::size_t getMemoryFootprint(void) const;
+
+ private:
+  static constexpr int kLeafSize = 4;
+
+  // Box stored as lower X/Y/Z then upper X/Y/Z
+  using Box = std::array<double, 6>;
+
+  // Leaves hold cells_m[first_m] to cells_m[first_m + count_m - 1], and
+  // inner nodes (count_m == 0) have children left_m and left_m + 1.
+  struct Node {
+    Box box_m;
+    int first_m;
+    int count_m;
+    int left_m;
+  };
+
+  CellBoxTree(void);
+
+  // Builds the subtree for cells_m[a_first:a_first + a_count] into node
+  // a_node, whose children are appended to nodes_m
+  void buildNode(const int a_node, const int a_first, const int a_count);
+
+  std::vector<Node> nodes_m;
+  std::vector<Box> cell_boxes_m;
+  std::vector<int> cells_m;
+  double setup_time_m;
+};
+
+#endif  // SRC_IRL_GVM_CELL_BOX_TREE_H_
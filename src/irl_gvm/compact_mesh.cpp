@@ -0,0 +1,239 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/irl_gvm/compact_mesh.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+CompactMesh::CompactMesh(void)
+    : is_cubic_m(false),
+      bounding_pts_m{{IRL::Pt(0.0, 0.0, 0.0), IRL::Pt(0.0, 0.0, 0.0)}},
+      ncells_m{{0, 0, 0}},
+      setup_time_m(0.0) {}
+
+CompactMesh CompactMesh::fromCubic(const std::array<IRL::Pt, 2>& a_bounding_pts,
+                                   const std::array<int, 3>& a_ncells) {
+  CompactMesh mesh;
+  mesh.is_cubic_m = true;
+  mesh.bounding_pts_m = a_bounding_pts;
+  mesh.ncells_m = a_ncells;
+
+  double start = omp_get_wtime();
+  const int nx = a_ncells[0];
+  const int ny = a_ncells[1];
+  const int nz = a_ncells[2];
+  const int number_of_cells = nx * ny * nz;
+  std::array<double, 3> dx;
+  for (int d = 0; d < 3; ++d) {
+    dx[d] = (a_bounding_pts[1][d] - a_bounding_pts[0][d]) /
+            static_cast<double>(a_ncells[d]);
+  }
+  mesh.face_offsets_m.resize(number_of_cells + 1);
+  for (auto& normal : mesh.normals_m) {
+    normal.resize(6 * number_of_cells);
+  }
+  mesh.distances_m.resize(6 * number_of_cells);
+  mesh.neighbors_m.resize(6 * number_of_cells);
+
+  // Faces are ordered +x, -x, +y, -y, +z, -z, as in setupCubicMesh
+#pragma omp parallel for collapse(2) schedule(static)
+  for (int k = 0; k < nz; ++k) {
+    for (int j = 0; j < ny; ++j) {
+      for (int i = 0; i < nx; ++i) {
+        const int index = i + j * nx + k * nx * ny;
+        const int f = 6 * index;
+        const std::array<int, 3> ijk{{i, j, k}};
+        const std::array<int, 3> stride{{1, nx, nx * ny}};
+        mesh.face_offsets_m[index] = f;
+        for (int d = 0; d < 3; ++d) {
+          const double lower =
+              a_bounding_pts[0][d] + static_cast<double>(ijk[d]) * dx[d];
+          for (int n = 0; n < 3; ++n) {
+            mesh.normals_m[n][f + 2 * d] = n == d ? 1.0 : 0.0;
+            mesh.normals_m[n][f + 2 * d + 1] = n == d ? -1.0 : 0.0;
+          }
+          mesh.distances_m[f + 2 * d] = lower + dx[d];
+          mesh.distances_m[f + 2 * d + 1] = -lower;
+          mesh.neighbors_m[f + 2 * d] =
+              ijk[d] != a_ncells[d] - 1 ? index + stride[d] : -1;
+          mesh.neighbors_m[f + 2 * d + 1] =
+              ijk[d] != 0 ? index - stride[d] : -1;
+        }
+      }
+    }
+  }
+  mesh.face_offsets_m[number_of_cells] = 6 * number_of_cells;
+  double end = omp_get_wtime();
+  mesh.setup_time_m = end - start;
+  return mesh;
+}
+
+// True if tet a_tet of a_tets uses the nodes a_node_1 and a_node_2
+static bool tetHasNodes(const std::vector<int>& a_tets, const int a_tet,
+                        const int a_node_1, const int a_node_2) {
+  const int* nodes = &a_tets[4 * a_tet];
+  const bool has_1 = nodes[0] == a_node_1 || nodes[1] == a_node_1 ||
+                     nodes[2] == a_node_1 || nodes[3] == a_node_1;
+  const bool has_2 = nodes[0] == a_node_2 || nodes[1] == a_node_2 ||
+                     nodes[2] == a_node_2 || nodes[3] == a_node_2;
+  return has_1 && has_2;
+}
+
+CompactMesh CompactMesh::fromTets(const std::vector<double>& a_nodes,
+                                  const std::vector<int>& a_tets) {
+  CompactMesh mesh;
+  double start = omp_get_wtime();
+  const int number_of_nodes = static_cast<int>(a_nodes.size() / 3);
+  const int number_of_cells = static_cast<int>(a_tets.size() / 4);
+  mesh.nodes_m = a_nodes;
+  mesh.cell_nodes_m = a_tets;
+
+  double x_min = DBL_MAX, y_min = DBL_MAX, z_min = DBL_MAX;
+  double x_max = -DBL_MAX, y_max = -DBL_MAX, z_max = -DBL_MAX;
+#pragma omp parallel for schedule(static) \
+    reduction(min : x_min, y_min, z_min) reduction(max : x_max, y_max, z_max)
+  for (int n = 0; n < number_of_nodes; ++n) {
+    x_min = std::min(x_min, a_nodes[3 * n]);
+    y_min = std::min(y_min, a_nodes[3 * n + 1]);
+    z_min = std::min(z_min, a_nodes[3 * n + 2]);
+    x_max = std::max(x_max, a_nodes[3 * n]);
+    y_max = std::max(y_max, a_nodes[3 * n + 1]);
+    z_max = std::max(z_max, a_nodes[3 * n + 2]);
+  }
+  mesh.bounding_pts_m = {
+      {IRL::Pt(x_min, y_min, z_min), IRL::Pt(x_max, y_max, z_max)}};
+
+  // Tets around each node, with those of node n in
+  // node_tets[node_offsets[n]:node_offsets[n+1]]
+  std::vector<int> node_offsets(number_of_nodes + 1, 0);
+#pragma omp parallel for schedule(static)
+  for (int v = 0; v < 4 * number_of_cells; ++v) {
+#pragma omp atomic
+    ++node_offsets[a_tets[v] + 1];
+  }
+  for (int n = 0; n < number_of_nodes; ++n) {
+    node_offsets[n + 1] += node_offsets[n];
+  }
+  std::vector<int> fill(node_offsets.begin(), node_offsets.end() - 1);
+  std::vector<int> node_tets(4 * number_of_cells);
+#pragma omp parallel for schedule(static)
+  for (int v = 0; v < 4 * number_of_cells; ++v) {
+    int slot;
+#pragma omp atomic capture
+    slot = fill[a_tets[v]]++;
+    node_tets[slot] = v / 4;
+  }
+  // Sorted so the neighbors found do not depend on the thread schedule
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (int n = 0; n < number_of_nodes; ++n) {
+    std::sort(node_tets.begin() + node_offsets[n],
+              node_tets.begin() + node_offsets[n + 1]);
+  }
+
+  mesh.face_offsets_m.resize(number_of_cells + 1);
+  for (auto& normal : mesh.normals_m) {
+    normal.resize(4 * number_of_cells);
+  }
+  mesh.distances_m.resize(4 * number_of_cells);
+  mesh.neighbors_m.resize(4 * number_of_cells);
+#pragma omp parallel for schedule(static)
+  for (int c = 0; c < number_of_cells; ++c) {
+    mesh.face_offsets_m[c] = 4 * c;
+    for (int f = 0; f < 4; ++f) {
+      const int opposite = a_tets[4 * c + f];
+      const int a = a_tets[4 * c + (f + 1) % 4];
+      const int b = a_tets[4 * c + (f + 2) % 4];
+      const int d = a_tets[4 * c + (f + 3) % 4];
+      const double* pa = &a_nodes[3 * a];
+      const double* pb = &a_nodes[3 * b];
+      const double* pd = &a_nodes[3 * d];
+      const double* po = &a_nodes[3 * opposite];
+      const double ab[3] = {pb[0] - pa[0], pb[1] - pa[1], pb[2] - pa[2]};
+      const double ad[3] = {pd[0] - pa[0], pd[1] - pa[1], pd[2] - pa[2]};
+      double normal[3] = {ab[1] * ad[2] - ab[2] * ad[1],
+                          ab[2] * ad[0] - ab[0] * ad[2],
+                          ab[0] * ad[1] - ab[1] * ad[0]};
+      // Point the normal away from the opposite node
+      double scale = 1.0 / std::sqrt(normal[0] * normal[0] +
+                                     normal[1] * normal[1] +
+                                     normal[2] * normal[2]);
+      if (normal[0] * (po[0] - pa[0]) + normal[1] * (po[1] - pa[1]) +
+              normal[2] * (po[2] - pa[2]) >
+          0.0) {
+        scale = -scale;
+      }
+      double distance = 0.0;
+      for (int n = 0; n < 3; ++n) {
+        normal[n] *= scale;
+        mesh.normals_m[n][4 * c + f] = normal[n];
+        distance += normal[n] * pa[n];
+      }
+      mesh.distances_m[4 * c + f] = distance;
+
+      // The other tet holding all three face nodes, if any
+      int neighbor = -1;
+      for (int t = node_offsets[a]; t < node_offsets[a + 1]; ++t) {
+        const int tet = node_tets[t];
+        if (tet != c && tetHasNodes(a_tets, tet, b, d)) {
+          neighbor = tet;
+          break;
+        }
+      }
+      mesh.neighbors_m[4 * c + f] = neighbor;
+    }
+  }
+  mesh.face_offsets_m[number_of_cells] = 4 * number_of_cells;
+  double end = omp_get_wtime();
+  mesh.setup_time_m = end - start;
+  return mesh;
+}
+
+std::array<IRL::Pt, 2> CompactMesh::getCellBoundingBox(
+    const int a_cell) const {
+  if (is_cubic_m) {
+    const int i = a_cell % ncells_m[0];
+    const int j = (a_cell / ncells_m[0]) % ncells_m[1];
+    const int k = a_cell / (ncells_m[0] * ncells_m[1]);
+    const std::array<int, 3> ijk{{i, j, k}};
+    std::array<IRL::Pt, 2> box;
+    for (int d = 0; d < 3; ++d) {
+      const double dx = (bounding_pts_m[1][d] - bounding_pts_m[0][d]) /
+                        static_cast<double>(ncells_m[d]);
+      box[0][d] = bounding_pts_m[0][d] + static_cast<double>(ijk[d]) * dx;
+      box[1][d] = box[0][d] + dx;
+    }
+    return box;
+  }
+  std::array<IRL::Pt, 2> box{{IRL::Pt(DBL_MAX, DBL_MAX, DBL_MAX),
+                              IRL::Pt(-DBL_MAX, -DBL_MAX, -DBL_MAX)}};
+  for (int v = 0; v < 4; ++v) {
+    const double* pt = &nodes_m[3 * cell_nodes_m[4 * a_cell + v]];
+    for (int d = 0; d < 3; ++d) {
+      box[0][d] = std::min(box[0][d], pt[d]);
+      box[1][d] = std::max(box[1][d], pt[d]);
+    }
+  }
+  return box;
+}
+
+std::size_t CompactMesh::getMemoryFootprint(void) const {
+  std::size_t bytes = face_offsets_m.capacity() * sizeof(int) +
+                      distances_m.capacity() * sizeof(double) +
+                      neighbors_m.capacity() * sizeof(int) +
+                      nodes_m.capacity() * sizeof(double) +
+                      cell_nodes_m.capacity() * sizeof(int);
+  for (const auto& normal : normals_m) {
+    bytes += normal.capacity() * sizeof(double);
+  }
+  return bytes;
+}
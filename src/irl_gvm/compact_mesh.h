@@ -0,0 +1,103 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// A mesh stored as flat arrays instead of PlanarLocalizer and
+// LocalizerLink objects. The faces of every cell are kept in one
+// structure-of-arrays, with the faces of cell c at indices
+// getFacesBegin(c) to getFacesEnd(c) - 1 (CSR offsets). Each face holds
+// its plane, as the three normal components and the distance, and the
+// index of the cell on the other side of it, or -1 on the mesh boundary.
+// Cell Ids are implicit in the cell index. There are no pointers, so the
+// mesh can be copied, moved and built in parallel. LocalizerMesh::fromCompact
+// turns it into the LocalizerLink view that IRL distributes over.
+// Unstructured tet meshes, such as those read by readGmshTetMesh, are
+// built with fromTets.
+
+#ifndef SRC_IRL_GVM_COMPACT_MESH_H_
+#define SRC_IRL_GVM_COMPACT_MESH_H_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// IRL source directory
+#include "src/geometry/general/pt.h"
+
+class CompactMesh {
+ public:
+  // Cartesian mesh of a_ncells cells covering the box between the two
+  // bounding points, with the same cell and face ordering as
+  // LocalizerMesh::fromCubic. Built with all OpenMP threads.
+  static CompactMesh fromCubic(const std::array<IRL::Pt, 2>& a_bounding_pts,
+                               const std::array<int, 3>& a_ncells);
+
+  // Tet mesh with the X/Y/Z coordinates of each node in a_nodes and the
+  // four node indices of each tet in a_tets, in either orientation. Face f
+  // of a tet is the one opposite its node f. The cell across each face is
+  // found by searching the tets sharing one of its nodes, so no global
+  // face table is built. Built with all OpenMP threads.
+  static CompactMesh fromTets(const std::vector<double>& a_nodes,
+                              const std::vector<int>& a_tets);
+
+  int getNumberOfCells(void) const {
+    return static_cast<int>(face_offsets_m.size()) - 1;
+  }
+
+  int getFacesBegin(const int a_cell) const { return face_offsets_m[a_cell]; }
+  int getFacesEnd(const int a_cell) const {
+    return face_offsets_m[a_cell + 1];
+  }
+
+  // Component a_dim of the outward normal of face a_face
+  double getFaceNormal(const int a_face, const int a_dim) const {
+    return normals_m[a_dim][a_face];
+  }
+  double getFaceDistance(const int a_face) const {
+    return distances_m[a_face];
+  }
+  // Cell across face a_face, or -1 on the mesh boundary
+  int getNeighbor(const int a_face) const { return neighbors_m[a_face]; }
+
+  // Lower and upper corners of the box around cell a_cell
+  std::array<IRL::Pt, 2> getCellBoundingBox(const int a_cell) const;
+
+  // True for meshes from fromCubic, which also know their cells per
+  // direction.
+  bool isCubic(void) const { return is_cubic_m; }
+  // Box around the whole mesh
+  const std::array<IRL::Pt, 2>& getBoundingPts(void) const {
+    return bounding_pts_m;
+  }
+  const std::array<int, 3>& getNumberOfCellsPerDirection(void) const {
+    return ncells_m;
+  }
+
+  // Wall time in seconds taken to build the mesh
+  double getSetupTime(void) const { return setup_time_m; }
+
+  // Bytes held by the face, offset and node arrays
+  std::size_t getMemoryFootprint(void) const;
+
+ private:
+  CompactMesh(void);
+
+  std::vector<int> face_offsets_m;
+  std::array<std::vector<double>, 3> normals_m;
+  std::vector<double> distances_m;
+  std::vector<int> neighbors_m;
+  // Node coordinates and the four nodes of each cell for tet meshes
+  std::vector<double> nodes_m;
+  std::vector<int> cell_nodes_m;
+  bool is_cubic_m;
+  std::array<IRL::Pt, 2> bounding_pts_m;
+  std::array<int, 3> ncells_m;
+  double setup_time_m;
+};
+
+#endif  // SRC_IRL_GVM_COMPACT_MESH_H_
@@ -0,0 +1,269 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/irl_gvm/gmsh_reader.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// Number of nodes of each element type defined by the Gmsh version 2
+// format, needed to step over elements in binary files, where an element
+// of a type not kept is skipped like in ASCII files. Returns -1 for
+// numbers that are not a version 2 element type.
+static int getNodesPerElement(const int a_type) {
+  switch (a_type) {
+    case 1:  // 2-node line
+      return 2;
+    case 2:  // 3-node triangle
+      return 3;
+    case 3:  // 4-node quadrangle
+      return 4;
+    case 4:  // 4-node tetrahedron
+      return 4;
+    case 5:  // 8-node hexahedron
+      return 8;
+    case 6:  // 6-node prism
+      return 6;
+    case 7:  // 5-node pyramid
+      return 5;
+    case 8:  // 3-node line
+      return 3;
+    case 9:  // 6-node triangle
+      return 6;
+    case 10:  // 9-node quadrangle
+      return 9;
+    case 11:  // 10-node tetrahedron
+      return 10;
+    case 12:  // 27-node hexahedron
+      return 27;
+    case 13:  // 18-node prism
+      return 18;
+    case 14:  // 14-node pyramid
+      return 14;
+    case 15:  // 1-node point
+      return 1;
+    case 16:  // 8-node quadrangle
+      return 8;
+    case 17:  // 20-node hexahedron
+      return 20;
+    case 18:  // 15-node prism
+      return 15;
+    case 19:  // 13-node pyramid
+      return 13;
+    case 20:  // 9-node triangle
+      return 9;
+    case 21:  // 10-node triangle
+      return 10;
+    case 22:  // 12-node triangle
+      return 12;
+    case 23:  // 15-node triangle
+      return 15;
+    case 24:  // 15-node triangle
+      return 15;
+    case 25:  // 21-node triangle
+      return 21;
+    case 26:  // 4-node line
+      return 4;
+    case 27:  // 5-node line
+      return 5;
+    case 28:  // 6-node line
+      return 6;
+    case 29:  // 20-node tetrahedron
+      return 20;
+    case 30:  // 35-node tetrahedron
+      return 35;
+    case 31:  // 56-node tetrahedron
+      return 56;
+    case 92:  // 64-node hexahedron
+      return 64;
+    case 93:  // 125-node hexahedron
+      return 125;
+  }
+  return -1;
+}
+
+// Tetrahedra of any order, whose first four nodes are the corners
+static bool isTet(const int a_type) {
+  return a_type == 4 || a_type == 11 || (a_type >= 29 && a_type <= 31);
+}
+
+static bool fail(const std::string& a_file_name, const std::string& a_reason) {
+  std::cerr << "Could not read Gmsh mesh " << a_file_name << ": " << a_reason
+            << std::endl;
+  return false;
+}
+
+template <class ValueType>
+static ValueType readBinary(std::ifstream* a_file) {
+  ValueType value;
+  a_file->read(reinterpret_cast<char*>(&value), sizeof(ValueType));
+  return value;
+}
+
+bool readGmshTetMesh(const std::string& a_file_name,
+                     std::vector<double>* a_nodes, std::vector<int>* a_tets) {
+  std::ifstream file(a_file_name, std::ios::binary);
+  if (!file) {
+    return fail(a_file_name, "file could not be opened");
+  }
+  a_nodes->clear();
+  a_tets->clear();
+
+  bool binary = false;
+  bool found_format = false;
+  // Gmsh node number of each node, in the order read
+  std::vector<int> node_numbers;
+  // Gmsh node numbers of each tet, mapped to indices once all are read
+  std::vector<int> tet_node_numbers;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.compare(0, 11, "$MeshFormat") == 0) {
+      double version;
+      int file_type, data_size;
+      file >> version >> file_type >> data_size;
+      if (!file || version < 2.0 || version >= 3.0) {
+        return fail(a_file_name, "only version 2 files are supported");
+      }
+      binary = file_type == 1;
+      std::getline(file, line);
+      if (binary) {
+        if (data_size != static_cast<int>(sizeof(double)) ||
+            readBinary<int>(&file) != 1) {
+          return fail(a_file_name,
+                      "binary data size or byte order does not match");
+        }
+        std::getline(file, line);
+      }
+      found_format = true;
+    } else if (line.compare(0, 6, "$Nodes") == 0) {
+      if (!found_format) {
+        return fail(a_file_name, "$Nodes found before $MeshFormat");
+      }
+      int number_of_nodes;
+      file >> number_of_nodes;
+      std::getline(file, line);
+      node_numbers.resize(number_of_nodes);
+      a_nodes->resize(3 * number_of_nodes);
+      for (int n = 0; n < number_of_nodes; ++n) {
+        if (binary) {
+          node_numbers[n] = readBinary<int>(&file);
+          file.read(reinterpret_cast<char*>(&(*a_nodes)[3 * n]),
+                    3 * sizeof(double));
+        } else {
+          file >> node_numbers[n] >> (*a_nodes)[3 * n] >>
+              (*a_nodes)[3 * n + 1] >> (*a_nodes)[3 * n + 2];
+        }
+      }
+      if (!file) {
+        return fail(a_file_name, "$Nodes section is truncated");
+      }
+      std::getline(file, line);
+    } else if (line.compare(0, 9, "$Elements") == 0) {
+      int number_of_elements;
+      file >> number_of_elements;
+      std::getline(file, line);
+      if (binary) {
+        // Elements come in blocks of one type, each starting with the
+        // type, the number of elements and the number of tags
+        std::vector<int> element;
+        for (int n = 0; n < number_of_elements;) {
+          const int type = readBinary<int>(&file);
+          const int elements_in_block = readBinary<int>(&file);
+          const int number_of_tags = readBinary<int>(&file);
+          const int nodes_per_element = getNodesPerElement(type);
+          if (!file || nodes_per_element < 0 || elements_in_block < 1) {
+            return fail(a_file_name, "invalid element block of type " +
+                                         std::to_string(type));
+          }
+          element.resize(1 + number_of_tags + nodes_per_element);
+          for (int e = 0; e < elements_in_block; ++e) {
+            file.read(reinterpret_cast<char*>(element.data()),
+                      element.size() * sizeof(int));
+            if (isTet(type)) {
+              tet_node_numbers.insert(tet_node_numbers.end(),
+                                      element.begin() + 1 + number_of_tags,
+                                      element.begin() + 5 + number_of_tags);
+            }
+          }
+          n += elements_in_block;
+        }
+        std::getline(file, line);
+      } else {
+        for (int n = 0; n < number_of_elements; ++n) {
+          std::getline(file, line);
+          std::istringstream element(line);
+          int number, type, number_of_tags, tag;
+          element >> number >> type >> number_of_tags;
+          if (!isTet(type)) {
+            continue;
+          }
+          for (int t = 0; t < number_of_tags; ++t) {
+            element >> tag;
+          }
+          for (int v = 0; v < 4; ++v) {
+            int node_number;
+            element >> node_number;
+            tet_node_numbers.push_back(node_number);
+          }
+          if (!element) {
+            return fail(a_file_name, "tet element " + std::to_string(number) +
+                                         " is truncated");
+          }
+        }
+      }
+      if (!file) {
+        return fail(a_file_name, "$Elements section is truncated");
+      }
+    }
+  }
+  if (node_numbers.empty() || tet_node_numbers.empty()) {
+    return fail(a_file_name, "no nodes or no tetrahedra found");
+  }
+
+  // Gmsh node numbers are positive but need not be consecutive
+  const int max_node_number =
+      *std::max_element(node_numbers.begin(), node_numbers.end());
+  std::vector<int> node_index(max_node_number + 1, -1);
+  for (std::size_t n = 0; n < node_numbers.size(); ++n) {
+    node_index[node_numbers[n]] = static_cast<int>(n);
+  }
+  a_tets->resize(tet_node_numbers.size());
+  for (std::size_t n = 0; n < tet_node_numbers.size(); ++n) {
+    const int node_number = tet_node_numbers[n];
+    if (node_number < 0 || node_number > max_node_number ||
+        node_index[node_number] < 0) {
+      return fail(a_file_name, "tet uses undefined node " +
+                                   std::to_string(node_number));
+    }
+    (*a_tets)[n] = node_index[node_number];
+  }
+
+  // Degenerate tets have no outward face normals, so they are rejected
+  // here rather than left to CompactMesh::fromTets
+  for (std::size_t t = 0; t < a_tets->size() / 4; ++t) {
+    const double* p0 = &(*a_nodes)[3 * (*a_tets)[4 * t]];
+    double edges[3][3];
+    for (int e = 0; e < 3; ++e) {
+      const double* p = &(*a_nodes)[3 * (*a_tets)[4 * t + e + 1]];
+      for (int d = 0; d < 3; ++d) {
+        edges[e][d] = p[d] - p0[d];
+      }
+    }
+    const double volume =
+        edges[0][0] * (edges[1][1] * edges[2][2] - edges[1][2] * edges[2][1]) +
+        edges[0][1] * (edges[1][2] * edges[2][0] - edges[1][0] * edges[2][2]) +
+        edges[0][2] * (edges[1][0] * edges[2][1] - edges[1][1] * edges[2][0]);
+    if (volume == 0.0) {
+      return fail(a_file_name, "tet " + std::to_string(t) + " has zero volume");
+    }
+  }
+  return true;
+}
@@ -0,0 +1,31 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Reader for unstructured tet meshes stored in the Gmsh .msh version 2
+// format, either ASCII or binary. Only the nodes and the 4-node (and the
+// corner nodes of higher order) tetrahedra are kept; every other element,
+// such as boundary triangles, and every other section is skipped. The
+// result can be passed to CompactMesh::fromTets.
+
+#ifndef SRC_IRL_GVM_GMSH_READER_H_
+#define SRC_IRL_GVM_GMSH_READER_H_
+
+#include <string>
+#include <vector>
+
+// Reads a_file_name, storing the X/Y/Z coordinates of each node in
+// a_nodes and the four node indices of each tet in a_tets. Gmsh node
+// numbers are replaced by 0-based indices in the order the nodes appear.
+// Returns false, after printing the reason to std::cerr, if the file
+// cannot be opened, is not a valid version 2 mesh, or holds a tet of
+// zero volume.
+bool readGmshTetMesh(const std::string& a_file_name,
+                     std::vector<double>* a_nodes, std::vector<int>* a_tets);
+
+#endif  // SRC_IRL_GVM_GMSH_READER_H_
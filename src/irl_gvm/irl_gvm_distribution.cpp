@@ -7,11 +7,15 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
-#include "src/irl_gvm/irl_gvm_intersection.h"
+#include "src/irl_gvm/irl_gvm_distribution.h"
 
 #include <omp.h>
 
-#include <fstream>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+#include <vector>
 
 // Timing IRL GVM directory
 #include "src/irl_gvm/stellated_dodecahedron.h"
@@ -19,132 +23,26 @@
 
 // IRL source directory
 #include "src/generic_cutting/generic_cutting.h"
-#include "src/geometry/general/plane.h"
-#include "src/geometry/polyhedrons/general_polyhedron.h"
-#include "src/geometry/polyhedrons/polyhedron_connectivity.h"
 #include "src/geometry/polyhedrons/rectangular_cuboid.h"
-#include "src/geometry/polyhedrons/triangular_prism.h"
-#include "src/helpers/mymath.h"
 #include "src/parameters/defined_types.h"
 
-// If true, will print out each object  to .vtu files
-static bool constexpr PRINT_OBJECTS = false;
-
-// This function sets up the cubic mesh. In IRL,
-// this means generating PlanarLocalizer objects
-// to represent the cell faces (and serve as edges
-// in the graph) and connecting them together to form
-// LocalizerLink objects. Together, the LocalizerLink objects
-// for the graph of the mesh over which we will distribute.
-static void setupCubicMesh(const std::array<IRL::Pt, 2> a_bounding_pts,
-                           const std::array<int, 3> a_ncells,
-                           std::vector<IRL::PlanarLocalizer> *a_localizers,
-                           std::vector<IRL::LocalizerLink> *a_links) {
-  std::array<double, 3> dx{{(a_bounding_pts[1][0] - a_bounding_pts[0][0]) /
-                                static_cast<double>(a_ncells[0]),
-                            (a_bounding_pts[1][1] - a_bounding_pts[0][1]) /
-                                static_cast<double>(a_ncells[1]),
-                            (a_bounding_pts[1][2] - a_bounding_pts[0][2]) /
-                                static_cast<double>(a_ncells[2])}};
-  a_localizers->resize(a_ncells[0] * a_ncells[1] * a_ncells[2]);
-  a_links->resize(a_ncells[0] * a_ncells[1] * a_ncells[2]);
-  std::array<IRL::Pt, 2> local_bb;
-  for (int k = 0; k < a_ncells[2]; ++k) {
-    for (int j = 0; j < a_ncells[1]; ++j) {
-      for (int i = 0; i < a_ncells[0]; ++i) {
-        const int index = i + j * a_ncells[0] + k * a_ncells[1] * a_ncells[0];
-        local_bb[0] =
-            a_bounding_pts[0] + IRL::Pt(static_cast<double>(i) * dx[0],
-                                        static_cast<double>(j) * dx[1],
-                                        static_cast<double>(k) * dx[2]);
-        local_bb[1] = local_bb[0] + IRL::Pt(dx[0], dx[1], dx[2]);
-        // Set up reconstructions
-        (*a_localizers)[index].setNumberOfPlanes(6);
-        (*a_localizers)[index][0] =
-            IRL::Plane(IRL::Normal(1.0, 0.0, 0.0), local_bb[1][0]);
-        (*a_localizers)[index][1] =
-            IRL::Plane(IRL::Normal(-1.0, 0.0, 0.0), -local_bb[0][0]);
-        (*a_localizers)[index][2] =
-            IRL::Plane(IRL::Normal(0.0, 1.0, 0.0), local_bb[1][1]);
-        (*a_localizers)[index][3] =
-            IRL::Plane(IRL::Normal(0.0, -1.0, 0.0), -local_bb[0][1]);
-        (*a_localizers)[index][4] =
-            IRL::Plane(IRL::Normal(0.0, 0.0, 1.0), local_bb[1][2]);
-        (*a_localizers)[index][5] =
-            IRL::Plane(IRL::Normal(0.0, 0.0, -1.0), -local_bb[0][2]);
-
-        // Now set link connections
-        (*a_links)[index] = IRL::LocalizerLink(&(*a_localizers)[index]);
-        (*a_links)[index].setId(index);
-        (*a_links)[index].setEdgeConnectivity(
-            0, i != a_ncells[0] - 1 ? &(*a_links)[index + 1] : nullptr);
-        (*a_links)[index].setEdgeConnectivity(1, i != 0 ? &(*a_links)[index - 1]
-                                                        : nullptr);
-        (*a_links)[index].setEdgeConnectivity(
-            2,
-            j != a_ncells[1] - 1 ? &(*a_links)[index + a_ncells[0]] : nullptr);
-        (*a_links)[index].setEdgeConnectivity(
-            3, j != 0 ? &(*a_links)[index - a_ncells[0]] : nullptr);
-        (*a_links)[index].setEdgeConnectivity(
-            4, k != a_ncells[2] - 1
-                   ? &(*a_links)[index + a_ncells[0] * a_ncells[1]]
-                   : nullptr);
-        (*a_links)[index].setEdgeConnectivity(
-            5,
-            k != 0 ? &(*a_links)[index - a_ncells[0] * a_ncells[1]] : nullptr);
-      }
-    }
-  }
-
-  if (PRINT_OBJECTS) {
-    for (int k = 0; k < a_ncells[2]; ++k) {
-      for (int j = 0; j < a_ncells[1]; ++j) {
-        for (int i = 0; i < a_ncells[0]; ++i) {
-          local_bb[0] =
-              a_bounding_pts[0] + IRL::Pt(static_cast<double>(i) * dx[0],
-                                          static_cast<double>(j) * dx[1],
-                                          static_cast<double>(k) * dx[2]);
-          local_bb[1] = local_bb[0] + IRL::Pt(dx[0], dx[1], dx[2]);
-          const int index = i + j * a_ncells[0] + k * a_ncells[1] * a_ncells[0];
-          auto poly =
-              IRL::RectangularCuboid::fromBoundingPts(local_bb[0], local_bb[1]);
-          auto &half_edge = IRL::setHalfEdgeStructure(poly);
-          auto segmented = half_edge.generateSegmentedPolyhedron();
-          std::string filename = "cube_mesh_" + std::to_string(index) + ".vtu";
-          std::ofstream myfile;
-          myfile.open(filename);
-          myfile << segmented;
-          myfile.close();
-        }
-      }
-    }
-  }
-}
-
-void irl_gvm_cubeOntoCubicMesh(const double *a_cube_pts, double *a_volume,
+// Distributes a_polyhedron onto a_mesh, starting from the cell holding
+// a_center if a_locate_seed is true and from the mesh's fixed seed
+// otherwise, and returns the summed volume and number of cells entered.
+template <class PolyhedronType>
+static void distributeOntoMesh(const PolyhedronType &a_polyhedron,
+                               const IRL::Pt &a_center,
+                               const LocalizerMesh &a_mesh,
+                               const bool a_locate_seed, double *a_volume,
                                double *a_times, std::size_t *a_entered_cells) {
-  std::array<IRL::Pt, 2> mesh_box{
-      {IRL::Pt(-3.0, -3.0, -3.0), IRL::Pt(3.0, 3.0, 3.0)}};
-  std::array<int, 3> ncells{{3, 3, 3}};
-  static std::vector<IRL::PlanarLocalizer> localizers;
-  static std::vector<IRL::LocalizerLink> links;
-  static bool mesh_made = false;
-  if (!mesh_made) {
-    mesh_made = true;
-    setupCubicMesh(mesh_box, ncells, &localizers, &links);
-  }
-
   // This will return the volume from each cell, tagged with that cells unique
-  // Id set during setupCubicMesh
-  const auto cube = IRL::RectangularCuboid::fromBoundingPts(
-      IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
-      IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
+  // Id set during the mesh setup. Locating the seed is part of the timing.
   double start = omp_get_wtime();
-  const int mid_localizer = ncells[0] / 2 + ncells[1] / 2 * ncells[0] +
-                            ncells[2] / 2 * ncells[0] * ncells[1];
+  const auto &seed = a_locate_seed ? a_mesh.getSeedLink(a_center)
+                                   : a_mesh.getFixedSeedLink();
   auto tagged_volumes =
       IRL::getVolumeMoments<IRL::TaggedAccumulatedVolumeMoments<IRL::Volume>>(
-          cube, links[mid_localizer]);
+          a_polyhedron, seed);
   double end = omp_get_wtime();
   a_times[0] = end - start;
 
@@ -156,478 +54,583 @@ void irl_gvm_cubeOntoCubicMesh(const double *a_cube_pts, double *a_volume,
   *a_entered_cells = static_cast<std::size_t>(tagged_volumes.size());
 }
 
-void irl_gvm_stelIcosahedronOntoCubicMesh(const double *a_stel_icosahedron_pts,
-                                          double *a_volume, double *a_times,
-                                          std::size_t *a_entered_cells) {
-  std::array<IRL::Pt, 2> mesh_box{
-      {IRL::Pt(-3.0, -3.0, -3.0), IRL::Pt(3.0, 3.0, 3.0)}};
-  std::array<int, 3> ncells{{3, 3, 3}};
-  static std::vector<IRL::PlanarLocalizer> localizers;
-  static std::vector<IRL::LocalizerLink> links;
-  static bool mesh_made = false;
-  if (!mesh_made) {
-    mesh_made = true;
-    setupCubicMesh(mesh_box, ncells, &localizers, &links);
-  }
-
-  // This will return the volume from each cell, tagged with that cells unique
-  // Id set during setupCubicMesh
-  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
-      32, a_stel_icosahedron_pts);
-
+// Distributes a_polyhedron onto a_mesh, starting from the cell holding
+// a_center, and adds the volume in each cell to a_cell_volumes.
+template <class PolyhedronType>
+static void distributeOntoMeshCells(const PolyhedronType &a_polyhedron,
+                                    const IRL::Pt &a_center,
+                                    const LocalizerMesh &a_mesh,
+                                    double *a_cell_volumes, double *a_volume,
+                                    double *a_times,
+                                    std::size_t *a_entered_cells) {
   double start = omp_get_wtime();
-  const int mid_localizer = ncells[0] / 2 + ncells[1] / 2 * ncells[0] +
-                            ncells[2] / 2 * ncells[0] * ncells[1];
-  auto tagged_volumes =
+  const auto tagged_volumes =
       IRL::getVolumeMoments<IRL::TaggedAccumulatedVolumeMoments<IRL::Volume>>(
-          stel_icosahedron, links[mid_localizer]);
-  double end = omp_get_wtime();
-  a_times[0] = end - start;
-
-  // Return volume that is the sum of the distributed volume
+          a_polyhedron, a_mesh.getSeedLink(a_center));
   *a_volume = 0.0;
   for (const auto &volume : tagged_volumes) {
+    a_cell_volumes[volume.tag_m] += volume.volume_moments_m;
     *a_volume += volume.volume_moments_m;
   }
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
   *a_entered_cells = static_cast<std::size_t>(tagged_volumes.size());
 }
 
-// Tetrahedral mesh-type domain with a cuboid decomposed into
-// 24 tets using face centroids and the cell center.
-// This function sets up the Tet  mesh. In IRL,
-// this means generating PlanarLocalizer objects
-// to represent the cell faces (and serve as edges
-// in the graph) and connecting them together to form
-// LocalizerLink objects. Together, the LocalizerLink objects
-// for the graph of the mesh over which we will distribute.
-static void setupTetMesh(const std::array<IRL::Pt, 2> a_bounding_pts,
-                         std::vector<IRL::PlanarLocalizer> *a_localizers,
-                         std::vector<IRL::LocalizerLink> *a_links) {
-  const std::array<IRL::Pt, 8> cuboid_pts{
-      {IRL::Pt(a_bounding_pts[1][0], a_bounding_pts[0][1],
-               a_bounding_pts[0][2]),
-       IRL::Pt(a_bounding_pts[1][0], a_bounding_pts[1][1],
-               a_bounding_pts[0][2]),
-       IRL::Pt(a_bounding_pts[1][0], a_bounding_pts[1][1],
-               a_bounding_pts[1][2]),
-       IRL::Pt(a_bounding_pts[1][0], a_bounding_pts[0][1],
-               a_bounding_pts[1][2]),
-       IRL::Pt(a_bounding_pts[0][0], a_bounding_pts[0][1],
-               a_bounding_pts[0][2]),
-       IRL::Pt(a_bounding_pts[0][0], a_bounding_pts[1][1],
-               a_bounding_pts[0][2]),
-       IRL::Pt(a_bounding_pts[0][0], a_bounding_pts[1][1],
-               a_bounding_pts[1][2]),
-       IRL::Pt(a_bounding_pts[0][0], a_bounding_pts[0][1],
-               a_bounding_pts[1][2])}};
-
-  const std::array<std::array<int, 4>, 6> face_indices{{{0, 1, 2, 3},
-                                                        {0, 4, 5, 1},
-                                                        {1, 5, 6, 2},
-                                                        {2, 6, 7, 3},
-                                                        {3, 7, 4, 0},
-                                                        {4, 7, 6, 5}}};
-
-  const std::array<IRL::Normal, 6> face_normals{
-      {IRL::Normal(1.0, 0.0, 0.0), IRL::Normal(0.0, 0.0, -1.0),
-       IRL::Normal(0.0, 1.0, 0.0), IRL::Normal(0.0, 0.0, 1.0),
-       IRL::Normal(0.0, -1.0, 0.0), IRL::Normal(-1.0, 0.0, 0.0)}};
-  std::array<IRL::Pt, 6> face_centroids;
-  for (std::size_t f = 0; f < face_centroids.size(); ++f) {
-    face_centroids[f] = IRL::Pt::fromScalarConstant(0.0);
-    for (const auto &index : face_indices[f]) {
-      face_centroids[f] += cuboid_pts[index];
+// Distributes a_polyhedron onto a_mesh, starting from the cell holding
+// a_center, and adds the volume on each side of the interface in each
+// cell to a_cell_volumes.
+template <class PolyhedronType>
+static void distributeOntoSeparatedMeshCells(
+    const PolyhedronType &a_polyhedron, const IRL::Pt &a_center,
+    const LocalizedSeparatorMesh &a_mesh, double *a_cell_volumes,
+    double *a_volumes, double *a_times, std::size_t *a_entered_cells) {
+  double start = omp_get_wtime();
+  const auto tagged_volumes = IRL::getVolumeMoments<
+      IRL::TaggedAccumulatedVolumeMoments<IRL::SeparatedMoments<IRL::Volume>>>(
+      a_polyhedron, a_mesh.getSeedLink(a_center));
+  a_volumes[0] = 0.0;
+  a_volumes[1] = 0.0;
+  for (const auto &volumes : tagged_volumes) {
+    for (IRL::UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+      a_cell_volumes[2 * volumes.tag_m + phase] +=
+          volumes.volume_moments_m[phase];
+      a_volumes[phase] += volumes.volume_moments_m[phase];
     }
-    face_centroids[f] /= static_cast<double>(face_indices[f].size());
   }
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  *a_entered_cells = static_cast<std::size_t>(tagged_volumes.size());
+}
 
-  auto volume_centroid = IRL::Pt::fromScalarConstant(0.0);
-  for (const auto vertex : cuboid_pts) {
-    volume_centroid += vertex;
+// Distributes a_polyhedron onto a_mesh from the cell holding a_center by
+// splitting it link by link, counting the work done in a_stats. If
+// a_stop_volume is positive, the walk stops as soon as the volume found
+// reaches it, and the pieces still waiting are counted in
+// a_skipped_links.
+template <class PolyhedronType>
+static void distributeOntoMeshBySplitting(
+    const PolyhedronType &a_polyhedron, const IRL::Pt &a_center,
+    const LocalizerMesh &a_mesh, const double a_stop_volume, double *a_volume,
+    double *a_times, std::size_t *a_entered_cells,
+    std::size_t *a_skipped_links, TraversalStats *a_stats) {
+  double start = omp_get_wtime();
+  auto &half_edge = IRL::setHalfEdgeStructure(a_polyhedron);
+  using SegmentedType = decltype(half_edge.generateSegmentedPolyhedron());
+  // A piece of the polyhedron, the link it is in, and the link it was
+  // split off from, whose shared face need not be tested again
+  struct Piece {
+    SegmentedType polytope;
+    const IRL::LocalizerLink *link;
+    const IRL::LocalizerLink *previous;
+  };
+  TraversalStats stats;
+  std::vector<Piece> stack;
+  std::vector<IRL::UnsignedIndex_t> entered_ids;
+  stack.push_back(
+      {half_edge.generateSegmentedPolyhedron(), &a_mesh.getSeedLink(a_center),
+       nullptr});
+  double volume = 0.0;
+  std::size_t skipped_links = 0;
+  while (!stack.empty()) {
+    if (a_stop_volume > 0.0 && volume >= a_stop_volume) {
+      skipped_links = stack.size();
+      break;
+    }
+    Piece piece = std::move(stack.back());
+    stack.pop_back();
+    const auto &localizer = piece.link->getReconstruction();
+    const IRL::UnsignedIndex_t number_of_planes =
+        localizer.getNumberOfPlanes();
+    for (IRL::UnsignedIndex_t p = 0; p < number_of_planes; ++p) {
+      const IRL::LocalizerLink *neighbor = piece.link->getEdgeConnectivity(p);
+      if (neighbor != nullptr && neighbor == piece.previous) {
+        continue;
+      }
+      if (kCollectTraversalStats) {
+        ++stats.planes_tested;
+      }
+      // On the mesh boundary the part outside the plane is dropped
+      SegmentedType clipped;
+      IRL::splitHalfEdgePolytope(&piece.polytope, &clipped, &half_edge,
+                                 localizer[p]);
+      if (clipped.getNumberOfFaces() == 0) {
+        continue;
+      }
+      if (kCollectTraversalStats && piece.polytope.getNumberOfFaces() > 0) {
+        ++stats.truncations;
+      }
+      if (neighbor != nullptr) {
+        stack.push_back({std::move(clipped), neighbor, piece.link});
+        if (kCollectTraversalStats) {
+          stats.max_stack_depth = std::max(stats.max_stack_depth, stack.size());
+          stats.peak_scratch_bytes = std::max(
+              stats.peak_scratch_bytes, stack.capacity() * sizeof(Piece));
+        }
+      }
+      if (piece.polytope.getNumberOfFaces() == 0) {
+        break;
+      }
+    }
+    const double piece_volume = piece.polytope.getNumberOfFaces() > 0
+                                    ? piece.polytope.calculateVolume()
+                                    : 0.0;
+    if (kCollectTraversalStats) {
+      ++stats.links_visited;
+      if (piece_volume == 0.0) {
+        ++stats.empty_links;
+      }
+    }
+    if (piece_volume != 0.0) {
+      entered_ids.push_back(piece.link->getId());
+    }
+    volume += piece_volume;
+  }
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  *a_volume = volume;
+  *a_skipped_links = skipped_links;
+
+  // A cell can be reached by more than one piece
+  std::sort(entered_ids.begin(), entered_ids.end());
+  *a_entered_cells = static_cast<std::size_t>(
+      std::unique(entered_ids.begin(), entered_ids.end()) -
+      entered_ids.begin());
+  if (kCollectTraversalStats) {
+    *a_stats = stats;
   }
-  volume_centroid /= static_cast<double>(cuboid_pts.size());
+}
 
-  std::array<int, 24> shared_edge_link{{7,  11, 15, 19, 18, 23, 8,  0,
-                                        6,  22, 12, 1,  10, 21, 16, 2,
-                                        14, 20, 4,  3,  17, 13, 9,  5}};
+// Clips a_polyhedron against the localizer of every cell of a_mesh, in
+// parallel, and returns the summed volume.
+template <class PolyhedronType>
+static void distributeByClippingEveryCell(const PolyhedronType &a_polyhedron,
+                                          const LocalizerMesh &a_mesh,
+                                          double *a_volume, double *a_times,
+                                          std::size_t *a_clipped_cells) {
+  const int number_of_cells = a_mesh.getNumberOfCells();
+  double start = omp_get_wtime();
+  double volume = 0.0;
+#pragma omp parallel for schedule(dynamic, 16) reduction(+ : volume)
+  for (int c = 0; c < number_of_cells; ++c) {
+    volume += static_cast<double>(IRL::getVolumeMoments<IRL::Volume>(
+        a_polyhedron, a_mesh.getLocalizer(c)));
+  }
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  *a_volume = volume;
+  *a_clipped_cells = static_cast<std::size_t>(number_of_cells);
+}
 
-  a_localizers->resize(24);
-  a_links->resize(24);
-  for (std::size_t n = 0; n < a_localizers->size(); ++n) {
-    (*a_links)[n] = IRL::LocalizerLink(&(*a_localizers)[n]);
+// Clips a_polyhedron, with bounding box a_box, against the localizers of
+// the cells a_tree finds overlapping a_box, in parallel, and returns the
+// summed volume.
+template <class PolyhedronType>
+static void distributeByClippingOverlappingCells(
+    const PolyhedronType &a_polyhedron, const std::array<IRL::Pt, 2> &a_box,
+    const LocalizerMesh &a_mesh, const CellBoxTree &a_tree, double *a_volume,
+    double *a_times, std::size_t *a_clipped_cells) {
+  double start = omp_get_wtime();
+  std::vector<int> candidates;
+  a_tree.getOverlappingCells(a_box, &candidates);
+  const int number_of_candidates = static_cast<int>(candidates.size());
+  double volume = 0.0;
+#pragma omp parallel for schedule(dynamic, 16) reduction(+ : volume)
+  for (int n = 0; n < number_of_candidates; ++n) {
+    volume += static_cast<double>(IRL::getVolumeMoments<IRL::Volume>(
+        a_polyhedron, a_mesh.getLocalizer(candidates[n])));
   }
-  std::array<IRL::Pt, 4> tet;
-  tet[3] = volume_centroid;
-  for (std::size_t f = 0; f < face_indices.size(); ++f) {
-    tet[2] = face_centroids[f];
-    const auto &face = face_indices[f];
-    for (std::size_t e = 0; e < face.size(); ++e) {
-      tet[0] = cuboid_pts[face[e]];
-      tet[1] = cuboid_pts[face[(e + 1) % face.size()]];
-      const std::size_t index = e + f * 4;
-      (*a_localizers)[index].setNumberOfPlanes(4);
-
-      // Make first plane from on cuboid face
-      IRL::Normal normal = face_normals[f];
-      (*a_localizers)[index][0] =
-          IRL::Plane(normal, normal * face_centroids[f]);
-
-      // Make second plane for face having edge on original cuboid
-      normal = IRL::crossProductNormalized(IRL::Pt(tet[1] - tet[3]),
-                                           IRL::Pt(tet[0] - tet[3]));
-      (*a_localizers)[index][1] = IRL::Plane(normal, normal * tet[3]);
-
-      // Make third plane for tet[0] and face_centroid
-      normal = IRL::crossProductNormalized(IRL::Pt(tet[0] - tet[3]),
-                                           IRL::Pt(tet[2] - tet[3]));
-      (*a_localizers)[index][2] = IRL::Plane(normal, normal * tet[3]);
-
-      // Make fourth plane for tet[1] and face_centroid
-      normal = IRL::crossProductNormalized(IRL::Pt(tet[2] - tet[3]),
-                                           IRL::Pt(tet[1] - tet[3]));
-      (*a_localizers)[index][3] = IRL::Plane(normal, normal * tet[3]);
-
-      // Now link up localizer to rest of the mesh
-      (*a_links)[index].setId(static_cast<IRL::UnsignedIndex_t>(index));
-      (*a_links)[index].setEdgeConnectivity(0, nullptr);
-      (*a_links)[index].setEdgeConnectivity(
-          1, &(*a_links)[shared_edge_link[index]]);
-      std::size_t neighbor = (e + 1) % face.size() + f * 4;
-      (*a_links)[neighbor].setEdgeConnectivity(2, &(*a_links)[index]);
-      (*a_links)[index].setEdgeConnectivity(3, &(*a_links)[neighbor]);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  *a_volume = volume;
+  *a_clipped_cells = candidates.size();
+}
+
+// Bounding box of a_number_of_pts points stored X/Y/Z
+static std::array<IRL::Pt, 2> getPointsBox(const double *a_pts,
+                                           const int a_number_of_pts) {
+  std::array<IRL::Pt, 2> box{{IRL::Pt(a_pts[0], a_pts[1], a_pts[2]),
+                              IRL::Pt(a_pts[0], a_pts[1], a_pts[2])}};
+  for (int v = 1; v < a_number_of_pts; ++v) {
+    for (int d = 0; d < 3; ++d) {
+      box[0][d] = std::min(box[0][d], a_pts[3 * v + d]);
+      box[1][d] = std::max(box[1][d], a_pts[3 * v + d]);
     }
   }
+  return box;
+}
 
-  if (PRINT_OBJECTS) {
-    tet[3] = volume_centroid;
-    for (std::size_t f = 0; f < face_indices.size(); ++f) {
-      tet[2] = face_centroids[f];
-      const auto &face = face_indices[f];
-      for (std::size_t e = 0; e < face.size(); ++e) {
-        tet[0] = cuboid_pts[face[e]];
-        tet[1] = cuboid_pts[face[(e + 1) % face.size()]];
-
-        const std::size_t index = e + f * 4;
-        auto poly = IRL::Tet::fromRawPtPointer(4, tet.data());
-        auto &half_edge = IRL::setHalfEdgeStructure(poly);
-        auto segmented = half_edge.generateSegmentedPolyhedron();
-        std::string filename = "tet_mesh_" + std::to_string(index) + ".vtu";
-        std::ofstream myfile;
-        myfile.open(filename);
-        myfile << segmented;
-        myfile.close();
-      }
-    }
+// Center of a cube given by its lower and upper bounding points
+static IRL::Pt getCubeCenter(const double *a_cube_pts) {
+  return IRL::Pt(0.5 * (a_cube_pts[0] + a_cube_pts[3]),
+                 0.5 * (a_cube_pts[1] + a_cube_pts[4]),
+                 0.5 * (a_cube_pts[2] + a_cube_pts[5]));
+}
+
+// Points 0-11 form the inner icosahedron, so their mean is the center
+static IRL::Pt getStelIcosahedronCenter(const double *a_stel_icosahedron_pts) {
+  IRL::Pt center = IRL::Pt::fromScalarConstant(0.0);
+  for (int v = 0; v < 12; ++v) {
+    center += IRL::Pt(a_stel_icosahedron_pts[3 * v],
+                      a_stel_icosahedron_pts[3 * v + 1],
+                      a_stel_icosahedron_pts[3 * v + 2]);
   }
+  center /= 12.0;
+  return center;
 }
 
-void irl_gvm_cubeOntoTetMesh(const double *a_cube_pts, double *a_volume,
-                             double *a_times, std::size_t *a_entered_cells) {
-  std::array<IRL::Pt, 2> mesh_box{
-      {IRL::Pt(-3.0, -3.0, -3.0), IRL::Pt(3.0, 3.0, 3.0)}};
-  static std::vector<IRL::PlanarLocalizer> localizers;
-  static std::vector<IRL::LocalizerLink> links;
-  static bool mesh_made = false;
-  if (!mesh_made) {
-    mesh_made = true;
-    setupTetMesh(mesh_box, &localizers, &links);
+// Points 0-7 are the hexahedron corners, so their mean is the middle of
+// the flux volume
+static IRL::Pt getSymHexCenter(const double *a_flux_pts) {
+  IRL::Pt center = IRL::Pt::fromScalarConstant(0.0);
+  for (int v = 0; v < 8; ++v) {
+    center += IRL::Pt(a_flux_pts[3 * v], a_flux_pts[3 * v + 1],
+                      a_flux_pts[3 * v + 2]);
   }
+  center /= 8.0;
+  return center;
+}
 
-  // This will return the volume from each cell, tagged with that cells unique
-  // Id set during setupCubicMesh
+void irl_gvm_cubeOntoMesh(const double *a_cube_pts, const LocalizerMesh &a_mesh,
+                          const bool a_locate_seed, double *a_volume,
+                          double *a_times, std::size_t *a_entered_cells) {
   const auto cube = IRL::RectangularCuboid::fromBoundingPts(
       IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
       IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
-  double start = omp_get_wtime();
-  auto tagged_volumes =
-      IRL::getVolumeMoments<IRL::TaggedAccumulatedVolumeMoments<IRL::Volume>>(
-          cube, links[0]);
-  double end = omp_get_wtime();
-  a_times[0] = end - start;
+  distributeOntoMesh(cube, getCubeCenter(a_cube_pts), a_mesh, a_locate_seed,
+                     a_volume, a_times, a_entered_cells);
+}
 
-  // Return volume that is the sum of the distributed volume
-  *a_volume = 0.0;
-  for (const auto &volume : tagged_volumes) {
-    *a_volume += volume.volume_moments_m;
-  }
-  *a_entered_cells = static_cast<std::size_t>(tagged_volumes.size());
+void irl_gvm_stelIcosahedronOntoMesh(const double *a_stel_icosahedron_pts,
+                                     const LocalizerMesh &a_mesh,
+                                     const bool a_locate_seed,
+                                     double *a_volume, double *a_times,
+                                     std::size_t *a_entered_cells) {
+  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, a_stel_icosahedron_pts);
+  distributeOntoMesh(stel_icosahedron,
+                     getStelIcosahedronCenter(a_stel_icosahedron_pts), a_mesh,
+                     a_locate_seed, a_volume, a_times, a_entered_cells);
+}
+
+void irl_gvm_cubeOntoMeshCells(const double *a_cube_pts,
+                               const LocalizerMesh &a_mesh,
+                               double *a_cell_volumes, double *a_volume,
+                               double *a_times,
+                               std::size_t *a_entered_cells) {
+  const auto cube = IRL::RectangularCuboid::fromBoundingPts(
+      IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
+      IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
+  distributeOntoMeshCells(cube, getCubeCenter(a_cube_pts), a_mesh,
+                          a_cell_volumes, a_volume, a_times, a_entered_cells);
+}
+
+void irl_gvm_stelIcosahedronOntoMeshCells(
+    const double *a_stel_icosahedron_pts, const LocalizerMesh &a_mesh,
+    double *a_cell_volumes, double *a_volume, double *a_times,
+    std::size_t *a_entered_cells) {
+  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, a_stel_icosahedron_pts);
+  distributeOntoMeshCells(stel_icosahedron,
+                          getStelIcosahedronCenter(a_stel_icosahedron_pts),
+                          a_mesh, a_cell_volumes, a_volume, a_times,
+                          a_entered_cells);
 }
 
-void irl_gvm_stelIcosahedronOntoTetMesh(const double *a_stel_icosahedron_pts,
-                                        double *a_volume, double *a_times,
+void irl_gvm_cubeOntoSeparatedMeshCells(const double *a_cube_pts,
+                                        const LocalizedSeparatorMesh &a_mesh,
+                                        double *a_cell_volumes,
+                                        double *a_volumes, double *a_times,
                                         std::size_t *a_entered_cells) {
-  std::array<IRL::Pt, 2> mesh_box{
-      {IRL::Pt(-3.0, -3.0, -3.0), IRL::Pt(3.0, 3.0, 3.0)}};
-  static std::vector<IRL::PlanarLocalizer> localizers;
-  static std::vector<IRL::LocalizerLink> links;
-  static bool mesh_made = false;
-  if (!mesh_made) {
-    mesh_made = true;
-    setupTetMesh(mesh_box, &localizers, &links);
-  }
+  const auto cube = IRL::RectangularCuboid::fromBoundingPts(
+      IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
+      IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
+  distributeOntoSeparatedMeshCells(cube, getCubeCenter(a_cube_pts), a_mesh,
+                                   a_cell_volumes, a_volumes, a_times,
+                                   a_entered_cells);
+}
 
-  // This will return the volume from each cell, tagged with that cells unique
-  // Id set during setupCubicMesh
+void irl_gvm_stelIcosahedronOntoSeparatedMeshCells(
+    const double *a_stel_icosahedron_pts, const LocalizedSeparatorMesh &a_mesh,
+    double *a_cell_volumes, double *a_volumes, double *a_times,
+    std::size_t *a_entered_cells) {
   const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
       32, a_stel_icosahedron_pts);
-  double start = omp_get_wtime();
-  auto tagged_volumes =
-      IRL::getVolumeMoments<IRL::TaggedAccumulatedVolumeMoments<IRL::Volume>>(
-          stel_icosahedron, links[0]);
-  double end = omp_get_wtime();
-  a_times[0] = end - start;
+  distributeOntoSeparatedMeshCells(
+      stel_icosahedron, getStelIcosahedronCenter(a_stel_icosahedron_pts),
+      a_mesh, a_cell_volumes, a_volumes, a_times, a_entered_cells);
+}
 
-  // Return volume that is the sum of the distributed volume
-  *a_volume = 0.0;
-  for (const auto &volume : tagged_volumes) {
-    *a_volume += volume.volume_moments_m;
-  }
-  *a_entered_cells = static_cast<std::size_t>(tagged_volumes.size());
+void irl_gvm_symHexOntoMeshCells(const double *a_flux_pts,
+                                 const LocalizerMesh &a_mesh,
+                                 double *a_cell_volumes, double *a_volume,
+                                 double *a_times,
+                                 std::size_t *a_entered_cells) {
+  const auto flux_volume =
+      IRL::SymmetricHexahedron::fromRawDoublePointer(14, a_flux_pts);
+  distributeOntoMeshCells(flux_volume, getSymHexCenter(a_flux_pts), a_mesh,
+                          a_cell_volumes, a_volume, a_times, a_entered_cells);
 }
 
-static IRL::Pt convertToCartesian(const IRL::Pt &a_spherical_pt) {
-  return {a_spherical_pt[0] * std::sin(a_spherical_pt[2]) *
-              std::cos(a_spherical_pt[1]),
-          a_spherical_pt[0] * std::sin(a_spherical_pt[2]) *
-              std::sin(a_spherical_pt[1]),
-          a_spherical_pt[0] * std::cos(a_spherical_pt[2])};
+void irl_gvm_symHexOntoSeparatedMeshCells(
+    const double *a_flux_pts, const LocalizedSeparatorMesh &a_mesh,
+    double *a_cell_volumes, double *a_volumes, double *a_times,
+    std::size_t *a_entered_cells) {
+  const auto flux_volume =
+      IRL::SymmetricHexahedron::fromRawDoublePointer(14, a_flux_pts);
+  distributeOntoSeparatedMeshCells(flux_volume, getSymHexCenter(a_flux_pts),
+                                   a_mesh, a_cell_volumes, a_volumes, a_times,
+                                   a_entered_cells);
 }
 
-// This function sets up the Spherical Cartesian mesh. In IRL,
-// this means generating PlanarLocalizer objects
-// to represent the cell faces (and serve as edges
-// in the graph) and connecting them together to form
-// LocalizerLink objects. Together, the LocalizerLink objects
-// for the graph of the mesh over which we will distribute.
-static void
-setupSphericalCartesianMesh(const double a_radius, const int a_radial_cells,
-                         std::vector<IRL::PlanarLocalizer> *a_localizers,
-                         std::vector<IRL::LocalizerLink> *a_links) {
-
-  assert(a_radial_cells > 0);
-
-  constexpr static int a_theta_cells = 3;
-  constexpr static int a_phi_cells = 3;
-  IRL::Pt center(0.0, 0.0, 0.0);
-
-  constexpr static double d_theta =
-      2.0 * M_PI / static_cast<double>(a_theta_cells);
-  constexpr static double d_phi = 1.0 * M_PI / static_cast<double>(a_phi_cells);
-  const double d_radius = a_radius / static_cast<double>(a_radial_cells);
-
-  a_localizers->resize(1 + (a_radial_cells - 1) * a_theta_cells * a_phi_cells);
-  a_links->resize(1 + (a_radial_cells - 1) * a_theta_cells * a_phi_cells);
-  for (std::size_t n = 0; n < a_localizers->size(); ++n) {
-    (*a_links)[n] = IRL::LocalizerLink(&(*a_localizers)[n]);
-  }
-  (*a_links)[0].setId(0);
-
-  // First reconstruction is a convex sphere like object
-  (*a_localizers)[0].setNumberOfPlanes(a_theta_cells * a_phi_cells);
-  for (int p = 0; p < a_phi_cells; ++p) {
-    for (int t = 0; t < a_theta_cells; ++t) {
-      IRL::Normal normal = convertToCartesian(
-          IRL::Pt(1.0, (static_cast<double>(t) + 0.5) * d_theta,
-                  (static_cast<double>(p) + 0.5) * d_phi));
-      (*a_localizers)[0][t + p * a_theta_cells] = IRL::Plane(normal, d_radius);
-    }
-  }
+void irl_gvm_cubeOntoMeshInstrumented(const double *a_cube_pts,
+                                      const LocalizerMesh &a_mesh,
+                                      double *a_volume, double *a_times,
+                                      std::size_t *a_entered_cells,
+                                      TraversalStats *a_stats) {
+  const auto cube = IRL::RectangularCuboid::fromBoundingPts(
+      IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
+      IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
+  std::size_t skipped_links;
+  distributeOntoMeshBySplitting(cube, getCubeCenter(a_cube_pts), a_mesh, -1.0,
+                                a_volume, a_times, a_entered_cells,
+                                &skipped_links, a_stats);
+}
 
-  // Rest of reconstructions wrap around initial one, propagating outwards
-  // towards the sphere radius
-  for (int r = 1; r < a_radial_cells; ++r) {
-    for (int p = 0; p < a_phi_cells; ++p) {
-      for (int t = 0; t < a_theta_cells; ++t) {
-        const int index =
-            1 + t + p * a_theta_cells + (r - 1) * a_theta_cells * a_phi_cells;
-        IRL::Normal normal = convertToCartesian(
-            IRL::Pt(1.0, (static_cast<double>(t) + 0.5) * d_theta,
-                    (static_cast<double>(p) + 0.5) * d_phi));
-        (*a_localizers)[index].setNumberOfPlanes(6);
-        // Bottom face pointing towards center
-        (*a_localizers)[index][0] =
-            IRL::Plane(-normal, -d_radius * static_cast<double>(r));
-        // Top face pointing towards outside
-        (*a_localizers)[index][1] =
-            IRL::Plane(normal, d_radius * static_cast<double>(r + 1));
-
-        // Side face traveling in -theta direction
-        double angle = static_cast<double>(t) * d_theta;
-        normal = -IRL::Normal(-std::sin(angle), std::cos(angle), 0.0);
-        (*a_localizers)[index][2] = IRL::Plane(normal, 0.0);
-
-        // Side face traveling in +theta direction
-        angle = static_cast<double>(t) * d_theta;
-        normal = IRL::Normal(-std::sin(angle), std::cos(angle), 0.0);
-        (*a_localizers)[index][3] = IRL::Plane(normal, 0.0);
-
-        // Side face traveling in -phi direction
-        angle = static_cast<double>(p) * d_phi;
-        normal = -IRL::Normal(std::cos(angle), 0.0, -std::sin(angle));
-        (*a_localizers)[index][4] = IRL::Plane(normal, 0.0);
-
-        // Side face traveling in +phi direction
-        angle = static_cast<double>(p) * d_phi;
-        normal = IRL::Normal(std::cos(angle), 0.0, -std::sin(angle));
-        (*a_localizers)[index][5] = IRL::Plane(normal, 0.0);
-
-        (*a_links)[index].setId(index);
-        if (r != 1) {
-          (*a_links)[index].setEdgeConnectivity(
-              0, &(*a_links)[index - a_theta_cells * a_phi_cells]);
-        }
-        if (r < a_radial_cells - 1) {
-          (*a_links)[index].setEdgeConnectivity(
-              1, &(*a_links)[index + a_theta_cells * a_phi_cells]);
-        }
-        int neighbor = (t + 1) % a_theta_cells + 1 + p * a_theta_cells +
-                       (r - 1) * a_theta_cells * a_phi_cells;
-        (*a_links)[neighbor].setEdgeConnectivity(2, &(*a_links)[index]);
-        (*a_links)[index].setEdgeConnectivity(3, &(*a_links)[neighbor]);
-        neighbor = 1 + t + ((p + 1) % a_phi_cells) * a_theta_cells +
-                   (r - 1) * a_theta_cells * a_phi_cells;
-        (*a_links)[neighbor].setEdgeConnectivity(4, &(*a_links)[index]);
-        (*a_links)[index].setEdgeConnectivity(5, &(*a_links)[neighbor]);
-      }
-    }
-  }
-  // Have more than one localizer
-  if (a_radial_cells > 1) {
-    for (int p = 0; p < a_phi_cells; ++p) {
-      for (int t = 0; t < a_theta_cells; ++t) {
-        const int index = 1 + t + p * a_theta_cells;
-        (*a_links)[0].setEdgeConnectivity(index - 1, &(*a_links)[index]);
-        (*a_links)[index].setEdgeConnectivity(0, &(*a_links)[0]);
-      }
-    }
-  }
+void irl_gvm_stelIcosahedronOntoMeshInstrumented(
+    const double *a_stel_icosahedron_pts, const LocalizerMesh &a_mesh,
+    double *a_volume, double *a_times, std::size_t *a_entered_cells,
+    TraversalStats *a_stats) {
+  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, a_stel_icosahedron_pts);
+  std::size_t skipped_links;
+  distributeOntoMeshBySplitting(
+      stel_icosahedron, getStelIcosahedronCenter(a_stel_icosahedron_pts),
+      a_mesh, -1.0, a_volume, a_times, a_entered_cells, &skipped_links,
+      a_stats);
+}
 
-  if (PRINT_OBJECTS) {
-    std::array<IRL::Pt, 8> pts;
-    std::vector<std::vector<IRL::UnsignedIndex_t>> face_brep(6);
-    face_brep[0] = std::vector<IRL::UnsignedIndex_t>({0, 3, 2, 1});
-    face_brep[1] = std::vector<IRL::UnsignedIndex_t>({4, 5, 6, 7});
-    face_brep[2] = std::vector<IRL::UnsignedIndex_t>({0, 4, 7, 3});
-    face_brep[3] = std::vector<IRL::UnsignedIndex_t>({1, 2, 6, 5});
-    face_brep[4] = std::vector<IRL::UnsignedIndex_t>({7, 6, 2, 3});
-    face_brep[5] = std::vector<IRL::UnsignedIndex_t>({4, 0, 1, 5});
-    IRL::PolyhedronConnectivity connectivity(face_brep);
-    for (int r = 1; r < a_radial_cells; ++r) {
-      for (int p = 0; p < a_phi_cells; ++p) {
-        for (int t = 0; t < a_theta_cells; ++t) {
-          pts[0] =
-              convertToCartesian(IRL::Pt(static_cast<double>(r) * d_radius,
-                                         (static_cast<double>(t)) * d_theta,
-                                         (static_cast<double>(p)) * d_phi));
-          pts[1] =
-              convertToCartesian(IRL::Pt(static_cast<double>(r) * d_radius,
-                                         (static_cast<double>(t + 1)) * d_theta,
-                                         (static_cast<double>(p)) * d_phi));
-          pts[2] =
-              convertToCartesian(IRL::Pt(static_cast<double>(r) * d_radius,
-                                         (static_cast<double>(t + 1)) * d_theta,
-                                         (static_cast<double>(p + 1)) * d_phi));
-          pts[3] =
-              convertToCartesian(IRL::Pt(static_cast<double>(r) * d_radius,
-                                         (static_cast<double>(t)) * d_theta,
-                                         (static_cast<double>(p + 1)) * d_phi));
-          pts[4] =
-              convertToCartesian(IRL::Pt(static_cast<double>(r + 1) * d_radius,
-                                         (static_cast<double>(t)) * d_theta,
-                                         (static_cast<double>(p)) * d_phi));
-          pts[5] =
-              convertToCartesian(IRL::Pt(static_cast<double>(r + 1) * d_radius,
-                                         (static_cast<double>(t + 1)) * d_theta,
-                                         (static_cast<double>(p)) * d_phi));
-          pts[6] =
-              convertToCartesian(IRL::Pt(static_cast<double>(r + 1) * d_radius,
-                                         (static_cast<double>(t + 1)) * d_theta,
-                                         (static_cast<double>(p + 1)) * d_phi));
-          pts[7] =
-              convertToCartesian(IRL::Pt(static_cast<double>(r + 1) * d_radius,
-                                         (static_cast<double>(t)) * d_theta,
-                                         (static_cast<double>(p + 1)) * d_phi));
-
-          const int index =
-              1 + t + p * a_theta_cells + (r - 1) * a_theta_cells * a_phi_cells;
-          IRL::GeneralPolyhedron poly(pts, &connectivity);
-          auto &half_edge = IRL::setHalfEdgeStructure(poly);
-          auto segmented = half_edge.generateSegmentedPolyhedron();
-          std::string filename =
-              "spherical_mesh_" + std::to_string(index) + ".vtu";
-          std::ofstream myfile;
-          myfile.open(filename);
-          myfile << segmented;
-          myfile.close();
-        }
-      }
-    }
-  }
+void irl_gvm_cubeOntoMeshEarlyExit(const double *a_cube_pts,
+                                   const LocalizerMesh &a_mesh,
+                                   const double a_expected_volume,
+                                   const double a_tolerance, double *a_volume,
+                                   double *a_times,
+                                   std::size_t *a_entered_cells,
+                                   std::size_t *a_skipped_links) {
+  const auto cube = IRL::RectangularCuboid::fromBoundingPts(
+      IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
+      IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
+  TraversalStats stats;
+  distributeOntoMeshBySplitting(
+      cube, getCubeCenter(a_cube_pts), a_mesh,
+      a_expected_volume * (1.0 - a_tolerance), a_volume, a_times,
+      a_entered_cells, a_skipped_links, &stats);
 }
 
-void irl_gvm_cubeOntoSphericalCartesianMesh(const double *a_cube_pts,
-                                         double *a_volume, double *a_times,
-                                         std::size_t *a_entered_cells) {
-  const double radius = 0.5 * std::sqrt(3.0 * 6.0 * 6.0);
-  static constexpr bool print_to_files = false;
-  static std::vector<IRL::PlanarLocalizer> localizers;
-  static std::vector<IRL::LocalizerLink> links;
-  static bool mesh_made = false;
-  if (!mesh_made) {
-    mesh_made = true;
-    setupSphericalCartesianMesh(radius, 4, &localizers, &links);
-  }
+void irl_gvm_stelIcosahedronOntoMeshEarlyExit(
+    const double *a_stel_icosahedron_pts, const LocalizerMesh &a_mesh,
+    const double a_expected_volume, const double a_tolerance, double *a_volume,
+    double *a_times, std::size_t *a_entered_cells,
+    std::size_t *a_skipped_links) {
+  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, a_stel_icosahedron_pts);
+  TraversalStats stats;
+  distributeOntoMeshBySplitting(
+      stel_icosahedron, getStelIcosahedronCenter(a_stel_icosahedron_pts),
+      a_mesh, a_expected_volume * (1.0 - a_tolerance), a_volume, a_times,
+      a_entered_cells, a_skipped_links, &stats);
+}
 
-  // This will return the volume from each cell, tagged with that cells unique
-  // Id set during setupCubicMesh
+void irl_gvm_cubeOntoMeshBruteForce(const double *a_cube_pts,
+                                    const LocalizerMesh &a_mesh,
+                                    double *a_volume, double *a_times,
+                                    std::size_t *a_clipped_cells) {
+  const auto cube = IRL::RectangularCuboid::fromBoundingPts(
+      IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
+      IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
+  distributeByClippingEveryCell(cube, a_mesh, a_volume, a_times,
+                                a_clipped_cells);
+}
+
+void irl_gvm_cubeOntoMeshFiltered(const double *a_cube_pts,
+                                  const LocalizerMesh &a_mesh,
+                                  const CellBoxTree &a_tree, double *a_volume,
+                                  double *a_times,
+                                  std::size_t *a_clipped_cells) {
   const auto cube = IRL::RectangularCuboid::fromBoundingPts(
       IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
       IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
+  distributeByClippingOverlappingCells(cube, getPointsBox(a_cube_pts, 2),
+                                       a_mesh, a_tree, a_volume, a_times,
+                                       a_clipped_cells);
+}
+
+void irl_gvm_stelIcosahedronOntoMeshBruteForce(
+    const double *a_stel_icosahedron_pts, const LocalizerMesh &a_mesh,
+    double *a_volume, double *a_times, std::size_t *a_clipped_cells) {
+  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, a_stel_icosahedron_pts);
+  distributeByClippingEveryCell(stel_icosahedron, a_mesh, a_volume, a_times,
+                                a_clipped_cells);
+}
+
+void irl_gvm_stelIcosahedronOntoMeshFiltered(
+    const double *a_stel_icosahedron_pts, const LocalizerMesh &a_mesh,
+    const CellBoxTree &a_tree, double *a_volume, double *a_times,
+    std::size_t *a_clipped_cells) {
+  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, a_stel_icosahedron_pts);
+  distributeByClippingOverlappingCells(
+      stel_icosahedron, getPointsBox(a_stel_icosahedron_pts, 32), a_mesh,
+      a_tree, a_volume, a_times, a_clipped_cells);
+}
+
+// Distributes a_number_of_polyhedra polyhedra onto a_mesh using
+// a_number_of_threads OpenMP threads, which only read the shared mesh.
+// a_make_polyhedron(n, &center) returns polyhedron n and sets the point
+// used to find its starting cell. Each thread accumulates the volume
+// tagged to each cell in its own buffer, and the buffers are summed into
+// a_cell_volumes at the end.
+template <class MakePolyhedronType>
+static void distributeManyOntoMesh(const MakePolyhedronType &a_make_polyhedron,
+                                   const int a_number_of_polyhedra,
+                                   const LocalizerMesh &a_mesh,
+                                   const int a_number_of_threads,
+                                   double *a_cell_volumes, double *a_times) {
+  const int number_of_cells = a_mesh.getNumberOfCells();
+
+  // Allocated (and first touched) by the thread that will use it
+  std::vector<std::vector<double>> thread_volumes(a_number_of_threads);
+#pragma omp parallel num_threads(a_number_of_threads)
+  { thread_volumes[omp_get_thread_num()].assign(number_of_cells, 0.0); }
 
   double start = omp_get_wtime();
-  auto tagged_volumes =
-      IRL::getVolumeMoments<IRL::TaggedAccumulatedVolumeMoments<IRL::Volume>>(
-          cube, links[0]);
+#pragma omp parallel num_threads(a_number_of_threads)
+  {
+    auto &cell_volumes = thread_volumes[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 64)
+    for (int n = 0; n < a_number_of_polyhedra; ++n) {
+      IRL::Pt center;
+      const auto polyhedron = a_make_polyhedron(n, &center);
+      const auto tagged_volumes = IRL::getVolumeMoments<
+          IRL::TaggedAccumulatedVolumeMoments<IRL::Volume>>(
+          polyhedron, a_mesh.getSeedLink(center));
+      for (const auto &volume : tagged_volumes) {
+        cell_volumes[volume.tag_m] += volume.volume_moments_m;
+      }
+    }
+  }
   double end = omp_get_wtime();
   a_times[0] = end - start;
 
-  // Return volume that is the sum of the distributed volume
-  *a_volume = 0.0;
-  for (const auto &volume : tagged_volumes) {
-    *a_volume += volume.volume_moments_m;
+  start = omp_get_wtime();
+#pragma omp parallel for num_threads(a_number_of_threads) schedule(static)
+  for (int c = 0; c < number_of_cells; ++c) {
+    double volume = 0.0;
+    for (const auto &cell_volumes : thread_volumes) {
+      volume += cell_volumes[c];
+    }
+    a_cell_volumes[c] = volume;
   }
-  *a_entered_cells = static_cast<std::size_t>(tagged_volumes.size());
+  end = omp_get_wtime();
+  a_times[1] = end - start;
 }
 
-void irl_gvm_stelIcosahedronOntoSphericalCartesianMesh(
-    const double *a_stel_icosahedron_pts, double *a_volume, double *a_times,
-    std::size_t *a_entered_cells) {
-  const double radius = 0.5 * std::sqrt(3.0 * 6.0 * 6.0);
-  static constexpr bool print_to_files = false;
-  static std::vector<IRL::PlanarLocalizer> localizers;
-  static std::vector<IRL::LocalizerLink> links;
-  static bool mesh_made = false;
-  if (!mesh_made) {
-    mesh_made = true;
-    setupSphericalCartesianMesh(radius, 4, &localizers, &links);
-  }
+void irl_gvm_cubesOntoMesh(const double *a_cube_pts,
+                           const int a_number_of_cubes,
+                           const LocalizerMesh &a_mesh,
+                           const int a_number_of_threads,
+                           double *a_cell_volumes, double *a_times) {
+  distributeManyOntoMesh(
+      [a_cube_pts](const int a_n, IRL::Pt *a_center) {
+        const double *pts = a_cube_pts + 6 * a_n;
+        *a_center = getCubeCenter(pts);
+        return IRL::RectangularCuboid::fromBoundingPts(
+            IRL::Pt(pts[0], pts[1], pts[2]), IRL::Pt(pts[3], pts[4], pts[5]));
+      },
+      a_number_of_cubes, a_mesh, a_number_of_threads, a_cell_volumes,
+      a_times);
+}
 
-  // This will return the volume from each cell, tagged with that cells unique
-  // Id set during setupCubicMesh
-  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
-      32, a_stel_icosahedron_pts);
+void irl_gvm_stelIcosahedraOntoMesh(const double *a_stel_icosahedron_pts,
+                                    const int a_number_of_stel_icosahedra,
+                                    const LocalizerMesh &a_mesh,
+                                    const int a_number_of_threads,
+                                    double *a_cell_volumes, double *a_times) {
+  distributeManyOntoMesh(
+      [a_stel_icosahedron_pts](const int a_n, IRL::Pt *a_center) {
+        const double *pts = a_stel_icosahedron_pts + 96 * a_n;
+        *a_center = getStelIcosahedronCenter(pts);
+        return IRL::StellatedIcosahedron::fromRawDoublePointer(32, pts);
+      },
+      a_number_of_stel_icosahedra, a_mesh, a_number_of_threads,
+      a_cell_volumes, a_times);
+}
+
+void irl_gvm_symHexFluxVolumesOntoMesh(const double *a_flux_pts,
+                                       const int a_number_of_faces,
+                                       const LocalizerMesh &a_mesh,
+                                       const int a_number_of_threads,
+                                       double *a_cell_moments, double *a_times,
+                                       double *a_max_volume_difference) {
+  const int number_of_cells = a_mesh.getNumberOfCells();
+  std::vector<IRL::TaggedAccumulatedVolumeMoments<IRL::VolumeMoments>>
+      face_moments(a_number_of_faces);
+  std::vector<std::vector<double>> thread_moments(a_number_of_threads);
+#pragma omp parallel num_threads(a_number_of_threads)
+  { thread_moments[omp_get_thread_num()].assign(4 * number_of_cells, 0.0); }
 
   double start = omp_get_wtime();
-  auto tagged_volumes =
-      IRL::getVolumeMoments<IRL::TaggedAccumulatedVolumeMoments<IRL::Volume>>(
-          stel_icosahedron, links[0]);
+#pragma omp parallel for num_threads(a_number_of_threads) \
+    schedule(dynamic, 64)
+  for (int f = 0; f < a_number_of_faces; ++f) {
+    const double *pts = a_flux_pts + 42 * f;
+    const auto flux_volume =
+        IRL::SymmetricHexahedron::fromRawDoublePointer(14, pts);
+    face_moments[f] = IRL::getVolumeMoments<
+        IRL::TaggedAccumulatedVolumeMoments<IRL::VolumeMoments>>(
+        flux_volume, a_mesh.getSeedLink(getSymHexCenter(pts)));
+  }
   double end = omp_get_wtime();
   a_times[0] = end - start;
 
-  // Return volume that is the sum of the distributed volume
-  *a_volume = 0.0;
-  for (const auto &volume : tagged_volumes) {
-    *a_volume += volume.volume_moments_m;
+  start = omp_get_wtime();
+#pragma omp parallel num_threads(a_number_of_threads)
+  {
+    auto &cell_moments = thread_moments[omp_get_thread_num()];
+#pragma omp for schedule(static)
+    for (int f = 0; f < a_number_of_faces; ++f) {
+      for (const auto &moments : face_moments[f]) {
+        double *cell = &cell_moments[4 * moments.tag_m];
+        cell[0] += moments.volume_moments_m.volume();
+        for (int d = 0; d < 3; ++d) {
+          cell[1 + d] += moments.volume_moments_m.centroid()[d];
+        }
+      }
+    }
   }
-  *a_entered_cells = static_cast<std::size_t>(tagged_volumes.size());
+#pragma omp parallel for num_threads(a_number_of_threads) schedule(static)
+  for (int n = 0; n < 4 * number_of_cells; ++n) {
+    double moment = 0.0;
+    for (const auto &cell_moments : thread_moments) {
+      moment += cell_moments[n];
+    }
+    a_cell_moments[n] = moment;
+  }
+  end = omp_get_wtime();
+  a_times[1] = end - start;
+
+  double max_volume_difference = 0.0;
+  for (int f = 0; f < a_number_of_faces; ++f) {
+    const auto flux_volume = IRL::SymmetricHexahedron::fromRawDoublePointer(
+        14, a_flux_pts + 42 * f);
+    double volume = 0.0;
+    for (const auto &moments : face_moments[f]) {
+      volume += moments.volume_moments_m.volume();
+    }
+    max_volume_difference =
+        std::max(max_volume_difference,
+                 std::fabs(volume - flux_volume.calculateVolume()));
+  }
+  *a_max_volume_difference = max_volume_difference;
 }
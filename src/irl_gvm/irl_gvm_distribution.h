@@ -18,32 +18,186 @@
 
 #include <cstddef>
 
-// Distribute a Cube onto a Cubic Mesh
-void irl_gvm_cubeOntoCubicMesh(const double *a_cube_pts, double *a_volume,
-                               double *a_times, std::size_t *a_entered_cells);
-
-// Distribute a Stellated Icosahedron onto a Cubic Mesh
-void irl_gvm_stelIcosahedronOntoCubicMesh(const double *a_stel_icosahedron_pts,
-                                          double *a_volume, double *a_times,
-                                          std::size_t *a_entered_cells);
-
-// Distribute a Cube onto a Tet Mesh
-void irl_gvm_cubeOntoTetMesh(const double *a_cube_pts, double *a_volume,
-                             double *a_times, std::size_t *a_entered_cells);
-
-// Distribute a Stellated Icosahedron onto a Tet Mesh
-void irl_gvm_stelIcosahedronOntoTetMesh(const double *a_cube_pts,
-                                        double *a_volume, double *a_times,
+#include "src/irl_gvm/cell_box_tree.h"
+#include "src/irl_gvm/localized_separator_mesh.h"
+#include "src/irl_gvm/localizer_mesh.h"
+#include "src/irl_gvm/traversal_stats.h"
+
+// Distribute a Cube onto a_mesh. Only the distribution is timed, in
+// a_times[0]; the time and memory used to set up the mesh are available
+// from the mesh itself. If a_locate_seed is true, distribution starts
+// from the cell holding the center of the cube, otherwise from the
+// fixed seed of the mesh.
+void irl_gvm_cubeOntoMesh(const double *a_cube_pts, const LocalizerMesh &a_mesh,
+                          const bool a_locate_seed, double *a_volume,
+                          double *a_times, std::size_t *a_entered_cells);
+
+// Distribute a Stellated Icosahedron onto a_mesh
+void irl_gvm_stelIcosahedronOntoMesh(const double *a_stel_icosahedron_pts,
+                                     const LocalizerMesh &a_mesh,
+                                     const bool a_locate_seed,
+                                     double *a_volume, double *a_times,
+                                     std::size_t *a_entered_cells);
+
+// Distribute a Cube onto a_mesh, starting from the cell holding its
+// center, and add the volume in each cell straight into a_cell_volumes
+// (one entry per mesh cell, indexed by the link Id). The summed volume is
+// still returned in a_volume. The scatter-add is part of the timing.
+void irl_gvm_cubeOntoMeshCells(const double *a_cube_pts,
+                               const LocalizerMesh &a_mesh,
+                               double *a_cell_volumes, double *a_volume,
+                               double *a_times,
+                               std::size_t *a_entered_cells);
+
+// Distribute a Stellated Icosahedron onto a_mesh, adding the volume in
+// each cell into a_cell_volumes as irl_gvm_cubeOntoMeshCells.
+void irl_gvm_stelIcosahedronOntoMeshCells(
+    const double *a_stel_icosahedron_pts, const LocalizerMesh &a_mesh,
+    double *a_cell_volumes, double *a_volume, double *a_times,
+    std::size_t *a_entered_cells);
+
+// Distribute a Cube onto a_mesh, starting from the cell holding its
+// center, and add the volume on each side of the interface in each cell
+// into a_cell_volumes (two entries per mesh cell: below the separator
+// planes, then above). The summed volume on each side is returned in
+// a_volumes[0] and a_volumes[1]. The scatter-add is part of the timing.
+void irl_gvm_cubeOntoSeparatedMeshCells(const double *a_cube_pts,
+                                        const LocalizedSeparatorMesh &a_mesh,
+                                        double *a_cell_volumes,
+                                        double *a_volumes, double *a_times,
                                         std::size_t *a_entered_cells);
 
-// Distribute a Cube onto a Spherical Cartesian Mesh
-void irl_gvm_cubeOntoSphericalCartesianMesh(const double *a_cube_pts,
-                                         double *a_volume, double *a_times,
-                                         std::size_t *a_entered_cells);
+// Distribute a Stellated Icosahedron onto a_mesh, adding the volume on
+// each side of the interface into a_cell_volumes as
+// irl_gvm_cubeOntoSeparatedMeshCells.
+void irl_gvm_stelIcosahedronOntoSeparatedMeshCells(
+    const double *a_stel_icosahedron_pts, const LocalizedSeparatorMesh &a_mesh,
+    double *a_cell_volumes, double *a_volumes, double *a_times,
+    std::size_t *a_entered_cells);
+
+// Distribute one Symmetric Hexahedron flux volume of 14 points, stored as
+// in irl_gvm_symHexFluxVolumesOntoMesh, onto a_mesh, adding the volume in
+// each cell into a_cell_volumes as irl_gvm_cubeOntoMeshCells.
+void irl_gvm_symHexOntoMeshCells(const double *a_flux_pts,
+                                 const LocalizerMesh &a_mesh,
+                                 double *a_cell_volumes, double *a_volume,
+                                 double *a_times,
+                                 std::size_t *a_entered_cells);
 
-// Distribute a Stellated Icosahedron onto a Spherical Cartesian Mesh
-void irl_gvm_stelIcosahedronOntoSphericalCartesianMesh(
-    const double *a_cube_pts, double *a_volume, double *a_times,
+// Distribute one Symmetric Hexahedron flux volume onto a_mesh, adding the
+// volume on each side of the interface into a_cell_volumes as
+// irl_gvm_cubeOntoSeparatedMeshCells.
+void irl_gvm_symHexOntoSeparatedMeshCells(
+    const double *a_flux_pts, const LocalizedSeparatorMesh &a_mesh,
+    double *a_cell_volumes, double *a_volumes, double *a_times,
     std::size_t *a_entered_cells);
 
+// Baselines without the mesh graph. The BruteForce functions clip the
+// Cube against the PlanarLocalizer of every cell of a_mesh, and the
+// Filtered functions only against the cells a_tree finds overlapping the
+// bounding box of the Cube. Cells are clipped in parallel with all OpenMP
+// threads. a_clipped_cells is the number of cells clipped, and the
+// whole distribution, including the tree query, is timed in a_times[0].
+void irl_gvm_cubeOntoMeshBruteForce(const double *a_cube_pts,
+                                    const LocalizerMesh &a_mesh,
+                                    double *a_volume, double *a_times,
+                                    std::size_t *a_clipped_cells);
+
+void irl_gvm_cubeOntoMeshFiltered(const double *a_cube_pts,
+                                  const LocalizerMesh &a_mesh,
+                                  const CellBoxTree &a_tree, double *a_volume,
+                                  double *a_times,
+                                  std::size_t *a_clipped_cells);
+
+// Same baselines for a Stellated Icosahedron
+void irl_gvm_stelIcosahedronOntoMeshBruteForce(
+    const double *a_stel_icosahedron_pts, const LocalizerMesh &a_mesh,
+    double *a_volume, double *a_times, std::size_t *a_clipped_cells);
+
+void irl_gvm_stelIcosahedronOntoMeshFiltered(
+    const double *a_stel_icosahedron_pts, const LocalizerMesh &a_mesh,
+    const CellBoxTree &a_tree, double *a_volume, double *a_times,
+    std::size_t *a_clipped_cells);
+
+// Instrumented distribution of a Cube onto a_mesh, starting from the cell
+// holding its center. IRL walks the LocalizerLink graph inside
+// getVolumeMoments, where it cannot be counted, so this follows the same
+// walk here with IRL's half-edge splitting: the piece of the polyhedron in
+// a link is split by each of its planes, the part outside a plane is
+// pushed onto a stack with the link across it (or dropped on the mesh
+// boundary), and what is left is the volume of that link. a_stats is
+// filled when kCollectTraversalStats is true and left untouched
+// otherwise. a_entered_cells counts distinct cells given a nonzero volume.
+void irl_gvm_cubeOntoMeshInstrumented(const double *a_cube_pts,
+                                      const LocalizerMesh &a_mesh,
+                                      double *a_volume, double *a_times,
+                                      std::size_t *a_entered_cells,
+                                      TraversalStats *a_stats);
+
+// Instrumented distribution of a Stellated Icosahedron onto a_mesh
+void irl_gvm_stelIcosahedronOntoMeshInstrumented(
+    const double *a_stel_icosahedron_pts, const LocalizerMesh &a_mesh,
+    double *a_volume, double *a_times, std::size_t *a_entered_cells,
+    TraversalStats *a_stats);
+
+// Distribute a Cube onto a_mesh as irl_gvm_cubeOntoMeshInstrumented, but
+// stop walking the mesh once the volume found is within a_tolerance,
+// relative to a_expected_volume, of the known volume of the Cube. The
+// pieces of the Cube still waiting to be split into their links at that
+// point are skipped and counted in a_skipped_links.
+void irl_gvm_cubeOntoMeshEarlyExit(const double *a_cube_pts,
+                                   const LocalizerMesh &a_mesh,
+                                   const double a_expected_volume,
+                                   const double a_tolerance, double *a_volume,
+                                   double *a_times,
+                                   std::size_t *a_entered_cells,
+                                   std::size_t *a_skipped_links);
+
+// Distribute a Stellated Icosahedron onto a_mesh, stopping once the
+// volume found is within a_tolerance of a_expected_volume
+void irl_gvm_stelIcosahedronOntoMeshEarlyExit(
+    const double *a_stel_icosahedron_pts, const LocalizerMesh &a_mesh,
+    const double a_expected_volume, const double a_tolerance, double *a_volume,
+    double *a_times, std::size_t *a_entered_cells,
+    std::size_t *a_skipped_links);
+
+// Distribute a_number_of_cubes Cubes, stored contiguously as in
+// irl_gvm_cubeOntoMesh, onto a_mesh using a_number_of_threads OpenMP
+// threads. Each thread accumulates into its own per-cell buffer, and these
+// are summed into a_cell_volumes (one entry per mesh cell). a_times[0] is
+// the distribution time, a_times[1] the reduction.
+void irl_gvm_cubesOntoMesh(const double *a_cube_pts,
+                           const int a_number_of_cubes,
+                           const LocalizerMesh &a_mesh,
+                           const int a_number_of_threads,
+                           double *a_cell_volumes, double *a_times);
+
+// Distribute many Stellated Icosahedra onto a_mesh in parallel,
+// as irl_gvm_cubesOntoMesh.
+void irl_gvm_stelIcosahedraOntoMesh(const double *a_stel_icosahedron_pts,
+                                    const int a_number_of_stel_icosahedra,
+                                    const LocalizerMesh &a_mesh,
+                                    const int a_number_of_threads,
+                                    double *a_cell_volumes, double *a_times);
+
+// Distribute the semi-Lagrangian flux volumes of a_number_of_faces mesh
+// faces onto a_mesh using a_number_of_threads OpenMP threads. Each flux
+// volume is a Symmetric Hexahedron of 14 points stored contiguously in
+// a_flux_pts (42 values per face), with the cell face as points 0-3, the
+// back-traced face as points 4-7, and the face centroids as points 8-13.
+// Volumes swept in the negative direction of the face normal come out
+// negative. The volume moments of every face are kept, tagged per cell,
+// then added into a_cell_moments (volume and first moments X/Y/Z, four
+// entries per cell) through per-thread buffers. a_times[0] is the
+// distribution time and a_times[1] the accumulation. The largest
+// difference between the volume distributed for a face and the volume of
+// its flux volume is returned in a_max_volume_difference, found after
+// timing.
+void irl_gvm_symHexFluxVolumesOntoMesh(const double *a_flux_pts,
+                                       const int a_number_of_faces,
+                                       const LocalizerMesh &a_mesh,
+                                       const int a_number_of_threads,
+                                       double *a_cell_moments, double *a_times,
+                                       double *a_max_volume_difference);
+
 #endif // SRC_IRL_GVM_IRL_GVM_DISTRIBUTION_H_
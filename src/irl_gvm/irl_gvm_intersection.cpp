@@ -26,6 +26,7 @@
 #include "src/geometry/polyhedrons/symmetric_decompositions/symmetric_triangular_prism.h"
 #include "src/geometry/polyhedrons/triangular_prism.h"
 #include "src/helpers/mymath.h"
+#include "src/interface_reconstruction_methods/volume_fraction_matching.h"
 #include "src/parameters/defined_types.h"
 
 #include "src/geometry/polyhedrons/general_polyhedron.h"
@@ -35,6 +36,85 @@
 // If true, will print out each object  to .vtu files
 static bool constexpr PRINT_OBJECTS = false;
 
+// Splits a_polyhedron by each plane in turn with IRL's half-edge
+// splitting, which returns both sides of a plane at once. The part above
+// each plane is added to a_volumes[1], and the part below goes on to the
+// next plane, ending as a_volumes[0].
+template <class PolyhedronType>
+static void splitByPlanes(const PolyhedronType &a_polyhedron,
+                          const int a_number_of_planes,
+                          const double *a_planes, double *a_volumes,
+                          double *a_times) {
+  double start = omp_get_wtime();
+  auto &half_edge = IRL::setHalfEdgeStructure(a_polyhedron);
+  auto below = half_edge.generateSegmentedPolyhedron();
+  using SegmentedType = decltype(below);
+  a_volumes[1] = 0.0;
+  for (int n = 0; n < a_number_of_planes; ++n) {
+    const IRL::Plane plane(IRL::Normal(a_planes[n * 4 + 0],
+                                       a_planes[n * 4 + 1],
+                                       a_planes[n * 4 + 2]),
+                           a_planes[n * 4 + 3]);
+    SegmentedType above;
+    IRL::splitHalfEdgePolytope(&below, &above, &half_edge, plane);
+    if (above.getNumberOfFaces() > 0) {
+      a_volumes[1] += above.calculateVolume();
+    }
+    if (below.getNumberOfFaces() == 0) {
+      break;
+    }
+  }
+  a_volumes[0] = below.getNumberOfFaces() > 0 ? below.calculateVolume() : 0.0;
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+}
+
+// Finds the distance of the plane with normal a_normal leaving
+// a_volume_fraction of a_polyhedron below it, then cuts a_polyhedron once
+// by that plane to get the volume fraction achieved.
+template <class PolyhedronType>
+static void matchVolumeFraction(const PolyhedronType &a_polyhedron,
+                                const double *a_normal,
+                                const double a_volume_fraction,
+                                double *a_distance,
+                                double *a_achieved_volume_fraction,
+                                double *a_times) {
+  auto separator = IRL::PlanarSeparator::fromOnePlane(IRL::Plane(
+      IRL::Normal(a_normal[0], a_normal[1], a_normal[2]), 0.0));
+  double start = omp_get_wtime();
+  IRL::setDistanceToMatchVolumeFraction(a_polyhedron, a_volume_fraction,
+                                        &separator);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  *a_distance = separator[0].distance();
+
+  start = omp_get_wtime();
+  const double volume = IRL::getVolumeMoments<IRL::Volume>(a_polyhedron,
+                                                           separator);
+  end = omp_get_wtime();
+  a_times[1] = end - start;
+  *a_achieved_volume_fraction = volume / a_polyhedron.calculateVolume();
+}
+
+// Constructs a_polyhedron once, then finds the volume below each of the
+// planes with normal a_normal at the distances a_distances.
+template <class PolyhedronType>
+static void sweepByPlanes(const PolyhedronType &a_polyhedron,
+                          const double *a_normal,
+                          const int a_number_of_distances,
+                          const double *a_distances, double *a_volumes,
+                          double *a_times) {
+  const IRL::Normal normal(a_normal[0], a_normal[1], a_normal[2]);
+  double start = omp_get_wtime();
+  for (int n = 0; n < a_number_of_distances; ++n) {
+    a_volumes[n] = IRL::getVolumeMoments<IRL::Volume>(
+        a_polyhedron, IRL::PlanarSeparator::fromOnePlane(
+                          IRL::Plane(normal, a_distances[n])));
+  }
+  double end = omp_get_wtime();
+  a_times[1] = end - start;
+}
+
 void irl_gvm_prismByPlanes(const double *a_prism_pts,
                            const int a_number_of_planes, const double *a_planes,
                            double *a_volume, double *a_times) {
@@ -300,3 +380,285 @@ void irl_gvm_stelIcosahedronByPlanes(const double *a_stel_icosahedron_pts,
   a_times[0] = end - start;
   return;
 }
+
+void irl_gvm_prismBySplit(const double *a_prism_pts,
+                          const int a_number_of_planes,
+                          const double *a_planes, double *a_volumes,
+                          double *a_times) {
+  const auto polyhedron =
+      IRL::TriangularPrism::fromRawDoublePointer(6, a_prism_pts);
+  splitByPlanes(polyhedron, a_number_of_planes, a_planes, a_volumes,
+                a_times);
+}
+
+void irl_gvm_unitCubeBySplit(const double *a_cube_pts,
+                             const int a_number_of_planes,
+                             const double *a_planes, double *a_volumes,
+                             double *a_times) {
+  const auto cube = IRL::RectangularCuboid::fromBoundingPts(
+      IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
+      IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
+  splitByPlanes(cube, a_number_of_planes, a_planes, a_volumes, a_times);
+}
+
+void irl_gvm_triPrismBySplit(const double *a_tri_prism_pts,
+                             const int a_number_of_planes,
+                             const double *a_planes, double *a_volumes,
+                             double *a_times) {
+  const auto polyhedron =
+      IRL::Octahedron::fromRawDoublePointer(6, a_tri_prism_pts);
+  splitByPlanes(polyhedron, a_number_of_planes, a_planes, a_volumes,
+                a_times);
+}
+
+void irl_gvm_triHexBySplit(const double *a_tri_hex_pts,
+                           const int a_number_of_planes,
+                           const double *a_planes, double *a_volumes,
+                           double *a_times) {
+  const auto polyhedron =
+      IRL::Dodecahedron::fromRawDoublePointer(8, a_tri_hex_pts);
+  splitByPlanes(polyhedron, a_number_of_planes, a_planes, a_volumes,
+                a_times);
+}
+
+void irl_gvm_symPrismBySplit(const double *a_sym_prism_pts,
+                             const int a_number_of_planes,
+                             const double *a_planes, double *a_volumes,
+                             double *a_times) {
+  const auto polyhedron =
+      IRL::SymmetricTriangularPrism::fromRawDoublePointer(11, a_sym_prism_pts);
+  splitByPlanes(polyhedron, a_number_of_planes, a_planes, a_volumes,
+                a_times);
+}
+
+void irl_gvm_symHexBySplit(const double *a_sym_hex_pts,
+                           const int a_number_of_planes,
+                           const double *a_planes, double *a_volumes,
+                           double *a_times) {
+  const auto polyhedron =
+      IRL::SymmetricHexahedron::fromRawDoublePointer(14, a_sym_hex_pts);
+  splitByPlanes(polyhedron, a_number_of_planes, a_planes, a_volumes,
+                a_times);
+}
+
+void irl_gvm_stelDodecahedronBySplit(const double *a_stel_dodecahedron_pts,
+                                     const int a_number_of_planes,
+                                     const double *a_planes, double *a_volumes,
+                                     double *a_times) {
+  const auto polyhedron = IRL::StellatedDodecahedron::fromRawDoublePointer(
+      32, a_stel_dodecahedron_pts);
+  splitByPlanes(polyhedron, a_number_of_planes, a_planes, a_volumes,
+                a_times);
+}
+
+void irl_gvm_stelIcosahedronBySplit(const double *a_stel_icosahedron_pts,
+                                    const int a_number_of_planes,
+                                    const double *a_planes, double *a_volumes,
+                                    double *a_times) {
+  const auto polyhedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, a_stel_icosahedron_pts);
+  splitByPlanes(polyhedron, a_number_of_planes, a_planes, a_volumes,
+                a_times);
+}
+
+void irl_gvm_prismMatchVolumeFraction(const double *a_prism_pts,
+                                      const double *a_normal,
+                                      const double a_volume_fraction,
+                                      double *a_distance,
+                                      double *a_achieved_volume_fraction,
+                                      double *a_times) {
+  const auto polyhedron =
+      IRL::TriangularPrism::fromRawDoublePointer(6, a_prism_pts);
+  matchVolumeFraction(polyhedron, a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void irl_gvm_unitCubeMatchVolumeFraction(const double *a_cube_pts,
+                                         const double *a_normal,
+                                         const double a_volume_fraction,
+                                         double *a_distance,
+                                         double *a_achieved_volume_fraction,
+                                         double *a_times) {
+  const auto polyhedron = IRL::RectangularCuboid::fromBoundingPts(
+      IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
+      IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
+  matchVolumeFraction(polyhedron, a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void irl_gvm_triPrismMatchVolumeFraction(const double *a_tri_prism_pts,
+                                         const double *a_normal,
+                                         const double a_volume_fraction,
+                                         double *a_distance,
+                                         double *a_achieved_volume_fraction,
+                                         double *a_times) {
+  const auto polyhedron =
+      IRL::Octahedron::fromRawDoublePointer(6, a_tri_prism_pts);
+  matchVolumeFraction(polyhedron, a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void irl_gvm_triHexMatchVolumeFraction(const double *a_tri_hex_pts,
+                                       const double *a_normal,
+                                       const double a_volume_fraction,
+                                       double *a_distance,
+                                       double *a_achieved_volume_fraction,
+                                       double *a_times) {
+  const auto polyhedron =
+      IRL::Dodecahedron::fromRawDoublePointer(8, a_tri_hex_pts);
+  matchVolumeFraction(polyhedron, a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void irl_gvm_symPrismMatchVolumeFraction(const double *a_sym_prism_pts,
+                                         const double *a_normal,
+                                         const double a_volume_fraction,
+                                         double *a_distance,
+                                         double *a_achieved_volume_fraction,
+                                         double *a_times) {
+  const auto polyhedron =
+      IRL::SymmetricTriangularPrism::fromRawDoublePointer(11, a_sym_prism_pts);
+  matchVolumeFraction(polyhedron, a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void irl_gvm_symHexMatchVolumeFraction(const double *a_sym_hex_pts,
+                                       const double *a_normal,
+                                       const double a_volume_fraction,
+                                       double *a_distance,
+                                       double *a_achieved_volume_fraction,
+                                       double *a_times) {
+  const auto polyhedron =
+      IRL::SymmetricHexahedron::fromRawDoublePointer(14, a_sym_hex_pts);
+  matchVolumeFraction(polyhedron, a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void irl_gvm_stelDodecahedronMatchVolumeFraction(
+    const double *a_stel_dodecahedron_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times) {
+  const auto polyhedron = IRL::StellatedDodecahedron::fromRawDoublePointer(
+      32, a_stel_dodecahedron_pts);
+  matchVolumeFraction(polyhedron, a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void irl_gvm_stelIcosahedronMatchVolumeFraction(
+    const double *a_stel_icosahedron_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times) {
+  const auto polyhedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, a_stel_icosahedron_pts);
+  matchVolumeFraction(polyhedron, a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void irl_gvm_prismBySweep(const double *a_prism_pts, const double *a_normal,
+                          const int a_number_of_distances,
+                          const double *a_distances, double *a_volumes,
+                          double *a_times) {
+  double start = omp_get_wtime();
+  const auto polyhedron =
+      IRL::TriangularPrism::fromRawDoublePointer(6, a_prism_pts);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  sweepByPlanes(polyhedron, a_normal, a_number_of_distances, a_distances,
+                a_volumes, a_times);
+}
+
+void irl_gvm_unitCubeBySweep(const double *a_cube_pts, const double *a_normal,
+                             const int a_number_of_distances,
+                             const double *a_distances, double *a_volumes,
+                             double *a_times) {
+  double start = omp_get_wtime();
+  const auto polyhedron = IRL::RectangularCuboid::fromBoundingPts(
+      IRL::Pt(a_cube_pts[0], a_cube_pts[1], a_cube_pts[2]),
+      IRL::Pt(a_cube_pts[3], a_cube_pts[4], a_cube_pts[5]));
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  sweepByPlanes(polyhedron, a_normal, a_number_of_distances, a_distances,
+                a_volumes, a_times);
+}
+
+void irl_gvm_triPrismBySweep(const double *a_tri_prism_pts,
+                             const double *a_normal,
+                             const int a_number_of_distances,
+                             const double *a_distances, double *a_volumes,
+                             double *a_times) {
+  double start = omp_get_wtime();
+  const auto polyhedron =
+      IRL::Octahedron::fromRawDoublePointer(6, a_tri_prism_pts);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  sweepByPlanes(polyhedron, a_normal, a_number_of_distances, a_distances,
+                a_volumes, a_times);
+}
+
+void irl_gvm_triHexBySweep(const double *a_tri_hex_pts, const double *a_normal,
+                           const int a_number_of_distances,
+                           const double *a_distances, double *a_volumes,
+                           double *a_times) {
+  double start = omp_get_wtime();
+  const auto polyhedron =
+      IRL::Dodecahedron::fromRawDoublePointer(8, a_tri_hex_pts);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  sweepByPlanes(polyhedron, a_normal, a_number_of_distances, a_distances,
+                a_volumes, a_times);
+}
+
+void irl_gvm_symPrismBySweep(const double *a_sym_prism_pts,
+                             const double *a_normal,
+                             const int a_number_of_distances,
+                             const double *a_distances, double *a_volumes,
+                             double *a_times) {
+  double start = omp_get_wtime();
+  const auto polyhedron =
+      IRL::SymmetricTriangularPrism::fromRawDoublePointer(11, a_sym_prism_pts);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  sweepByPlanes(polyhedron, a_normal, a_number_of_distances, a_distances,
+                a_volumes, a_times);
+}
+
+void irl_gvm_symHexBySweep(const double *a_sym_hex_pts, const double *a_normal,
+                           const int a_number_of_distances,
+                           const double *a_distances, double *a_volumes,
+                           double *a_times) {
+  double start = omp_get_wtime();
+  const auto polyhedron =
+      IRL::SymmetricHexahedron::fromRawDoublePointer(14, a_sym_hex_pts);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  sweepByPlanes(polyhedron, a_normal, a_number_of_distances, a_distances,
+                a_volumes, a_times);
+}
+
+void irl_gvm_stelDodecahedronBySweep(const double *a_stel_dodecahedron_pts,
+                                     const double *a_normal,
+                                     const int a_number_of_distances,
+                                     const double *a_distances,
+                                     double *a_volumes, double *a_times) {
+  double start = omp_get_wtime();
+  const auto polyhedron = IRL::StellatedDodecahedron::fromRawDoublePointer(
+      32, a_stel_dodecahedron_pts);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  sweepByPlanes(polyhedron, a_normal, a_number_of_distances, a_distances,
+                a_volumes, a_times);
+}
+
+void irl_gvm_stelIcosahedronBySweep(const double *a_stel_icosahedron_pts,
+                                    const double *a_normal,
+                                    const int a_number_of_distances,
+                                    const double *a_distances,
+                                    double *a_volumes, double *a_times) {
+  double start = omp_get_wtime();
+  const auto polyhedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, a_stel_icosahedron_pts);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  sweepByPlanes(polyhedron, a_normal, a_number_of_distances, a_distances,
+                a_volumes, a_times);
+}
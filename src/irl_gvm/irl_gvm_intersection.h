@@ -68,4 +68,179 @@ void irl_gvm_stelIcosahedronByPlanes(const double *a_stel_icosahedron_pts,
                                      const double *a_planes, double *a_volume,
                                      double *a_times);
 
+// Split functions. The polyhedron is split by each plane in turn with
+// IRL's half-edge splitting, which keeps both sides of the plane, so a
+// single pass returns the volume below every plane in a_volumes[0] and
+// the rest of the polyhedron in a_volumes[1]. Only the total is timed, in
+// a_times[0].
+// Split a Triangular Prism by plane(s)
+void irl_gvm_prismBySplit(const double *a_prism_pts,
+                          const int a_number_of_planes,
+                          const double *a_planes, double *a_volumes,
+                          double *a_times);
+
+// Split a Unit Cube by plane(s)
+void irl_gvm_unitCubeBySplit(const double *a_cube_pts,
+                             const int a_number_of_planes,
+                             const double *a_planes, double *a_volumes,
+                             double *a_times);
+
+// Split a Triangulated Triangular Prism by plane(s)
+void irl_gvm_triPrismBySplit(const double *a_tri_prism_pts,
+                             const int a_number_of_planes,
+                             const double *a_planes, double *a_volumes,
+                             double *a_times);
+
+// Split a Triangulated Hexahedron by plane(s)
+void irl_gvm_triHexBySplit(const double *a_tri_hex_pts,
+                           const int a_number_of_planes,
+                           const double *a_planes, double *a_volumes,
+                           double *a_times);
+
+// Split a Symmetric Triangular Prism by plane(s)
+void irl_gvm_symPrismBySplit(const double *a_sym_prism_pts,
+                             const int a_number_of_planes,
+                             const double *a_planes, double *a_volumes,
+                             double *a_times);
+
+// Split a Symmetric Hexahedron by plane(s)
+void irl_gvm_symHexBySplit(const double *a_sym_hex_pts,
+                           const int a_number_of_planes,
+                           const double *a_planes, double *a_volumes,
+                           double *a_times);
+
+// Split a Stellated Dodecahedron by plane(s)
+void irl_gvm_stelDodecahedronBySplit(const double *a_stel_dodecahedron_pts,
+                                     const int a_number_of_planes,
+                                     const double *a_planes, double *a_volumes,
+                                     double *a_times);
+
+// Split a Stellated Icosahedron by plane(s)
+void irl_gvm_stelIcosahedronBySplit(const double *a_stel_icosahedron_pts,
+                                    const int a_number_of_planes,
+                                    const double *a_planes, double *a_volumes,
+                                    double *a_times);
+
+// Volume fraction matching functions. The distance of the plane with
+// normal a_normal leaving a_volume_fraction of the polyhedron below it is
+// found with IRL's setDistanceToMatchVolumeFraction and returned in
+// a_distance, with only the search timed, in a_times[0]. The polyhedron
+// is then cut once by that plane, timed in a_times[1], and the volume
+// fraction below it returned in a_achieved_volume_fraction.
+// Match a volume fraction in a Triangular Prism
+void irl_gvm_prismMatchVolumeFraction(const double *a_prism_pts,
+                                      const double *a_normal,
+                                      const double a_volume_fraction,
+                                      double *a_distance,
+                                      double *a_achieved_volume_fraction,
+                                      double *a_times);
+
+// Match a volume fraction in a Unit Cube
+void irl_gvm_unitCubeMatchVolumeFraction(const double *a_cube_pts,
+                                         const double *a_normal,
+                                         const double a_volume_fraction,
+                                         double *a_distance,
+                                         double *a_achieved_volume_fraction,
+                                         double *a_times);
+
+// Match a volume fraction in a Triangulated Triangular Prism
+void irl_gvm_triPrismMatchVolumeFraction(const double *a_tri_prism_pts,
+                                         const double *a_normal,
+                                         const double a_volume_fraction,
+                                         double *a_distance,
+                                         double *a_achieved_volume_fraction,
+                                         double *a_times);
+
+// Match a volume fraction in a Triangulated Hexahedron
+void irl_gvm_triHexMatchVolumeFraction(const double *a_tri_hex_pts,
+                                       const double *a_normal,
+                                       const double a_volume_fraction,
+                                       double *a_distance,
+                                       double *a_achieved_volume_fraction,
+                                       double *a_times);
+
+// Match a volume fraction in a Symmetric Triangular Prism
+void irl_gvm_symPrismMatchVolumeFraction(const double *a_sym_prism_pts,
+                                         const double *a_normal,
+                                         const double a_volume_fraction,
+                                         double *a_distance,
+                                         double *a_achieved_volume_fraction,
+                                         double *a_times);
+
+// Match a volume fraction in a Symmetric Hexahedron
+void irl_gvm_symHexMatchVolumeFraction(const double *a_sym_hex_pts,
+                                       const double *a_normal,
+                                       const double a_volume_fraction,
+                                       double *a_distance,
+                                       double *a_achieved_volume_fraction,
+                                       double *a_times);
+
+// Match a volume fraction in a Stellated Dodecahedron
+void irl_gvm_stelDodecahedronMatchVolumeFraction(
+    const double *a_stel_dodecahedron_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times);
+
+// Match a volume fraction in a Stellated Icosahedron
+void irl_gvm_stelIcosahedronMatchVolumeFraction(
+    const double *a_stel_icosahedron_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times);
+
+// Sweep functions. The polyhedron is constructed once, timed in
+// a_times[0], and then cut by the a_number_of_distances planes
+// a_normal.x = a_distances[n], each cut returning the volume below its
+// plane in a_volumes[n]. All cuts together are timed in a_times[1].
+// Sweep a plane through a Triangular Prism
+void irl_gvm_prismBySweep(const double *a_prism_pts, const double *a_normal,
+                          const int a_number_of_distances,
+                          const double *a_distances, double *a_volumes,
+                          double *a_times);
+
+// Sweep a plane through a Unit Cube
+void irl_gvm_unitCubeBySweep(const double *a_cube_pts, const double *a_normal,
+                             const int a_number_of_distances,
+                             const double *a_distances, double *a_volumes,
+                             double *a_times);
+
+// Sweep a plane through a Triangulated Triangular Prism
+void irl_gvm_triPrismBySweep(const double *a_tri_prism_pts,
+                             const double *a_normal,
+                             const int a_number_of_distances,
+                             const double *a_distances, double *a_volumes,
+                             double *a_times);
+
+// Sweep a plane through a Triangulated Hexahedron
+void irl_gvm_triHexBySweep(const double *a_tri_hex_pts, const double *a_normal,
+                           const int a_number_of_distances,
+                           const double *a_distances, double *a_volumes,
+                           double *a_times);
+
+// Sweep a plane through a Symmetric Triangular Prism
+void irl_gvm_symPrismBySweep(const double *a_sym_prism_pts,
+                             const double *a_normal,
+                             const int a_number_of_distances,
+                             const double *a_distances, double *a_volumes,
+                             double *a_times);
+
+// Sweep a plane through a Symmetric Hexahedron
+void irl_gvm_symHexBySweep(const double *a_sym_hex_pts, const double *a_normal,
+                           const int a_number_of_distances,
+                           const double *a_distances, double *a_volumes,
+                           double *a_times);
+
+// Sweep a plane through a Stellated Dodecahedron
+void irl_gvm_stelDodecahedronBySweep(const double *a_stel_dodecahedron_pts,
+                                     const double *a_normal,
+                                     const int a_number_of_distances,
+                                     const double *a_distances,
+                                     double *a_volumes, double *a_times);
+
+// Sweep a plane through a Stellated Icosahedron
+void irl_gvm_stelIcosahedronBySweep(const double *a_stel_icosahedron_pts,
+                                    const double *a_normal,
+                                    const int a_number_of_distances,
+                                    const double *a_distances,
+                                    double *a_volumes, double *a_times);
+
 #endif // SRC_IRL_GVM_IRL_GVM_INTERSECTION_H_
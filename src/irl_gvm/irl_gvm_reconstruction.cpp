@@ -0,0 +1,194 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/irl_gvm/irl_gvm_reconstruction.h"
+
+#include <omp.h>
+
+#include <array>
+
+// IRL source directory
+#include "src/generic_cutting/generic_cutting.h"
+#include "src/geometry/general/normal.h"
+#include "src/geometry/general/plane.h"
+#include "src/geometry/general/pt.h"
+#include "src/geometry/polyhedrons/rectangular_cuboid.h"
+#include "src/interface_reconstruction_methods/elvira_neighborhood.h"
+#include "src/interface_reconstruction_methods/lvira_neighborhood.h"
+#include "src/interface_reconstruction_methods/reconstruction_interface.h"
+#include "src/moments/separated_volume_moments.h"
+#include "src/moments/volume_moments.h"
+#include "src/planar_reconstruction/planar_separator.h"
+
+// Returns the cell with index a_cell of the Cartesian mesh
+static IRL::RectangularCuboid getCell(const int a_ncells,
+                                      const double *a_lower,
+                                      const double a_cell_size,
+                                      const int a_cell) {
+  const int i = a_cell % a_ncells;
+  const int j = (a_cell / a_ncells) % a_ncells;
+  const int k = a_cell / (a_ncells * a_ncells);
+  const IRL::Pt lower(a_lower[0] + static_cast<double>(i) * a_cell_size,
+                      a_lower[1] + static_cast<double>(j) * a_cell_size,
+                      a_lower[2] + static_cast<double>(k) * a_cell_size);
+  return IRL::RectangularCuboid::fromBoundingPts(
+      lower, IRL::Pt(lower[0] + a_cell_size, lower[1] + a_cell_size,
+                     lower[2] + a_cell_size));
+}
+
+// Fills a_cells with the 3x3x3 stencil of cells around a_cell, with i
+// varying fastest, and returns the mesh index of the first one.
+static int getStencil(const int a_ncells, const double *a_lower,
+                      const double a_cell_size, const int a_cell,
+                      std::array<IRL::RectangularCuboid, 27> *a_cells) {
+  const int first = a_cell - 1 - a_ncells - a_ncells * a_ncells;
+  int local = 0;
+  for (int k = 0; k < 3; ++k) {
+    for (int j = 0; j < 3; ++j) {
+      for (int i = 0; i < 3; ++i) {
+        (*a_cells)[local] =
+            getCell(a_ncells, a_lower, a_cell_size,
+                    first + i + a_ncells * (j + a_ncells * k));
+        ++local;
+      }
+    }
+  }
+  return first;
+}
+
+// Returns the plane stored in a_plane as a single plane PlanarSeparator
+static IRL::PlanarSeparator toSeparator(const double *a_plane) {
+  return IRL::PlanarSeparator::fromOnePlane(IRL::Plane(
+      IRL::Normal(a_plane[0], a_plane[1], a_plane[2]), a_plane[3]));
+}
+
+// Reconstructs every listed cell with a_reconstruct, which returns the
+// PlanarSeparator for the listed cell of the index given, and stores the
+// first plane of each in a_planes.
+template <class ReconstructionFunctor>
+static void reconstructCells(const int a_number_of_interface_cells,
+                             const int a_number_of_threads,
+                             const ReconstructionFunctor &a_reconstruct,
+                             double *a_planes, double *a_times) {
+  const double start = omp_get_wtime();
+#pragma omp parallel for num_threads(a_number_of_threads) schedule(dynamic, 16)
+  for (int n = 0; n < a_number_of_interface_cells; ++n) {
+    const IRL::PlanarSeparator reconstruction = a_reconstruct(n);
+    const IRL::Plane &plane = reconstruction[0];
+    a_planes[4 * n] = plane.normal()[0];
+    a_planes[4 * n + 1] = plane.normal()[1];
+    a_planes[4 * n + 2] = plane.normal()[2];
+    a_planes[4 * n + 3] = plane.distance();
+  }
+  const double end = omp_get_wtime();
+  a_times[0] = end - start;
+}
+
+void irl_gvm_elviraReconstructions(
+    const int a_ncells, const double *a_lower, const double a_cell_size,
+    const double *a_volume_fractions, const double *,
+    const int a_number_of_interface_cells, const int *a_interface_cells,
+    const int a_number_of_threads, double *a_planes, double *a_times) {
+  const auto elvira = [&](const int a_n) {
+    std::array<IRL::RectangularCuboid, 27> cells;
+    const int first = getStencil(a_ncells, a_lower, a_cell_size,
+                                 a_interface_cells[a_n], &cells);
+    IRL::ELVIRANeighborhood neighborhood;
+    neighborhood.resize(27);
+    int local = 0;
+    for (int k = 0; k < 3; ++k) {
+      for (int j = 0; j < 3; ++j) {
+        for (int i = 0; i < 3; ++i) {
+          neighborhood.setMember(
+              &cells[local],
+              &a_volume_fractions[first + i + a_ncells * (j + a_ncells * k)],
+              i - 1, j - 1, k - 1);
+          ++local;
+        }
+      }
+    }
+    return IRL::reconstructionWithELVIRA3D(neighborhood);
+  };
+  reconstructCells(a_number_of_interface_cells, a_number_of_threads, elvira,
+                   a_planes, a_times);
+}
+
+void irl_gvm_lviraReconstructions(
+    const int a_ncells, const double *a_lower, const double a_cell_size,
+    const double *a_volume_fractions, const double *,
+    const int a_number_of_interface_cells, const int *a_interface_cells,
+    const int a_number_of_threads, double *a_planes, double *a_times) {
+  const auto lvira = [&](const int a_n) {
+    std::array<IRL::RectangularCuboid, 27> cells;
+    const int first = getStencil(a_ncells, a_lower, a_cell_size,
+                                 a_interface_cells[a_n], &cells);
+    IRL::LVIRANeighborhood<IRL::RectangularCuboid> neighborhood;
+    neighborhood.resize(27);
+    int local = 0;
+    for (int k = 0; k < 3; ++k) {
+      for (int j = 0; j < 3; ++j) {
+        for (int i = 0; i < 3; ++i) {
+          neighborhood.setMember(
+              local, &cells[local],
+              &a_volume_fractions[first + i + a_ncells * (j + a_ncells * k)]);
+          ++local;
+        }
+      }
+    }
+    neighborhood.setCenterOfStencil(13);
+    return IRL::reconstructionWithLVIRA3D(neighborhood,
+                                          toSeparator(a_planes + 4 * a_n));
+  };
+  reconstructCells(a_number_of_interface_cells, a_number_of_threads, lvira,
+                   a_planes, a_times);
+}
+
+void irl_gvm_mofReconstructions(
+    const int a_ncells, const double *a_lower, const double a_cell_size,
+    const double *, const double *a_moments,
+    const int a_number_of_interface_cells, const int *a_interface_cells,
+    const int a_number_of_threads, double *a_planes, double *a_times) {
+  const auto mof = [&](const int a_n) {
+    const double *cell_moments = a_moments + 8 * a_n;
+    IRL::SeparatedMoments<IRL::VolumeMoments> moments;
+    for (int p = 0; p < 2; ++p) {
+      moments[p].volume() = cell_moments[4 * p];
+      moments[p].centroid() =
+          IRL::Pt(cell_moments[4 * p + 1], cell_moments[4 * p + 2],
+                  cell_moments[4 * p + 3]);
+    }
+    return IRL::reconstructionWithMOF3D(
+        getCell(a_ncells, a_lower, a_cell_size, a_interface_cells[a_n]),
+        moments);
+  };
+  reconstructCells(a_number_of_interface_cells, a_number_of_threads, mof,
+                   a_planes, a_times);
+}
+
+void irl_gvm_cutByReconstructions(const int a_ncells, const double *a_lower,
+                                  const double a_cell_size,
+                                  const int a_number_of_interface_cells,
+                                  const int *a_interface_cells,
+                                  const int a_number_of_threads,
+                                  const double *a_planes,
+                                  double *a_cut_volume_fractions,
+                                  double *a_times) {
+  const double cell_volume = a_cell_size * a_cell_size * a_cell_size;
+  const double start = omp_get_wtime();
+#pragma omp parallel for num_threads(a_number_of_threads) schedule(dynamic, 16)
+  for (int n = 0; n < a_number_of_interface_cells; ++n) {
+    a_cut_volume_fractions[n] =
+        static_cast<double>(IRL::getVolumeMoments<IRL::Volume>(
+            getCell(a_ncells, a_lower, a_cell_size, a_interface_cells[n]),
+            toSeparator(a_planes + 4 * n))) /
+        cell_volume;
+  }
+  const double end = omp_get_wtime();
+  a_times[0] = end - start;
+}
@@ -0,0 +1,62 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Interface reconstructions with IRL on a Cartesian mesh of a_ncells^3
+// cells of width a_cell_size, whose lower corner is a_lower. Cells are
+// indexed as i + a_ncells * (j + a_ncells * k). Only the
+// a_number_of_interface_cells cells listed in a_interface_cells are
+// reconstructed, and none of them may lie on the mesh boundary, since
+// ELVIRA and LVIRA use the full 3x3x3 stencil around the cell. One plane
+// is written per listed cell to a_planes, as its normal followed by its
+// distance. Cells are spread over a_number_of_threads OpenMP threads, and
+// the reconstruction of all listed cells is timed in a_times[0].
+
+#ifndef SRC_IRL_GVM_IRL_GVM_RECONSTRUCTION_H_
+#define SRC_IRL_GVM_IRL_GVM_RECONSTRUCTION_H_
+
+// Reconstruct with ELVIRA from the liquid volume fraction of every cell in
+// a_volume_fractions. a_moments is not used.
+void irl_gvm_elviraReconstructions(
+    const int a_ncells, const double *a_lower, const double a_cell_size,
+    const double *a_volume_fractions, const double *a_moments,
+    const int a_number_of_interface_cells, const int *a_interface_cells,
+    const int a_number_of_threads, double *a_planes, double *a_times);
+
+// Reconstruct with LVIRA from the liquid volume fraction of every cell in
+// a_volume_fractions, starting from the planes already in a_planes.
+// a_moments is not used.
+void irl_gvm_lviraReconstructions(
+    const int a_ncells, const double *a_lower, const double a_cell_size,
+    const double *a_volume_fractions, const double *a_moments,
+    const int a_number_of_interface_cells, const int *a_interface_cells,
+    const int a_number_of_threads, double *a_planes, double *a_times);
+
+// Reconstruct with MoF from the moments of each listed cell in a_moments,
+// given as the liquid volume and centroid followed by the gas volume and
+// centroid (8 per listed cell). a_volume_fractions is not used.
+void irl_gvm_mofReconstructions(
+    const int a_ncells, const double *a_lower, const double a_cell_size,
+    const double *a_volume_fractions, const double *a_moments,
+    const int a_number_of_interface_cells, const int *a_interface_cells,
+    const int a_number_of_threads, double *a_planes, double *a_times);
+
+// Cut each listed cell by its plane in a_planes and write the liquid
+// volume fraction below it to a_cut_volume_fractions (one per listed
+// cell). This is the single cut that the reconstructions above repeat
+// while searching for a plane, and is timed the same way in a_times[0].
+void irl_gvm_cutByReconstructions(const int a_ncells, const double *a_lower,
+                                  const double a_cell_size,
+                                  const int a_number_of_interface_cells,
+                                  const int *a_interface_cells,
+                                  const int a_number_of_threads,
+                                  const double *a_planes,
+                                  double *a_cut_volume_fractions,
+                                  double *a_times);
+
+#endif  // SRC_IRL_GVM_IRL_GVM_RECONSTRUCTION_H_
@@ -0,0 +1,85 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/irl_gvm/irl_gvm_traversal.h"
+
+#include <omp.h>
+
+#include <vector>
+
+// IRL source directory
+#include "src/parameters/defined_types.h"
+
+void irl_gvm_walkLocalizerMesh(const LocalizerMesh &a_mesh, const int a_seed,
+                               const int a_max_cells, int *a_visit_marks,
+                               const int a_mark, double *a_checksum,
+                               double *a_times, std::size_t *a_visited_cells) {
+  // The queue is allocated outside of the timed walk
+  std::vector<const IRL::LocalizerLink *> queue(a_max_cells);
+
+  double start = omp_get_wtime();
+  double checksum = 0.0;
+  int head = 0;
+  int tail = 0;
+  queue[tail++] = &a_mesh.getLink(a_seed);
+  a_visit_marks[a_seed] = a_mark;
+  while (head < tail) {
+    const IRL::LocalizerLink *link = queue[head++];
+    const auto &localizer = link->getReconstruction();
+    const IRL::UnsignedIndex_t number_of_planes =
+        localizer.getNumberOfPlanes();
+    for (IRL::UnsignedIndex_t p = 0; p < number_of_planes; ++p) {
+      const IRL::Plane &plane = localizer[p];
+      checksum += plane.normal()[0] + plane.normal()[1] + plane.normal()[2] +
+                  plane.distance();
+      const IRL::LocalizerLink *neighbor = link->getEdgeConnectivity(p);
+      if (neighbor != nullptr && tail < a_max_cells &&
+          a_visit_marks[neighbor->getId()] != a_mark) {
+        a_visit_marks[neighbor->getId()] = a_mark;
+        queue[tail++] = neighbor;
+      }
+    }
+  }
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  *a_checksum = checksum;
+  *a_visited_cells = static_cast<std::size_t>(tail);
+}
+
+void irl_gvm_walkCompactMesh(const CompactMesh &a_mesh, const int a_seed,
+                             const int a_max_cells, int *a_visit_marks,
+                             const int a_mark, double *a_checksum,
+                             double *a_times, std::size_t *a_visited_cells) {
+  std::vector<int> queue(a_max_cells);
+
+  double start = omp_get_wtime();
+  double checksum = 0.0;
+  int head = 0;
+  int tail = 0;
+  queue[tail++] = a_seed;
+  a_visit_marks[a_seed] = a_mark;
+  while (head < tail) {
+    const int cell = queue[head++];
+    const int end_face = a_mesh.getFacesEnd(cell);
+    for (int f = a_mesh.getFacesBegin(cell); f < end_face; ++f) {
+      checksum += a_mesh.getFaceNormal(f, 0) + a_mesh.getFaceNormal(f, 1) +
+                  a_mesh.getFaceNormal(f, 2) + a_mesh.getFaceDistance(f);
+      const int neighbor = a_mesh.getNeighbor(f);
+      if (neighbor >= 0 && tail < a_max_cells &&
+          a_visit_marks[neighbor] != a_mark) {
+        a_visit_marks[neighbor] = a_mark;
+        queue[tail++] = neighbor;
+      }
+    }
+  }
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  *a_checksum = checksum;
+  *a_visited_cells = static_cast<std::size_t>(tail);
+}
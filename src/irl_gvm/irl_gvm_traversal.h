@@ -0,0 +1,45 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Breadth-first walks over a mesh, visiting cells the way a distribution
+// spreads out from its seed cell without doing any clipping. Each visited
+// cell reads the normal and distance of all of its face planes, as a
+// clipping step would, adding them to a_checksum, and follows its
+// neighbors. This isolates the cost of the mesh layout
+// itself: pointer chasing through LocalizerLink and PlanarLocalizer
+// objects, or index lookups into the flat arrays of a CompactMesh. Both
+// walks visit the cells of the same mesh in the same order.
+//
+// Up to a_max_cells cells are visited starting from cell a_seed. Visited
+// cells are marked by writing a_mark into a_visit_marks, which holds one
+// entry per cell and must not already contain a_mark. The walk time is
+// stored in a_times[0] and the number of cells visited in
+// a_visited_cells.
+
+#ifndef SRC_IRL_GVM_IRL_GVM_TRAVERSAL_H_
+#define SRC_IRL_GVM_IRL_GVM_TRAVERSAL_H_
+
+#include <cstddef>
+
+#include "src/irl_gvm/compact_mesh.h"
+#include "src/irl_gvm/localizer_mesh.h"
+
+// Walk the LocalizerLink graph of a_mesh
+void irl_gvm_walkLocalizerMesh(const LocalizerMesh &a_mesh, const int a_seed,
+                               const int a_max_cells, int *a_visit_marks,
+                               const int a_mark, double *a_checksum,
+                               double *a_times, std::size_t *a_visited_cells);
+
+// Walk the CSR adjacency of a_mesh
+void irl_gvm_walkCompactMesh(const CompactMesh &a_mesh, const int a_seed,
+                             const int a_max_cells, int *a_visit_marks,
+                             const int a_mark, double *a_checksum,
+                             double *a_times, std::size_t *a_visited_cells);
+
+#endif  // SRC_IRL_GVM_IRL_GVM_TRAVERSAL_H_
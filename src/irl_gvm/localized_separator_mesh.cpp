@@ -0,0 +1,56 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/irl_gvm/localized_separator_mesh.h"
+
+#include <omp.h>
+
+#include <cassert>
+
+LocalizedSeparatorMesh::LocalizedSeparatorMesh(void)
+    : mesh_m(nullptr), setup_time_m(0.0) {}
+
+LocalizedSeparatorMesh LocalizedSeparatorMesh::fromLocalizerMesh(
+    const LocalizerMesh& a_mesh,
+    const std::vector<IRL::PlanarSeparator>& a_separators) {
+  assert(static_cast<int>(a_separators.size()) == a_mesh.getNumberOfCells());
+  LocalizedSeparatorMesh mesh;
+  mesh.mesh_m = &a_mesh;
+  double start = omp_get_wtime();
+  const int number_of_cells = a_mesh.getNumberOfCells();
+  mesh.separators_m = a_separators;
+  mesh.links_m.resize(number_of_cells);
+  // Links are all made before any are connected, so neighbors can be
+  // pointed to from any thread
+#pragma omp parallel for schedule(static)
+  for (int c = 0; c < number_of_cells; ++c) {
+    mesh.links_m[c] = IRL::LocalizedSeparatorLink(&a_mesh.getLocalizer(c),
+                                                  &mesh.separators_m[c]);
+    mesh.links_m[c].setId(static_cast<IRL::UnsignedIndex_t>(c));
+  }
+#pragma omp parallel for schedule(static)
+  for (int c = 0; c < number_of_cells; ++c) {
+    const IRL::LocalizerLink& link = a_mesh.getLink(c);
+    const IRL::UnsignedIndex_t number_of_planes =
+        a_mesh.getLocalizer(c).getNumberOfPlanes();
+    for (IRL::UnsignedIndex_t p = 0; p < number_of_planes; ++p) {
+      const IRL::LocalizerLink* neighbor = link.getEdgeConnectivity(p);
+      mesh.links_m[c].setEdgeConnectivity(
+          p, neighbor != nullptr ? &mesh.links_m[neighbor->getId()] : nullptr);
+    }
+  }
+  double end = omp_get_wtime();
+  mesh.setup_time_m = end - start;
+  return mesh;
+}
+
+std::size_t LocalizedSeparatorMesh::getMemoryFootprint(void) const {
+  return separators_m.capacity() * sizeof(IRL::PlanarSeparator) +
+         links_m.capacity() * sizeof(IRL::LocalizedSeparatorLink);
+}
@@ -0,0 +1,83 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// A LocalizerMesh whose cells also carry a planar interface
+// reconstruction, as in a two-phase VOF solver. Each cell is a
+// LocalizedSeparatorLink pairing the PlanarLocalizer of the underlying
+// mesh with a PlanarSeparator, so getVolumeMoments returns the moments
+// on each side of the interface. The localizers are borrowed from the
+// LocalizerMesh, which must outlive this mesh. Like LocalizerMesh, it can
+// be moved but not copied, and is only read during distribution.
+
+#ifndef SRC_IRL_GVM_LOCALIZED_SEPARATOR_MESH_H_
+#define SRC_IRL_GVM_LOCALIZED_SEPARATOR_MESH_H_
+
+#include <cstddef>
+#include <vector>
+
+// Timing IRL GVM directory
+#include "src/irl_gvm/localizer_mesh.h"
+
+// IRL source directory
+#include "src/geometry/general/pt.h"
+#include "src/graphs/localized_separator_link.h"
+#include "src/planar_reconstruction/planar_separator.h"
+
+class LocalizedSeparatorMesh {
+ public:
+  // Links over the cells of a_mesh, with cell c separated by
+  // a_separators[c] and connected as in a_mesh. Link Ids are the cell
+  // indices of a_mesh.
+  static LocalizedSeparatorMesh fromLocalizerMesh(
+      const LocalizerMesh& a_mesh,
+      const std::vector<IRL::PlanarSeparator>& a_separators);
+
+  LocalizedSeparatorMesh(LocalizedSeparatorMesh&& a_other) = default;
+  LocalizedSeparatorMesh& operator=(LocalizedSeparatorMesh&& a_other) =
+      default;
+  LocalizedSeparatorMesh(const LocalizedSeparatorMesh& a_other) = delete;
+  LocalizedSeparatorMesh& operator=(const LocalizedSeparatorMesh& a_other) =
+      delete;
+
+  int getNumberOfCells(void) const {
+    return static_cast<int>(links_m.size());
+  }
+
+  const IRL::LocalizedSeparatorLink& getLink(const int a_index) const {
+    return links_m[a_index];
+  }
+
+  // Interface reconstruction of cell a_index
+  const IRL::PlanarSeparator& getSeparator(const int a_index) const {
+    return separators_m[a_index];
+  }
+
+  // Link of the cell holding a_pt, found by the underlying LocalizerMesh
+  const IRL::LocalizedSeparatorLink& getSeedLink(const IRL::Pt& a_pt) const {
+    return links_m[mesh_m->getSeedLink(a_pt).getId()];
+  }
+
+  // Wall time in seconds taken to build the links, not counting the
+  // underlying LocalizerMesh
+  double getSetupTime(void) const { return setup_time_m; }
+
+  // Bytes held by the separators and links, not counting the underlying
+  // LocalizerMesh
+  std::size_t getMemoryFootprint(void) const;
+
+ private:
+  LocalizedSeparatorMesh(void);
+
+  const LocalizerMesh* mesh_m;
+  std::vector<IRL::PlanarSeparator> separators_m;
+  std::vector<IRL::LocalizedSeparatorLink> links_m;
+  double setup_time_m;
+};
+
+#endif  // SRC_IRL_GVM_LOCALIZED_SEPARATOR_MESH_H_
@@ -0,0 +1,706 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/irl_gvm/localizer_mesh.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+// IRL source directory
+#include "src/generic_cutting/generic_cutting.h"
+#include "src/geometry/general/plane.h"
+#include "src/geometry/polyhedrons/general_polyhedron.h"
+#include "src/geometry/polyhedrons/polyhedron_connectivity.h"
+#include "src/geometry/polyhedrons/rectangular_cuboid.h"
+#include "src/geometry/polyhedrons/tet.h"
+#include "src/helpers/mymath.h"
+#include "src/parameters/defined_types.h"
+
+// If true, will print out each object  to .vtu files
+static bool constexpr PRINT_OBJECTS = false;
+
+// This function sets up the cubic mesh. In IRL,
+// this means generating PlanarLocalizer objects
+// to represent the cell faces (and serve as edges
+// in the graph) and connecting them together to form
+// LocalizerLink objects. Together, the LocalizerLink objects
+// for the graph of the mesh over which we will distribute.
+static void setupCubicMesh(const std::array<IRL::Pt, 2> a_bounding_pts,
+                           const std::array<int, 3> a_ncells,
+                           std::vector<IRL::PlanarLocalizer> *a_localizers,
+                           std::vector<IRL::LocalizerLink> *a_links) {
+  std::array<double, 3> dx{{(a_bounding_pts[1][0] - a_bounding_pts[0][0]) /
+                                static_cast<double>(a_ncells[0]),
+                            (a_bounding_pts[1][1] - a_bounding_pts[0][1]) /
+                                static_cast<double>(a_ncells[1]),
+                            (a_bounding_pts[1][2] - a_bounding_pts[0][2]) /
+                                static_cast<double>(a_ncells[2])}};
+  a_localizers->resize(a_ncells[0] * a_ncells[1] * a_ncells[2]);
+  a_links->resize(a_ncells[0] * a_ncells[1] * a_ncells[2]);
+  std::array<IRL::Pt, 2> local_bb;
+  for (int k = 0; k < a_ncells[2]; ++k) {
+    for (int j = 0; j < a_ncells[1]; ++j) {
+      for (int i = 0; i < a_ncells[0]; ++i) {
+        const int index = i + j * a_ncells[0] + k * a_ncells[1] * a_ncells[0];
+        local_bb[0] =
+            a_bounding_pts[0] + IRL::Pt(static_cast<double>(i) * dx[0],
+                                        static_cast<double>(j) * dx[1],
+                                        static_cast<double>(k) * dx[2]);
+        local_bb[1] = local_bb[0] + IRL::Pt(dx[0], dx[1], dx[2]);
+        // Set up reconstructions
+        (*a_localizers)[index].setNumberOfPlanes(6);
+        (*a_localizers)[index][0] =
+            IRL::Plane(IRL::Normal(1.0, 0.0, 0.0), local_bb[1][0]);
+        (*a_localizers)[index][1] =
+            IRL::Plane(IRL::Normal(-1.0, 0.0, 0.0), -local_bb[0][0]);
+        (*a_localizers)[index][2] =
+            IRL::Plane(IRL::Normal(0.0, 1.0, 0.0), local_bb[1][1]);
+        (*a_localizers)[index][3] =
+            IRL::Plane(IRL::Normal(0.0, -1.0, 0.0), -local_bb[0][1]);
+        (*a_localizers)[index][4] =
+            IRL::Plane(IRL::Normal(0.0, 0.0, 1.0), local_bb[1][2]);
+        (*a_localizers)[index][5] =
+            IRL::Plane(IRL::Normal(0.0, 0.0, -1.0), -local_bb[0][2]);
+
+        // Now set link connections
+        (*a_links)[index] = IRL::LocalizerLink(&(*a_localizers)[index]);
+        (*a_links)[index].setId(index);
+        (*a_links)[index].setEdgeConnectivity(
+            0, i != a_ncells[0] - 1 ? &(*a_links)[index + 1] : nullptr);
+        (*a_links)[index].setEdgeConnectivity(1, i != 0 ? &(*a_links)[index - 1]
+                                                        : nullptr);
+        (*a_links)[index].setEdgeConnectivity(
+            2,
+            j != a_ncells[1] - 1 ? &(*a_links)[index + a_ncells[0]] : nullptr);
+        (*a_links)[index].setEdgeConnectivity(
+            3, j != 0 ? &(*a_links)[index - a_ncells[0]] : nullptr);
+        (*a_links)[index].setEdgeConnectivity(
+            4, k != a_ncells[2] - 1
+                   ? &(*a_links)[index + a_ncells[0] * a_ncells[1]]
+                   : nullptr);
+        (*a_links)[index].setEdgeConnectivity(
+            5,
+            k != 0 ? &(*a_links)[index - a_ncells[0] * a_ncells[1]] : nullptr);
+      }
+    }
+  }
+
+  if (PRINT_OBJECTS) {
+    for (int k = 0; k < a_ncells[2]; ++k) {
+      for (int j = 0; j < a_ncells[1]; ++j) {
+        for (int i = 0; i < a_ncells[0]; ++i) {
+          local_bb[0] =
+              a_bounding_pts[0] + IRL::Pt(static_cast<double>(i) * dx[0],
+                                          static_cast<double>(j) * dx[1],
+                                          static_cast<double>(k) * dx[2]);
+          local_bb[1] = local_bb[0] + IRL::Pt(dx[0], dx[1], dx[2]);
+          const int index = i + j * a_ncells[0] + k * a_ncells[1] * a_ncells[0];
+          auto poly =
+              IRL::RectangularCuboid::fromBoundingPts(local_bb[0], local_bb[1]);
+          auto &half_edge = IRL::setHalfEdgeStructure(poly);
+          auto segmented = half_edge.generateSegmentedPolyhedron();
+          std::string filename = "cube_mesh_" + std::to_string(index) + ".vtu";
+          std::ofstream myfile;
+          myfile.open(filename);
+          myfile << segmented;
+          myfile.close();
+        }
+      }
+    }
+  }
+}
+
+// Tetrahedral mesh-type domain with a cuboid decomposed into
+// 24 tets using face centroids and the cell center.
+// This function sets up the Tet  mesh. In IRL,
+// this means generating PlanarLocalizer objects
+// to represent the cell faces (and serve as edges
+// in the graph) and connecting them together to form
+// LocalizerLink objects. Together, the LocalizerLink objects
+// for the graph of the mesh over which we will distribute.
+// The bounding box of each tet is returned in a_cell_boxes.
+static void setupTetMesh(const std::array<IRL::Pt, 2> a_bounding_pts,
+                         std::vector<IRL::PlanarLocalizer> *a_localizers,
+                         std::vector<IRL::LocalizerLink> *a_links,
+                         std::vector<std::array<IRL::Pt, 2>> *a_cell_boxes) {
+  const std::array<IRL::Pt, 8> cuboid_pts{
+      {IRL::Pt(a_bounding_pts[1][0], a_bounding_pts[0][1],
+               a_bounding_pts[0][2]),
+       IRL::Pt(a_bounding_pts[1][0], a_bounding_pts[1][1],
+               a_bounding_pts[0][2]),
+       IRL::Pt(a_bounding_pts[1][0], a_bounding_pts[1][1],
+               a_bounding_pts[1][2]),
+       IRL::Pt(a_bounding_pts[1][0], a_bounding_pts[0][1],
+               a_bounding_pts[1][2]),
+       IRL::Pt(a_bounding_pts[0][0], a_bounding_pts[0][1],
+               a_bounding_pts[0][2]),
+       IRL::Pt(a_bounding_pts[0][0], a_bounding_pts[1][1],
+               a_bounding_pts[0][2]),
+       IRL::Pt(a_bounding_pts[0][0], a_bounding_pts[1][1],
+               a_bounding_pts[1][2]),
+       IRL::Pt(a_bounding_pts[0][0], a_bounding_pts[0][1],
+               a_bounding_pts[1][2])}};
+
+  const std::array<std::array<int, 4>, 6> face_indices{{{0, 1, 2, 3},
+                                                        {0, 4, 5, 1},
+                                                        {1, 5, 6, 2},
+                                                        {2, 6, 7, 3},
+                                                        {3, 7, 4, 0},
+                                                        {4, 7, 6, 5}}};
+
+  const std::array<IRL::Normal, 6> face_normals{
+      {IRL::Normal(1.0, 0.0, 0.0), IRL::Normal(0.0, 0.0, -1.0),
+       IRL::Normal(0.0, 1.0, 0.0), IRL::Normal(0.0, 0.0, 1.0),
+       IRL::Normal(0.0, -1.0, 0.0), IRL::Normal(-1.0, 0.0, 0.0)}};
+  std::array<IRL::Pt, 6> face_centroids;
+  for (std::size_t f = 0; f < face_centroids.size(); ++f) {
+    face_centroids[f] = IRL::Pt::fromScalarConstant(0.0);
+    for (const auto &index : face_indices[f]) {
+      face_centroids[f] += cuboid_pts[index];
+    }
+    face_centroids[f] /= static_cast<double>(face_indices[f].size());
+  }
+
+  auto volume_centroid = IRL::Pt::fromScalarConstant(0.0);
+  for (const auto vertex : cuboid_pts) {
+    volume_centroid += vertex;
+  }
+  volume_centroid /= static_cast<double>(cuboid_pts.size());
+
+  std::array<int, 24> shared_edge_link{{7,  11, 15, 19, 18, 23, 8,  0,
+                                        6,  22, 12, 1,  10, 21, 16, 2,
+                                        14, 20, 4,  3,  17, 13, 9,  5}};
+
+  a_localizers->resize(24);
+  a_links->resize(24);
+  a_cell_boxes->resize(24);
+  for (std::size_t n = 0; n < a_localizers->size(); ++n) {
+    (*a_links)[n] = IRL::LocalizerLink(&(*a_localizers)[n]);
+  }
+  std::array<IRL::Pt, 4> tet;
+  tet[3] = volume_centroid;
+  for (std::size_t f = 0; f < face_indices.size(); ++f) {
+    tet[2] = face_centroids[f];
+    const auto &face = face_indices[f];
+    for (std::size_t e = 0; e < face.size(); ++e) {
+      tet[0] = cuboid_pts[face[e]];
+      tet[1] = cuboid_pts[face[(e + 1) % face.size()]];
+      const std::size_t index = e + f * 4;
+      (*a_localizers)[index].setNumberOfPlanes(4);
+
+      // Make first plane from on cuboid face
+      IRL::Normal normal = face_normals[f];
+      (*a_localizers)[index][0] =
+          IRL::Plane(normal, normal * face_centroids[f]);
+
+      // Make second plane for face having edge on original cuboid
+      normal = IRL::crossProductNormalized(IRL::Pt(tet[1] - tet[3]),
+                                           IRL::Pt(tet[0] - tet[3]));
+      (*a_localizers)[index][1] = IRL::Plane(normal, normal * tet[3]);
+
+      // Make third plane for tet[0] and face_centroid
+      normal = IRL::crossProductNormalized(IRL::Pt(tet[0] - tet[3]),
+                                           IRL::Pt(tet[2] - tet[3]));
+      (*a_localizers)[index][2] = IRL::Plane(normal, normal * tet[3]);
+
+      // Make fourth plane for tet[1] and face_centroid
+      normal = IRL::crossProductNormalized(IRL::Pt(tet[2] - tet[3]),
+                                           IRL::Pt(tet[1] - tet[3]));
+      (*a_localizers)[index][3] = IRL::Plane(normal, normal * tet[3]);
+
+      // Now link up localizer to rest of the mesh
+      (*a_links)[index].setId(static_cast<IRL::UnsignedIndex_t>(index));
+      (*a_links)[index].setEdgeConnectivity(0, nullptr);
+      (*a_links)[index].setEdgeConnectivity(
+          1, &(*a_links)[shared_edge_link[index]]);
+      std::size_t neighbor = (e + 1) % face.size() + f * 4;
+      (*a_links)[neighbor].setEdgeConnectivity(2, &(*a_links)[index]);
+      (*a_links)[index].setEdgeConnectivity(3, &(*a_links)[neighbor]);
+
+      auto &box = (*a_cell_boxes)[index];
+      box[0] = tet[0];
+      box[1] = tet[0];
+      for (const auto &vertex : tet) {
+        for (int d = 0; d < 3; ++d) {
+          box[0][d] = std::min(box[0][d], vertex[d]);
+          box[1][d] = std::max(box[1][d], vertex[d]);
+        }
+      }
+    }
+  }
+
+  if (PRINT_OBJECTS) {
+    tet[3] = volume_centroid;
+    for (std::size_t f = 0; f < face_indices.size(); ++f) {
+      tet[2] = face_centroids[f];
+      const auto &face = face_indices[f];
+      for (std::size_t e = 0; e < face.size(); ++e) {
+        tet[0] = cuboid_pts[face[e]];
+        tet[1] = cuboid_pts[face[(e + 1) % face.size()]];
+
+        const std::size_t index = e + f * 4;
+        auto poly = IRL::Tet::fromRawPtPointer(4, tet.data());
+        auto &half_edge = IRL::setHalfEdgeStructure(poly);
+        auto segmented = half_edge.generateSegmentedPolyhedron();
+        std::string filename = "tet_mesh_" + std::to_string(index) + ".vtu";
+        std::ofstream myfile;
+        myfile.open(filename);
+        myfile << segmented;
+        myfile.close();
+      }
+    }
+  }
+}
+
+static IRL::Pt convertToCartesian(const IRL::Pt &a_spherical_pt) {
+  return {a_spherical_pt[0] * std::sin(a_spherical_pt[2]) *
+              std::cos(a_spherical_pt[1]),
+          a_spherical_pt[0] * std::sin(a_spherical_pt[2]) *
+              std::sin(a_spherical_pt[1]),
+          a_spherical_pt[0] * std::cos(a_spherical_pt[2])};
+}
+
+// This function sets up the Spherical Cartesian mesh. In IRL,
+// this means generating PlanarLocalizer objects
+// to represent the cell faces (and serve as edges
+// in the graph) and connecting them together to form
+// LocalizerLink objects. Together, the LocalizerLink objects
+// for the graph of the mesh over which we will distribute.
+static void
+setupSphericalCartesianMesh(const double a_radius, const int a_radial_cells,
+                         const int a_theta_cells, const int a_phi_cells,
+                         std::vector<IRL::PlanarLocalizer> *a_localizers,
+                         std::vector<IRL::LocalizerLink> *a_links) {
+
+  assert(a_radial_cells > 0);
+  // Each theta sector is a wedge between two half-planes through the z
+  // axis, which needs it to be narrower than pi
+  assert(a_theta_cells > 2);
+  assert(a_phi_cells > 0);
+
+  IRL::Pt center(0.0, 0.0, 0.0);
+
+  const double d_theta = 2.0 * M_PI / static_cast<double>(a_theta_cells);
+  const double d_phi = 1.0 * M_PI / static_cast<double>(a_phi_cells);
+  const double d_radius = a_radius / static_cast<double>(a_radial_cells);
+
+  a_localizers->resize(1 + (a_radial_cells - 1) * a_theta_cells * a_phi_cells);
+  a_links->resize(1 + (a_radial_cells - 1) * a_theta_cells * a_phi_cells);
+  for (std::size_t n = 0; n < a_localizers->size(); ++n) {
+    (*a_links)[n] = IRL::LocalizerLink(&(*a_localizers)[n]);
+  }
+  (*a_links)[0].setId(0);
+
+  // First reconstruction is a convex sphere like object
+  (*a_localizers)[0].setNumberOfPlanes(a_theta_cells * a_phi_cells);
+  for (int p = 0; p < a_phi_cells; ++p) {
+    for (int t = 0; t < a_theta_cells; ++t) {
+      IRL::Normal normal = convertToCartesian(
+          IRL::Pt(1.0, (static_cast<double>(t) + 0.5) * d_theta,
+                  (static_cast<double>(p) + 0.5) * d_phi));
+      (*a_localizers)[0][t + p * a_theta_cells] = IRL::Plane(normal, d_radius);
+    }
+  }
+
+  // Rest of reconstructions wrap around initial one, propagating outwards
+  // towards the sphere radius. The side faces split space the same way the
+  // planes of the first reconstruction do (each point belongs to the sector
+  // whose center normal is closest to it), so the shells tile the space
+  // around it without gaps or overlaps.
+  for (int r = 1; r < a_radial_cells; ++r) {
+    for (int p = 0; p < a_phi_cells; ++p) {
+      for (int t = 0; t < a_theta_cells; ++t) {
+        const int index =
+            1 + t + p * a_theta_cells + (r - 1) * a_theta_cells * a_phi_cells;
+        const double center_theta = (static_cast<double>(t) + 0.5) * d_theta;
+        IRL::Normal normal = convertToCartesian(IRL::Pt(
+            1.0, center_theta, (static_cast<double>(p) + 0.5) * d_phi));
+        (*a_localizers)[index].setNumberOfPlanes(6);
+        // Bottom face pointing towards center
+        (*a_localizers)[index][0] =
+            IRL::Plane(-normal, -d_radius * static_cast<double>(r));
+        // Top face pointing towards outside
+        (*a_localizers)[index][1] =
+            IRL::Plane(normal, d_radius * static_cast<double>(r + 1));
+
+        // Side face traveling in -theta direction
+        double angle = static_cast<double>(t) * d_theta;
+        normal = -IRL::Normal(-std::sin(angle), std::cos(angle), 0.0);
+        (*a_localizers)[index][2] = IRL::Plane(normal, 0.0);
+
+        // Side face traveling in +theta direction
+        angle = static_cast<double>(t + 1) * d_theta;
+        normal = IRL::Normal(-std::sin(angle), std::cos(angle), 0.0);
+        (*a_localizers)[index][3] = IRL::Plane(normal, 0.0);
+
+        // Side faces traveling in -phi and +phi directions, each normal to
+        // the difference of the center normals on either side. At the poles
+        // the face has no neighbor and only bounds the wedge already
+        // bounded by the theta faces.
+        angle = static_cast<double>(p) * d_phi;
+        normal = -IRL::Normal(std::cos(angle) * std::cos(center_theta),
+                              std::cos(angle) * std::sin(center_theta),
+                              -std::sin(angle));
+        (*a_localizers)[index][4] = IRL::Plane(normal, 0.0);
+
+        angle = static_cast<double>(p + 1) * d_phi;
+        normal = IRL::Normal(std::cos(angle) * std::cos(center_theta),
+                             std::cos(angle) * std::sin(center_theta),
+                             -std::sin(angle));
+        (*a_localizers)[index][5] = IRL::Plane(normal, 0.0);
+
+        (*a_links)[index].setId(index);
+        if (r != 1) {
+          (*a_links)[index].setEdgeConnectivity(
+              0, &(*a_links)[index - a_theta_cells * a_phi_cells]);
+        }
+        if (r < a_radial_cells - 1) {
+          (*a_links)[index].setEdgeConnectivity(
+              1, &(*a_links)[index + a_theta_cells * a_phi_cells]);
+        }
+        int neighbor = (t + 1) % a_theta_cells + 1 + p * a_theta_cells +
+                       (r - 1) * a_theta_cells * a_phi_cells;
+        (*a_links)[neighbor].setEdgeConnectivity(2, &(*a_links)[index]);
+        (*a_links)[index].setEdgeConnectivity(3, &(*a_links)[neighbor]);
+        if (p + 1 < a_phi_cells) {
+          neighbor = index + a_theta_cells;
+          (*a_links)[neighbor].setEdgeConnectivity(4, &(*a_links)[index]);
+          (*a_links)[index].setEdgeConnectivity(5, &(*a_links)[neighbor]);
+        }
+      }
+    }
+  }
+  // Have more than one localizer
+  if (a_radial_cells > 1) {
+    for (int p = 0; p < a_phi_cells; ++p) {
+      for (int t = 0; t < a_theta_cells; ++t) {
+        const int index = 1 + t + p * a_theta_cells;
+        (*a_links)[0].setEdgeConnectivity(index - 1, &(*a_links)[index]);
+        (*a_links)[index].setEdgeConnectivity(0, &(*a_links)[0]);
+      }
+    }
+  }
+
+  if (PRINT_OBJECTS) {
+    std::array<IRL::Pt, 8> pts;
+    std::vector<std::vector<IRL::UnsignedIndex_t>> face_brep(6);
+    face_brep[0] = std::vector<IRL::UnsignedIndex_t>({0, 3, 2, 1});
+    face_brep[1] = std::vector<IRL::UnsignedIndex_t>({4, 5, 6, 7});
+    face_brep[2] = std::vector<IRL::UnsignedIndex_t>({0, 4, 7, 3});
+    face_brep[3] = std::vector<IRL::UnsignedIndex_t>({1, 2, 6, 5});
+    face_brep[4] = std::vector<IRL::UnsignedIndex_t>({7, 6, 2, 3});
+    face_brep[5] = std::vector<IRL::UnsignedIndex_t>({4, 0, 1, 5});
+    IRL::PolyhedronConnectivity connectivity(face_brep);
+    for (int r = 1; r < a_radial_cells; ++r) {
+      for (int p = 0; p < a_phi_cells; ++p) {
+        for (int t = 0; t < a_theta_cells; ++t) {
+          pts[0] =
+              convertToCartesian(IRL::Pt(static_cast<double>(r) * d_radius,
+                                         (static_cast<double>(t)) * d_theta,
+                                         (static_cast<double>(p)) * d_phi));
+          pts[1] =
+              convertToCartesian(IRL::Pt(static_cast<double>(r) * d_radius,
+                                         (static_cast<double>(t + 1)) * d_theta,
+                                         (static_cast<double>(p)) * d_phi));
+          pts[2] =
+              convertToCartesian(IRL::Pt(static_cast<double>(r) * d_radius,
+                                         (static_cast<double>(t + 1)) * d_theta,
+                                         (static_cast<double>(p + 1)) * d_phi));
+          pts[3] =
+              convertToCartesian(IRL::Pt(static_cast<double>(r) * d_radius,
+                                         (static_cast<double>(t)) * d_theta,
+                                         (static_cast<double>(p + 1)) * d_phi));
+          pts[4] =
+              convertToCartesian(IRL::Pt(static_cast<double>(r + 1) * d_radius,
+                                         (static_cast<double>(t)) * d_theta,
+                                         (static_cast<double>(p)) * d_phi));
+          pts[5] =
+              convertToCartesian(IRL::Pt(static_cast<double>(r + 1) * d_radius,
+                                         (static_cast<double>(t + 1)) * d_theta,
+                                         (static_cast<double>(p)) * d_phi));
+          pts[6] =
+              convertToCartesian(IRL::Pt(static_cast<double>(r + 1) * d_radius,
+                                         (static_cast<double>(t + 1)) * d_theta,
+                                         (static_cast<double>(p + 1)) * d_phi));
+          pts[7] =
+              convertToCartesian(IRL::Pt(static_cast<double>(r + 1) * d_radius,
+                                         (static_cast<double>(t)) * d_theta,
+                                         (static_cast<double>(p + 1)) * d_phi));
+
+          const int index =
+              1 + t + p * a_theta_cells + (r - 1) * a_theta_cells * a_phi_cells;
+          IRL::GeneralPolyhedron poly(pts, &connectivity);
+          auto &half_edge = IRL::setHalfEdgeStructure(poly);
+          auto segmented = half_edge.generateSegmentedPolyhedron();
+          std::string filename =
+              "spherical_mesh_" + std::to_string(index) + ".vtu";
+          std::ofstream myfile;
+          myfile.open(filename);
+          myfile << segmented;
+          myfile.close();
+        }
+      }
+    }
+  }
+}
+
+
+// Index of the bin, of a_bins bins evenly dividing the box between
+// a_bounding_pts, that holds a_pt. Points outside the box are clamped
+// to the closest bin.
+static std::array<int, 3> getBinIndex(
+    const IRL::Pt &a_pt, const std::array<IRL::Pt, 2> &a_bounding_pts,
+    const std::array<int, 3> &a_bins) {
+  std::array<int, 3> ijk;
+  for (int d = 0; d < 3; ++d) {
+    ijk[d] = static_cast<int>(
+        std::floor((a_pt[d] - a_bounding_pts[0][d]) /
+                   (a_bounding_pts[1][d] - a_bounding_pts[0][d]) *
+                   static_cast<double>(a_bins[d])));
+    ijk[d] = std::max(0, std::min(a_bins[d] - 1, ijk[d]));
+  }
+  return ijk;
+}
+
+// True if a_pt is on or below every plane of a_localizer
+static bool isInsideLocalizer(const IRL::PlanarLocalizer &a_localizer,
+                              const IRL::Pt &a_pt) {
+  for (IRL::UnsignedIndex_t p = 0; p < a_localizer.getNumberOfPlanes(); ++p) {
+    if (a_localizer[p].signedDistanceToPoint(a_pt) > 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+LocalizerMesh::LocalizerMesh(const MeshType a_type)
+    : type_m(a_type),
+      bounding_pts_m{{IRL::Pt(0.0, 0.0, 0.0), IRL::Pt(0.0, 0.0, 0.0)}},
+      ncells_m{{0, 0, 0}},
+      bins_m{{0, 0, 0}},
+      shell_width_m(0.0),
+      setup_time_m(0.0) {}
+
+LocalizerMesh LocalizerMesh::fromCubic(
+    const std::array<IRL::Pt, 2>& a_bounding_pts,
+    const std::array<int, 3>& a_ncells) {
+  LocalizerMesh mesh(MeshType::CUBIC);
+  mesh.bounding_pts_m = a_bounding_pts;
+  mesh.ncells_m = a_ncells;
+  double start = omp_get_wtime();
+  setupCubicMesh(a_bounding_pts, a_ncells, &mesh.localizers_m, &mesh.links_m);
+  double end = omp_get_wtime();
+  mesh.setup_time_m = end - start;
+  return mesh;
+}
+
+LocalizerMesh LocalizerMesh::fromCompact(const CompactMesh& a_compact_mesh) {
+  // Cartesian meshes keep the floor lookup, while the seed cell of tet
+  // meshes is found through the uniform grid of candidate cells
+  LocalizerMesh mesh(a_compact_mesh.isCubic() ? MeshType::CUBIC
+                                              : MeshType::TET);
+  mesh.bounding_pts_m = a_compact_mesh.getBoundingPts();
+  mesh.ncells_m = a_compact_mesh.getNumberOfCellsPerDirection();
+
+  double start = omp_get_wtime();
+  const int number_of_cells = a_compact_mesh.getNumberOfCells();
+  mesh.localizers_m.resize(number_of_cells);
+  mesh.links_m.resize(number_of_cells);
+  // Links are only pointed to after all of them exist, so the neighbor
+  // connections are set in a second pass.
+#pragma omp parallel for schedule(static)
+  for (int c = 0; c < number_of_cells; ++c) {
+    const int begin = a_compact_mesh.getFacesBegin(c);
+    const int end = a_compact_mesh.getFacesEnd(c);
+    auto& localizer = mesh.localizers_m[c];
+    localizer.setNumberOfPlanes(static_cast<IRL::UnsignedIndex_t>(end - begin));
+    for (int f = begin; f < end; ++f) {
+      localizer[f - begin] = IRL::Plane(
+          IRL::Normal(a_compact_mesh.getFaceNormal(f, 0),
+                      a_compact_mesh.getFaceNormal(f, 1),
+                      a_compact_mesh.getFaceNormal(f, 2)),
+          a_compact_mesh.getFaceDistance(f));
+    }
+    mesh.links_m[c] = IRL::LocalizerLink(&localizer);
+    mesh.links_m[c].setId(c);
+  }
+#pragma omp parallel for schedule(static)
+  for (int c = 0; c < number_of_cells; ++c) {
+    const int begin = a_compact_mesh.getFacesBegin(c);
+    const int end = a_compact_mesh.getFacesEnd(c);
+    for (int f = begin; f < end; ++f) {
+      const int neighbor = a_compact_mesh.getNeighbor(f);
+      mesh.links_m[c].setEdgeConnectivity(
+          f - begin, neighbor >= 0 ? &mesh.links_m[neighbor] : nullptr);
+    }
+  }
+  if (mesh.type_m == MeshType::TET) {
+    std::vector<std::array<IRL::Pt, 2>> cell_boxes(number_of_cells);
+#pragma omp parallel for schedule(static)
+    for (int c = 0; c < number_of_cells; ++c) {
+      cell_boxes[c] = a_compact_mesh.getCellBoundingBox(c);
+    }
+    mesh.buildPointIndex(cell_boxes);
+  }
+  double end = omp_get_wtime();
+  mesh.setup_time_m = end - start;
+  return mesh;
+}
+
+LocalizerMesh LocalizerMesh::fromTet(
+    const std::array<IRL::Pt, 2>& a_bounding_pts) {
+  LocalizerMesh mesh(MeshType::TET);
+  mesh.bounding_pts_m = a_bounding_pts;
+  double start = omp_get_wtime();
+  std::vector<std::array<IRL::Pt, 2>> cell_boxes;
+  setupTetMesh(a_bounding_pts, &mesh.localizers_m, &mesh.links_m,
+               &cell_boxes);
+  mesh.buildPointIndex(cell_boxes);
+  double end = omp_get_wtime();
+  mesh.setup_time_m = end - start;
+  return mesh;
+}
+
+LocalizerMesh LocalizerMesh::fromSphericalCartesian(const double a_radius,
+                                                    const int a_radial_cells,
+                                                    const int a_theta_cells,
+                                                    const int a_phi_cells) {
+  LocalizerMesh mesh(MeshType::SPHERICAL_CARTESIAN);
+  mesh.ncells_m = {{a_radial_cells, a_theta_cells, a_phi_cells}};
+  mesh.shell_width_m = a_radius / static_cast<double>(a_radial_cells);
+  double start = omp_get_wtime();
+  setupSphericalCartesianMesh(a_radius, a_radial_cells, a_theta_cells,
+                              a_phi_cells, &mesh.localizers_m, &mesh.links_m);
+  double end = omp_get_wtime();
+  mesh.setup_time_m = end - start;
+  return mesh;
+}
+
+const IRL::LocalizerLink& LocalizerMesh::getSeedLink(
+    const IRL::Pt& a_pt) const {
+  switch (type_m) {
+    case MeshType::CUBIC: {
+      const auto ijk = getBinIndex(a_pt, bounding_pts_m, ncells_m);
+      return links_m[ijk[0] + ijk[1] * ncells_m[0] +
+                     ijk[2] * ncells_m[0] * ncells_m[1]];
+    }
+    case MeshType::TET:
+      return links_m[locateInPointIndex(a_pt)];
+    case MeshType::SPHERICAL_CARTESIAN:
+      return links_m[locateInShells(a_pt)];
+  }
+  return links_m[0];
+}
+
+const IRL::LocalizerLink& LocalizerMesh::getFixedSeedLink(void) const {
+  if (type_m == MeshType::CUBIC) {
+    return links_m[ncells_m[0] / 2 + ncells_m[1] / 2 * ncells_m[0] +
+                   ncells_m[2] / 2 * ncells_m[0] * ncells_m[1]];
+  }
+  return links_m[0];
+}
+
+std::size_t LocalizerMesh::getMemoryFootprint(void) const {
+  return localizers_m.capacity() * sizeof(IRL::PlanarLocalizer) +
+         links_m.capacity() * sizeof(IRL::LocalizerLink) +
+         bin_offsets_m.capacity() * sizeof(int) +
+         bin_cells_m.capacity() * sizeof(int);
+}
+
+void LocalizerMesh::buildPointIndex(
+    const std::vector<std::array<IRL::Pt, 2>>& a_cell_boxes) {
+  // Roughly one cell per bin
+  const int bins_per_direction = std::max(
+      1, static_cast<int>(std::lround(
+             std::cbrt(static_cast<double>(a_cell_boxes.size())))));
+  bins_m = {{bins_per_direction, bins_per_direction, bins_per_direction}};
+  const int number_of_bins = bins_m[0] * bins_m[1] * bins_m[2];
+
+  // Count the cells overlapping each bin, then fill them in, giving the
+  // cells of bin b in bin_cells_m[bin_offsets_m[b]:bin_offsets_m[b+1]].
+  bin_offsets_m.assign(number_of_bins + 1, 0);
+  for (int pass = 0; pass < 2; ++pass) {
+    std::vector<int> fill(bin_offsets_m.begin(), bin_offsets_m.end() - 1);
+    for (std::size_t c = 0; c < a_cell_boxes.size(); ++c) {
+      const auto lower =
+          getBinIndex(a_cell_boxes[c][0], bounding_pts_m, bins_m);
+      const auto upper =
+          getBinIndex(a_cell_boxes[c][1], bounding_pts_m, bins_m);
+      for (int k = lower[2]; k <= upper[2]; ++k) {
+        for (int j = lower[1]; j <= upper[1]; ++j) {
+          for (int i = lower[0]; i <= upper[0]; ++i) {
+            const int bin = i + j * bins_m[0] + k * bins_m[0] * bins_m[1];
+            if (pass == 0) {
+              ++bin_offsets_m[bin + 1];
+            } else {
+              bin_cells_m[fill[bin]++] = static_cast<int>(c);
+            }
+          }
+        }
+      }
+    }
+    if (pass == 0) {
+      for (int b = 0; b < number_of_bins; ++b) {
+        bin_offsets_m[b + 1] += bin_offsets_m[b];
+      }
+      bin_cells_m.resize(bin_offsets_m[number_of_bins]);
+    }
+  }
+}
+
+int LocalizerMesh::locateInPointIndex(const IRL::Pt& a_pt) const {
+  const auto ijk = getBinIndex(a_pt, bounding_pts_m, bins_m);
+  const int bin = ijk[0] + ijk[1] * bins_m[0] + ijk[2] * bins_m[0] * bins_m[1];
+  for (int n = bin_offsets_m[bin]; n < bin_offsets_m[bin + 1]; ++n) {
+    if (isInsideLocalizer(localizers_m[bin_cells_m[n]], a_pt)) {
+      return bin_cells_m[n];
+    }
+  }
+  // Outside the mesh, so start from any cell close to the point
+  return bin_offsets_m[bin] < bin_offsets_m[bin + 1]
+             ? bin_cells_m[bin_offsets_m[bin]]
+             : 0;
+}
+
+int LocalizerMesh::locateInShells(const IRL::Pt& a_pt) const {
+  if (ncells_m[0] == 1 || isInsideLocalizer(localizers_m[0], a_pt)) {
+    return 0;
+  }
+  // The theta sector follows from the azimuth, as its side faces are
+  // half-planes through the z axis. The phi sector is then found from the
+  // phi faces (planes 4 and 5) of the first shell in that column, and the
+  // shell from the distance along the sector's outward normal (plane 1).
+  const double d_theta = 2.0 * M_PI / static_cast<double>(ncells_m[1]);
+  double azimuth = std::atan2(a_pt[1], a_pt[0]);
+  if (azimuth < 0.0) {
+    azimuth += 2.0 * M_PI;
+  }
+  const int t = std::max(
+      0, std::min(ncells_m[1] - 1,
+                  static_cast<int>(std::floor(azimuth / d_theta))));
+  const int sectors = ncells_m[1] * ncells_m[2];
+  for (int p = 0; p < ncells_m[2]; ++p) {
+    const int s = t + p * ncells_m[1];
+    const auto& localizer = localizers_m[1 + s];
+    if (localizer[4].signedDistanceToPoint(a_pt) > 0.0 ||
+        localizer[5].signedDistanceToPoint(a_pt) > 0.0) {
+      continue;
+    }
+    int shell = static_cast<int>(
+        std::floor(localizer[1].normal() * a_pt / shell_width_m));
+    shell = std::max(1, std::min(ncells_m[0] - 1, shell));
+    return 1 + s + (shell - 1) * sectors;
+  }
+  return 0;
+}
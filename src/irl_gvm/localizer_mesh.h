@@ -0,0 +1,134 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// A mesh that polyhedra are distributed over with IRL. Each cell is a
+// PlanarLocalizer, and the LocalizerLink objects connecting the cells
+// form the graph traversed by getVolumeMoments. A mesh is built once
+// through one of the from* functions, which also record how long the
+// setup took, and can then be passed to any of the distribution
+// functions in irl_gvm_distribution.h. Since the links point to each
+// other and to the localizers, meshes can be moved but not copied.
+// A built mesh is only read during distribution, so it can be shared
+// between threads.
+
+#ifndef SRC_IRL_GVM_LOCALIZER_MESH_H_
+#define SRC_IRL_GVM_LOCALIZER_MESH_H_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// Timing IRL GVM directory
+#include "src/irl_gvm/compact_mesh.h"
+
+// IRL source directory
+#include "src/geometry/general/pt.h"
+#include "src/graphs/localizer_link.h"
+#include "src/planar_reconstruction/planar_localizer.h"
+
+class LocalizerMesh {
+ public:
+  // Cartesian mesh of a_ncells cells covering the box between the two
+  // bounding points.
+  static LocalizerMesh fromCubic(const std::array<IRL::Pt, 2>& a_bounding_pts,
+                                 const std::array<int, 3>& a_ncells);
+
+  // A cuboid decomposed into 24 tets using the face centroids and the
+  // cell center.
+  static LocalizerMesh fromTet(const std::array<IRL::Pt, 2>& a_bounding_pts);
+
+  // Sphere of radius a_radius around the origin, split into a_radial_cells
+  // shells. The innermost shell is a single convex cell with one plane per
+  // angular sector, and every other shell is split into a_theta_cells x
+  // a_phi_cells cells in (theta, phi). a_theta_cells must be at least 3.
+  static LocalizerMesh fromSphericalCartesian(const double a_radius,
+                                              const int a_radial_cells,
+                                              const int a_theta_cells,
+                                              const int a_phi_cells);
+
+  // LocalizerLink view of a_compact_mesh, with one localizer per cell
+  // holding its face planes and links connected through the face
+  // neighbors. Cartesian meshes find seed cells as fromCubic does, and
+  // tet meshes as fromTet does. Built with all OpenMP threads, apart from
+  // the seed lookup grid of tet meshes; the setup time is the time of the
+  // conversion only.
+  static LocalizerMesh fromCompact(const CompactMesh& a_compact_mesh);
+
+  LocalizerMesh(LocalizerMesh&& a_other) = default;
+  LocalizerMesh& operator=(LocalizerMesh&& a_other) = default;
+  LocalizerMesh(const LocalizerMesh& a_other) = delete;
+  LocalizerMesh& operator=(const LocalizerMesh& a_other) = delete;
+
+  int getNumberOfCells(void) const {
+    return static_cast<int>(links_m.size());
+  }
+
+  // Link of cell a_index. The link Id is the cell index, so volumes
+  // returned by getVolumeMoments are tagged with it.
+  const IRL::LocalizerLink& getLink(const int a_index) const {
+    return links_m[a_index];
+  }
+
+  // Planes bounding cell a_index
+  const IRL::PlanarLocalizer& getLocalizer(const int a_index) const {
+    return localizers_m[a_index];
+  }
+
+  // Link of the cell holding a_pt, to start distributing a polyhedron
+  // centered on a_pt from. This is found by a floor lookup on Cartesian
+  // meshes, a uniform grid of candidate cells on tet meshes, and the
+  // angular sector and shell on spherical meshes. Points outside the mesh
+  // get a nearby cell.
+  const IRL::LocalizerLink& getSeedLink(const IRL::Pt& a_pt) const;
+
+  // Link distribution started from before seed lookup was added: the
+  // middle cell of Cartesian meshes and the first cell otherwise.
+  const IRL::LocalizerLink& getFixedSeedLink(void) const;
+
+  // Wall time in seconds taken to build the mesh
+  double getSetupTime(void) const { return setup_time_m; }
+
+  // Bytes held by the localizers, links and seed lookup of the mesh
+  std::size_t getMemoryFootprint(void) const;
+
+ private:
+  enum class MeshType { CUBIC, TET, SPHERICAL_CARTESIAN };
+
+  explicit LocalizerMesh(const MeshType a_type);
+
+  // Bins the cells, given by their bounding boxes, into a uniform grid
+  // over bounding_pts_m holding roughly one cell per bin.
+  void buildPointIndex(
+      const std::vector<std::array<IRL::Pt, 2>>& a_cell_boxes);
+
+  // Cell holding a_pt found through the uniform grid
+  int locateInPointIndex(const IRL::Pt& a_pt) const;
+
+  // Cell holding a_pt on a SPHERICAL_CARTESIAN mesh
+  int locateInShells(const IRL::Pt& a_pt) const;
+
+  MeshType type_m;
+  std::vector<IRL::PlanarLocalizer> localizers_m;
+  std::vector<IRL::LocalizerLink> links_m;
+  // Box covered by CUBIC and TET meshes
+  std::array<IRL::Pt, 2> bounding_pts_m;
+  // Cells per direction for CUBIC meshes, or radial, theta and phi cells
+  // for SPHERICAL_CARTESIAN meshes
+  std::array<int, 3> ncells_m;
+  // Uniform grid for TET meshes, with the cells of bin b stored in
+  // bin_cells_m[bin_offsets_m[b]] to bin_cells_m[bin_offsets_m[b + 1] - 1]
+  std::array<int, 3> bins_m;
+  std::vector<int> bin_offsets_m;
+  std::vector<int> bin_cells_m;
+  // Radial width of each SPHERICAL_CARTESIAN shell
+  double shell_width_m;
+  double setup_time_m;
+};
+
+#endif  // SRC_IRL_GVM_LOCALIZER_MESH_H_
@@ -0,0 +1,55 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Counters gathered while distributing a polyhedron over the graph of a
+// LocalizerMesh. They are only collected when IRL_GVM_TRAVERSAL_STATS is
+// defined to a nonzero value (cmake -DTRAVERSAL_STATS=ON). Otherwise
+// kCollectTraversalStats is false, every counting branch is removed at
+// compile time, and the instrumented distribution is not run at all.
+
+#ifndef SRC_IRL_GVM_TRAVERSAL_STATS_H_
+#define SRC_IRL_GVM_TRAVERSAL_STATS_H_
+
+#include <algorithm>
+#include <cstddef>
+
+#ifndef IRL_GVM_TRAVERSAL_STATS
+#define IRL_GVM_TRAVERSAL_STATS 0
+#endif
+
+static constexpr bool kCollectTraversalStats = IRL_GVM_TRAVERSAL_STATS != 0;
+
+struct TraversalStats {
+  // Pieces of the polyhedron taken off the stack, each inside one link
+  std::size_t links_visited = 0;
+  // Visited links whose piece was clipped away to nothing
+  std::size_t empty_links = 0;
+  // Link planes the piece was split or truncated by
+  std::size_t planes_tested = 0;
+  // Planes that cut the piece, leaving polytope on both sides
+  std::size_t truncations = 0;
+  // Largest number of pieces waiting on the stack
+  std::size_t max_stack_depth = 0;
+  // Largest number of bytes reserved by the stack
+  std::size_t peak_scratch_bytes = 0;
+
+  // Sums the counts and keeps the larger of the peaks
+  TraversalStats& operator+=(const TraversalStats& a_other) {
+    links_visited += a_other.links_visited;
+    empty_links += a_other.empty_links;
+    planes_tested += a_other.planes_tested;
+    truncations += a_other.truncations;
+    max_stack_depth = std::max(max_stack_depth, a_other.max_stack_depth);
+    peak_scratch_bytes =
+        std::max(peak_scratch_bytes, a_other.peak_scratch_bytes);
+    return *this;
+  }
+};
+
+#endif  // SRC_IRL_GVM_TRAVERSAL_STATS_H_
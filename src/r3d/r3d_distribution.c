@@ -0,0 +1,116 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/r3d/r3d_distribution.h"
+
+#include <omp.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// R3D Include files
+#include "r3d.h"
+#include "v3d.h"
+
+#include "src/r3d/r3d_face_tables.h"
+
+static r3d_int r3d_clamp_index(const r3d_int a_index, const int a_ncells) {
+  return a_index < 0 ? 0 : (a_index >= a_ncells ? a_ncells - 1 : a_index);
+}
+
+// Voxelizes a_poly, already shifted so the mesh starts at the origin,
+// and adds the volume of each voxel to its mesh cell.
+static void r3d_voxelize_onto_mesh(r3d_poly *a_poly,
+                                   const double *a_mesh_bounds,
+                                   const int *a_ncells,
+                                   double *a_cell_volumes, double *a_volume,
+                                   size_t *a_entered_cells) {
+  r3d_rvec3 d;
+  for(r3d_int n = 0; n < 3; ++n){
+    d.xyz[n] = (a_mesh_bounds[3+n] - a_mesh_bounds[n]) / (double)a_ncells[n];
+  }
+  r3d_dvec3 ibox[2];
+  r3d_get_ibox(a_poly, ibox, d);
+  const r3d_int ni = ibox[1].i - ibox[0].i;
+  const r3d_int nj = ibox[1].j - ibox[0].j;
+  const r3d_int nk = ibox[1].k - ibox[0].k;
+  // R3D orders its buffer with k fastest
+  double *grid = calloc((size_t)ni*nj*nk, sizeof(double));
+  if(grid == NULL){
+    fprintf(stderr, "Could not allocate %d x %d x %d voxel buffer\n",
+            (int)ni, (int)nj, (int)nk);
+    exit(-1);
+  }
+  r3d_voxelize(a_poly, ibox, grid, d, 0);
+
+  *a_volume = 0.0;
+  *a_entered_cells = 0;
+  for(r3d_int i = 0; i < ni; ++i){
+    const r3d_int ci = r3d_clamp_index(ibox[0].i + i, a_ncells[0]);
+    for(r3d_int j = 0; j < nj; ++j){
+      const r3d_int cj = r3d_clamp_index(ibox[0].j + j, a_ncells[1]);
+      for(r3d_int k = 0; k < nk; ++k){
+        const double volume = grid[(i*nj + j)*nk + k];
+        if(volume != 0.0){
+          const r3d_int ck = r3d_clamp_index(ibox[0].k + k, a_ncells[2]);
+          a_cell_volumes[ci + cj*a_ncells[0] + ck*a_ncells[0]*a_ncells[1]] +=
+              volume;
+          *a_volume += volume;
+          ++(*a_entered_cells);
+        }
+      }
+    }
+  }
+  free(grid);
+}
+
+void r3d_cubeOntoCartesianMesh(const double *a_cube_pts,
+                               const double *a_mesh_bounds,
+                               const int *a_ncells, double *a_cell_volumes,
+                               double *a_volume, double *a_times,
+                               size_t *a_entered_cells) {
+  double start = omp_get_wtime();
+  r3d_rvec3 pts[2];
+  for(r3d_int n = 0; n < 3; ++n){
+    pts[0].xyz[n] = a_cube_pts[n] - a_mesh_bounds[n];
+    pts[1].xyz[n] = a_cube_pts[3+n] - a_mesh_bounds[n];
+  }
+  r3d_poly poly;
+  r3d_init_box(&poly, pts);
+  r3d_voxelize_onto_mesh(&poly, a_mesh_bounds, a_ncells, a_cell_volumes,
+                         a_volume, a_entered_cells);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+}
+
+void r3d_stelIcosahedronOntoCartesianMesh(
+    const double *a_stel_icosahedron_pts, const double *a_mesh_bounds,
+    const int *a_ncells, double *a_cell_volumes, double *a_volume,
+    double *a_times, size_t *a_entered_cells) {
+  double start = omp_get_wtime();
+  r3d_rvec3 verts[32];
+  for(r3d_int p = 0; p < 32; ++p){
+    for(r3d_int n = 0; n < 3; ++n){
+      verts[p].xyz[n] = a_stel_icosahedron_pts[p*3+n] - a_mesh_bounds[n];
+    }
+  }
+  // Face index arrays point into the shared face table
+  r3d_int *faces[60];
+  r3d_int ind = 0;
+  for(r3d_int f = 0; f < 60; ++f){
+    faces[f] = r3d_stel_icosahedron_face_flat + ind;
+    ind += r3d_stel_icosahedron_verts_per_face[f];
+  }
+  r3d_poly poly;
+  r3d_init_poly(&poly, verts, 32, faces, r3d_stel_icosahedron_verts_per_face,
+                60);
+  r3d_voxelize_onto_mesh(&poly, a_mesh_bounds, a_ncells, a_cell_volumes,
+                         a_volume, a_entered_cells);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+}
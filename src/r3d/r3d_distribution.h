@@ -0,0 +1,42 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Distribution of a polyhedron onto a structured Cartesian mesh with
+// r3d_voxelize, which recursively splits the polyhedron along the grid
+// lines of the box of cells it covers. Arguments are the same as in
+// slab_distribution.h: the mesh covers the box between a_mesh_bounds[0:3]
+// and a_mesh_bounds[3:6] with a_ncells[0:3] cells per direction, indexed
+// i + j * a_ncells[0] + k * a_ncells[0] * a_ncells[1], and the volume in
+// each cell is added to a_cell_volumes. R3D places its grid at the origin,
+// so the polyhedron is shifted by the lower mesh corner, and any volume
+// outside the mesh is kept in the boundary cells. The number of cells
+// entered is the number of cells given a nonzero volume, and only the
+// total time, including building the r3d_poly and the voxel buffer, is
+// recorded in a_times[0].
+
+#ifndef SRC_R3D_R3D_DISTRIBUTION_H_
+#define SRC_R3D_R3D_DISTRIBUTION_H_
+
+#include <stddef.h>
+
+// Distribute a Cube, given as lower and upper bounding box points,
+// onto a Cartesian Mesh
+void r3d_cubeOntoCartesianMesh(const double *a_cube_pts,
+                               const double *a_mesh_bounds,
+                               const int *a_ncells, double *a_cell_volumes,
+                               double *a_volume, double *a_times,
+                               size_t *a_entered_cells);
+
+// Distribute a Stellated Icosahedron onto a Cartesian Mesh
+void r3d_stelIcosahedronOntoCartesianMesh(
+    const double *a_stel_icosahedron_pts, const double *a_mesh_bounds,
+    const int *a_ncells, double *a_cell_volumes, double *a_volume,
+    double *a_times, size_t *a_entered_cells);
+
+#endif  // SRC_R3D_R3D_DISTRIBUTION_H_
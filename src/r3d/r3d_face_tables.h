@@ -0,0 +1,47 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Full BREPs for the shapes built with r3d_init_poly, shared by the
+// prototype intersections and the distribution tests. Each face lists
+// its vertex indices in r3d_<shape>_face_flat, and the number of
+// vertices of each face is in r3d_<shape>_verts_per_face. The
+// tables are not const since r3d_init_poly does not take const
+// pointers, but they are never written to.
+
+#ifndef SRC_R3D_R3D_FACE_TABLES_H_
+#define SRC_R3D_R3D_FACE_TABLES_H_
+
+// R3D Include file
+#include "r3d.h"
+
+// Triangulated Triangular Prism
+extern r3d_int r3d_tri_prism_face_flat[24];
+extern r3d_int r3d_tri_prism_verts_per_face[8];
+
+// Triangulated Hexahedron
+extern r3d_int r3d_tri_hex_face_flat[36];
+extern r3d_int r3d_tri_hex_verts_per_face[12];
+
+// Symmetric Triangular Prism
+extern r3d_int r3d_sym_prism_face_flat[54];
+extern r3d_int r3d_sym_prism_verts_per_face[18];
+
+// Symmetric Hexahedron
+extern r3d_int r3d_sym_hex_face_flat[72];
+extern r3d_int r3d_sym_hex_verts_per_face[24];
+
+// Stellated Dodecahedron
+extern r3d_int r3d_stel_dodecahedron_face_flat[180];
+extern r3d_int r3d_stel_dodecahedron_verts_per_face[60];
+
+// Stellated Icosahedron
+extern r3d_int r3d_stel_icosahedron_face_flat[180];
+extern r3d_int r3d_stel_icosahedron_verts_per_face[60];
+
+#endif  // SRC_R3D_R3D_FACE_TABLES_H_
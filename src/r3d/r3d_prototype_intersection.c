@@ -0,0 +1,509 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/r3d/r3d_prototype_intersection.h"
+
+#include <assert.h>
+#include <omp.h>
+#include <string.h>
+
+// R3D Include file
+#include "r3d.h"
+
+#include "src/r3d/r3d_face_tables.h"
+#include "src/r3d/r3d_intersection.h"
+
+// An r3d_poly built once, along with the point each of its
+// vertices was created from.
+typedef struct {
+  r3d_poly poly;
+  r3d_int point_of_vertex[R3D_MAX_VERTS];
+  int initialized;
+} r3d_prototype;
+
+// Prototypes of each shape, built by r3d_prototype_initialize
+static r3d_prototype prism_prototype, unit_cube_prototype,
+  tri_prism_prototype, tri_hex_prototype, sym_prism_prototype,
+  sym_hex_prototype, stel_dodecahedron_prototype,
+  stel_icosahedron_prototype;
+
+// Fixed and pairwise distinct points, one per BREP vertex, that the
+// prototypes are built from. Only the connectivity of a prototype is
+// kept, as the vertex positions are set when it is cloned.
+static void r3d_prototype_canonical_pts(const r3d_int a_npts,
+					r3d_rvec3 *a_verts) {
+  for(r3d_int p = 0; p < a_npts; ++p){
+    a_verts[p].x = (r3d_real)p;
+    a_verts[p].y = (r3d_real)(p*p);
+    a_verts[p].z = (r3d_real)(p*p*p);
+  }
+}
+
+// Record which of the a_npts points each prototype vertex sits on.
+// Vertices R3D duplicated for points of degree > 3 share a point. The
+// points must be pairwise distinct for the match to be unambiguous.
+static void r3d_prototype_set_point_map(r3d_prototype *a_prototype,
+					const r3d_rvec3 *a_pts,
+					const r3d_int a_npts) {
+  for(r3d_int v = 0; v < a_prototype->poly.nverts; ++v){
+    a_prototype->point_of_vertex[v] = -1;
+    for(r3d_int p = 0; p < a_npts; ++p){
+      if(a_prototype->poly.verts[v].pos.x == a_pts[p].x &&
+	 a_prototype->poly.verts[v].pos.y == a_pts[p].y &&
+	 a_prototype->poly.verts[v].pos.z == a_pts[p].z){
+	a_prototype->point_of_vertex[v] = p;
+	break;
+      }
+    }
+    assert(a_prototype->point_of_vertex[v] >= 0);
+  }
+  a_prototype->initialized = 1;
+}
+
+// Build prototype from a BREP at the canonical points, with face index
+// arrays pointing into the face tables in r3d_face_tables.h so nothing
+// is allocated.
+static void r3d_prototype_init_poly(r3d_prototype *a_prototype,
+				    const r3d_int a_nvert,
+				    r3d_int *a_face_flat,
+				    r3d_int *a_verts_per_face,
+				    const r3d_int a_nface) {
+  r3d_rvec3 pts[a_nvert];
+  r3d_prototype_canonical_pts(a_nvert, pts);
+  r3d_int *faces[a_nface];
+  r3d_int ind = 0;
+  for(r3d_int f = 0; f < a_nface; ++f){
+    faces[f] = a_face_flat + ind;
+    ind += a_verts_per_face[f];
+  }
+  r3d_init_poly(&a_prototype->poly, pts, a_nvert, faces, a_verts_per_face,
+		a_nface);
+  r3d_prototype_set_point_map(a_prototype, pts, a_nvert);
+}
+
+// Copy the prototype into a_poly and move its vertices to a_pts
+static void r3d_prototype_clone(const r3d_prototype *a_prototype,
+				const r3d_rvec3 *a_pts, r3d_poly *a_poly) {
+  assert(a_prototype->initialized);
+  const r3d_int nverts = a_prototype->poly.nverts;
+  memcpy(a_poly->verts, a_prototype->poly.verts, nverts*sizeof(r3d_vertex));
+  a_poly->nverts = nverts;
+  for(r3d_int v = 0; v < nverts; ++v){
+    a_poly->verts[v].pos = a_pts[a_prototype->point_of_vertex[v]];
+  }
+}
+
+static void r3d_prototype_copy_pts(const double *a_pts, const r3d_int a_npts,
+				   r3d_rvec3 *a_verts) {
+  for(r3d_int p = 0; p < a_npts; ++p){
+    for(r3d_int d = 0; d < 3; ++d){
+      a_verts[p].xyz[d] = a_pts[p*3+d];
+    }
+  }
+}
+
+// Expand lower/upper bounding points to the 8 box vertices
+static void r3d_prototype_copy_box_pts(const double *a_cube_pts,
+				       r3d_rvec3 *a_verts) {
+  for(r3d_int p = 0; p < 8; ++p){
+    for(r3d_int d = 0; d < 3; ++d){
+      a_verts[p].xyz[d] = a_cube_pts[((p >> d) & 1)*3+d];
+    }
+  }
+}
+
+// Clip and reduce clone of a_prototype, timing each section.
+static void r3d_prototype_clip(const r3d_prototype *a_prototype,
+			       const r3d_rvec3 *a_verts,
+			       const int a_number_of_planes,
+			       const double *a_planes, double *a_volume,
+			       double *a_times) {
+  // Multiply normal by -1.0 due to difference in convention.
+  // Makes consistent with IRL convention
+  r3d_plane planes[a_number_of_planes];
+  for(r3d_int n = 0; n < a_number_of_planes; ++n){
+    planes[n].n.x = -a_planes[n*4+0];
+    planes[n].n.y = -a_planes[n*4+1];
+    planes[n].n.z = -a_planes[n*4+2];
+    planes[n].d = a_planes[n*4+3];
+  }
+
+  double start = omp_get_wtime();
+  r3d_poly poly;
+  r3d_prototype_clone(a_prototype, a_verts, &poly);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+
+  start = omp_get_wtime();
+  r3d_clip(&poly, planes, a_number_of_planes);
+  end = omp_get_wtime();
+  a_times[1] = end-start;
+
+  start = omp_get_wtime();
+  r3d_reduce(&poly, a_volume, 0);
+  end = omp_get_wtime();
+  a_times[2] = end-start;
+}
+
+// Same as above, but only total timed for less overhead
+static void r3d_prototype_clip_total(const r3d_prototype *a_prototype,
+				     const r3d_rvec3 *a_verts,
+				     const int a_number_of_planes,
+				     const double *a_planes, double *a_volume,
+				     double *a_times) {
+  // Multiply normal by -1.0 due to difference in convention.
+  // Makes consistent with IRL convention
+  r3d_plane planes[a_number_of_planes];
+  for(r3d_int n = 0; n < a_number_of_planes; ++n){
+    planes[n].n.x = -a_planes[n*4+0];
+    planes[n].n.y = -a_planes[n*4+1];
+    planes[n].n.z = -a_planes[n*4+2];
+    planes[n].d = a_planes[n*4+3];
+  }
+
+  double start = omp_get_wtime();
+  r3d_poly poly;
+  r3d_prototype_clone(a_prototype, a_verts, &poly);
+  r3d_clip(&poly, planes, a_number_of_planes);
+  r3d_reduce(&poly, a_volume, 0);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+}
+
+// Split a clone of a_prototype by each plane in turn, keeping the part
+// below the plane in the other of two buffers, timing the total.
+static void r3d_prototype_split(const r3d_prototype *a_prototype,
+				const r3d_rvec3 *a_verts,
+				const int a_number_of_planes,
+				const double *a_planes, double *a_volumes,
+				double *a_times) {
+  // Multiply normal by -1.0 due to difference in convention.
+  // Makes consistent with IRL convention
+  r3d_plane planes[a_number_of_planes];
+  for(r3d_int n = 0; n < a_number_of_planes; ++n){
+    planes[n].n.x = -a_planes[n*4+0];
+    planes[n].n.y = -a_planes[n*4+1];
+    planes[n].n.z = -a_planes[n*4+2];
+    planes[n].d = a_planes[n*4+3];
+  }
+
+  double start = omp_get_wtime();
+  r3d_poly polys[2];
+  r3d_poly above;
+  r3d_int below = 0;
+  r3d_prototype_clone(a_prototype, a_verts, &polys[below]);
+  a_volumes[1] = 0.0;
+  for(r3d_int n = 0; n < a_number_of_planes; ++n){
+    // R3D keeps the positive side, which is below the plane in IRL
+    // convention
+    r3d_split(&polys[below], 1, planes[n], &polys[1-below], &above);
+    below = 1-below;
+    r3d_real volume;
+    r3d_reduce(&above, &volume, 0);
+    a_volumes[1] += volume;
+    if(polys[below].nverts == 0){
+      break;
+    }
+  }
+  r3d_reduce(&polys[below], &a_volumes[0], 0);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+}
+
+void r3d_prototype_initialize(void) {
+  r3d_rvec3 verts[8];
+  r3d_prototype_canonical_pts(6, verts);
+  r3d_init_prism(&prism_prototype.poly, verts);
+  r3d_prototype_set_point_map(&prism_prototype, verts, 6);
+
+  const double cube_pts[6] = {0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+  r3d_prototype_copy_box_pts(cube_pts, verts);
+  r3d_rvec3 bounds[2] = {verts[0], verts[7]};
+  r3d_init_box(&unit_cube_prototype.poly, bounds);
+  r3d_prototype_set_point_map(&unit_cube_prototype, verts, 8);
+
+  r3d_prototype_init_poly(&tri_prism_prototype, 6, r3d_tri_prism_face_flat,
+			  r3d_tri_prism_verts_per_face, 8);
+  r3d_prototype_init_poly(&tri_hex_prototype, 8, r3d_tri_hex_face_flat,
+			  r3d_tri_hex_verts_per_face, 12);
+  r3d_prototype_init_poly(&sym_prism_prototype, 11, r3d_sym_prism_face_flat,
+			  r3d_sym_prism_verts_per_face, 18);
+  r3d_prototype_init_poly(&sym_hex_prototype, 14, r3d_sym_hex_face_flat,
+			  r3d_sym_hex_verts_per_face, 24);
+  r3d_prototype_init_poly(&stel_dodecahedron_prototype, 32,
+			  r3d_stel_dodecahedron_face_flat,
+			  r3d_stel_dodecahedron_verts_per_face, 60);
+  r3d_prototype_init_poly(&stel_icosahedron_prototype, 32,
+			  r3d_stel_icosahedron_face_flat,
+			  r3d_stel_icosahedron_verts_per_face, 60);
+}
+
+void r3d_prototype_prismByPlanes(const double *a_prism_pts,
+                                 const int a_number_of_planes,
+                                 const double *a_planes, double *a_volume,
+                                 double *a_times) {
+  r3d_rvec3 verts[6];
+  r3d_prototype_copy_pts(a_prism_pts, 6, verts);
+  const r3d_prototype *prototype = &prism_prototype;
+  r3d_prototype_clip(prototype, verts, a_number_of_planes, a_planes,
+                     a_volume, a_times);
+}
+
+void r3d_prototype_unitCubeByPlanes(const double *a_cube_pts,
+                                    const int a_number_of_planes,
+                                    const double *a_planes, double *a_volume,
+                                    double *a_times) {
+  r3d_rvec3 verts[8];
+  r3d_prototype_copy_box_pts(a_cube_pts, verts);
+  const r3d_prototype *prototype = &unit_cube_prototype;
+  r3d_prototype_clip(prototype, verts, a_number_of_planes, a_planes,
+                     a_volume, a_times);
+}
+
+void r3d_prototype_triPrismByPlanes(const double *a_tri_prism_pts,
+                                    const int a_number_of_planes,
+                                    const double *a_planes, double *a_volume,
+                                    double *a_times) {
+  r3d_rvec3 verts[6];
+  r3d_prototype_copy_pts(a_tri_prism_pts, 6, verts);
+  const r3d_prototype *prototype = &tri_prism_prototype;
+  r3d_prototype_clip(prototype, verts, a_number_of_planes, a_planes,
+                     a_volume, a_times);
+}
+
+void r3d_prototype_triHexByPlanes(const double *a_tri_hex_pts,
+                                  const int a_number_of_planes,
+                                  const double *a_planes, double *a_volume,
+                                  double *a_times) {
+  r3d_rvec3 verts[8];
+  r3d_prototype_copy_pts(a_tri_hex_pts, 8, verts);
+  const r3d_prototype *prototype = &tri_hex_prototype;
+  r3d_prototype_clip(prototype, verts, a_number_of_planes, a_planes,
+                     a_volume, a_times);
+}
+
+void r3d_prototype_symPrismByPlanes(const double *a_sym_prism_pts,
+                                    const int a_number_of_planes,
+                                    const double *a_planes, double *a_volume,
+                                    double *a_times) {
+  r3d_rvec3 verts[11];
+  r3d_prototype_copy_pts(a_sym_prism_pts, 11, verts);
+  const r3d_prototype *prototype = &sym_prism_prototype;
+  r3d_prototype_clip(prototype, verts, a_number_of_planes, a_planes,
+                     a_volume, a_times);
+}
+
+void r3d_prototype_symHexByPlanes(const double *a_sym_hex_pts,
+                                  const int a_number_of_planes,
+                                  const double *a_planes, double *a_volume,
+                                  double *a_times) {
+  r3d_rvec3 verts[14];
+  r3d_prototype_copy_pts(a_sym_hex_pts, 14, verts);
+  const r3d_prototype *prototype = &sym_hex_prototype;
+  r3d_prototype_clip(prototype, verts, a_number_of_planes, a_planes,
+                     a_volume, a_times);
+}
+
+void r3d_prototype_stelDodecahedronByPlanes(const double *a_stel_dodecahedron_pts,
+                                            const int a_number_of_planes,
+                                            const double *a_planes, double *a_volume,
+                                            double *a_times) {
+  r3d_rvec3 verts[32];
+  r3d_prototype_copy_pts(a_stel_dodecahedron_pts, 32, verts);
+  const r3d_prototype *prototype = &stel_dodecahedron_prototype;
+  r3d_prototype_clip(prototype, verts, a_number_of_planes, a_planes,
+                     a_volume, a_times);
+}
+
+void r3d_prototype_stelIcosahedronByPlanes(const double *a_stel_icosahedron_pts,
+                                           const int a_number_of_planes,
+                                           const double *a_planes, double *a_volume,
+                                           double *a_times) {
+  r3d_rvec3 verts[32];
+  r3d_prototype_copy_pts(a_stel_icosahedron_pts, 32, verts);
+  const r3d_prototype *prototype = &stel_icosahedron_prototype;
+  r3d_prototype_clip(prototype, verts, a_number_of_planes, a_planes,
+                     a_volume, a_times);
+}
+
+void r3d_prototype_prismByPlanes_total(const double *a_prism_pts,
+                                       const int a_number_of_planes,
+                                       const double *a_planes, double *a_volume,
+                                       double *a_times) {
+  r3d_rvec3 verts[6];
+  r3d_prototype_copy_pts(a_prism_pts, 6, verts);
+  const r3d_prototype *prototype = &prism_prototype;
+  r3d_prototype_clip_total(prototype, verts, a_number_of_planes, a_planes,
+                           a_volume, a_times);
+}
+
+void r3d_prototype_unitCubeByPlanes_total(const double *a_cube_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes, double *a_volume,
+                                          double *a_times) {
+  r3d_rvec3 verts[8];
+  r3d_prototype_copy_box_pts(a_cube_pts, verts);
+  const r3d_prototype *prototype = &unit_cube_prototype;
+  r3d_prototype_clip_total(prototype, verts, a_number_of_planes, a_planes,
+                           a_volume, a_times);
+}
+
+void r3d_prototype_triPrismByPlanes_total(const double *a_tri_prism_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes, double *a_volume,
+                                          double *a_times) {
+  r3d_rvec3 verts[6];
+  r3d_prototype_copy_pts(a_tri_prism_pts, 6, verts);
+  const r3d_prototype *prototype = &tri_prism_prototype;
+  r3d_prototype_clip_total(prototype, verts, a_number_of_planes, a_planes,
+                           a_volume, a_times);
+}
+
+void r3d_prototype_triHexByPlanes_total(const double *a_tri_hex_pts,
+                                        const int a_number_of_planes,
+                                        const double *a_planes, double *a_volume,
+                                        double *a_times) {
+  r3d_rvec3 verts[8];
+  r3d_prototype_copy_pts(a_tri_hex_pts, 8, verts);
+  const r3d_prototype *prototype = &tri_hex_prototype;
+  r3d_prototype_clip_total(prototype, verts, a_number_of_planes, a_planes,
+                           a_volume, a_times);
+}
+
+void r3d_prototype_symPrismByPlanes_total(const double *a_sym_prism_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes, double *a_volume,
+                                          double *a_times) {
+  r3d_rvec3 verts[11];
+  r3d_prototype_copy_pts(a_sym_prism_pts, 11, verts);
+  const r3d_prototype *prototype = &sym_prism_prototype;
+  r3d_prototype_clip_total(prototype, verts, a_number_of_planes, a_planes,
+                           a_volume, a_times);
+}
+
+void r3d_prototype_symHexByPlanes_total(const double *a_sym_hex_pts,
+                                        const int a_number_of_planes,
+                                        const double *a_planes, double *a_volume,
+                                        double *a_times) {
+  r3d_rvec3 verts[14];
+  r3d_prototype_copy_pts(a_sym_hex_pts, 14, verts);
+  const r3d_prototype *prototype = &sym_hex_prototype;
+  r3d_prototype_clip_total(prototype, verts, a_number_of_planes, a_planes,
+                           a_volume, a_times);
+}
+
+void r3d_prototype_stelDodecahedronByPlanes_total(const double *a_stel_dodecahedron_pts,
+                                                  const int a_number_of_planes,
+                                                  const double *a_planes, double *a_volume,
+                                                  double *a_times) {
+  r3d_rvec3 verts[32];
+  r3d_prototype_copy_pts(a_stel_dodecahedron_pts, 32, verts);
+  const r3d_prototype *prototype = &stel_dodecahedron_prototype;
+  r3d_prototype_clip_total(prototype, verts, a_number_of_planes, a_planes,
+                           a_volume, a_times);
+}
+
+void r3d_prototype_stelIcosahedronByPlanes_total(const double *a_stel_icosahedron_pts,
+                                                 const int a_number_of_planes,
+                                                 const double *a_planes, double *a_volume,
+                                                 double *a_times) {
+  r3d_rvec3 verts[32];
+  r3d_prototype_copy_pts(a_stel_icosahedron_pts, 32, verts);
+  const r3d_prototype *prototype = &stel_icosahedron_prototype;
+  r3d_prototype_clip_total(prototype, verts, a_number_of_planes, a_planes,
+                           a_volume, a_times);
+}
+
+void r3d_prototype_prismBySplit(const double *a_prism_pts,
+                                const int a_number_of_planes,
+                                const double *a_planes, double *a_volumes,
+                                double *a_times) {
+  r3d_rvec3 verts[6];
+  r3d_prototype_copy_pts(a_prism_pts, 6, verts);
+  const r3d_prototype *prototype = &prism_prototype;
+  r3d_prototype_split(prototype, verts, a_number_of_planes, a_planes,
+                      a_volumes, a_times);
+}
+
+void r3d_prototype_unitCubeBySplit(const double *a_cube_pts,
+                                   const int a_number_of_planes,
+                                   const double *a_planes, double *a_volumes,
+                                   double *a_times) {
+  r3d_rvec3 verts[8];
+  r3d_prototype_copy_box_pts(a_cube_pts, verts);
+  const r3d_prototype *prototype = &unit_cube_prototype;
+  r3d_prototype_split(prototype, verts, a_number_of_planes, a_planes,
+                      a_volumes, a_times);
+}
+
+void r3d_prototype_triPrismBySplit(const double *a_tri_prism_pts,
+                                   const int a_number_of_planes,
+                                   const double *a_planes, double *a_volumes,
+                                   double *a_times) {
+  r3d_rvec3 verts[6];
+  r3d_prototype_copy_pts(a_tri_prism_pts, 6, verts);
+  const r3d_prototype *prototype = &tri_prism_prototype;
+  r3d_prototype_split(prototype, verts, a_number_of_planes, a_planes,
+                      a_volumes, a_times);
+}
+
+void r3d_prototype_triHexBySplit(const double *a_tri_hex_pts,
+                                 const int a_number_of_planes,
+                                 const double *a_planes, double *a_volumes,
+                                 double *a_times) {
+  r3d_rvec3 verts[8];
+  r3d_prototype_copy_pts(a_tri_hex_pts, 8, verts);
+  const r3d_prototype *prototype = &tri_hex_prototype;
+  r3d_prototype_split(prototype, verts, a_number_of_planes, a_planes,
+                      a_volumes, a_times);
+}
+
+void r3d_prototype_symPrismBySplit(const double *a_sym_prism_pts,
+                                   const int a_number_of_planes,
+                                   const double *a_planes, double *a_volumes,
+                                   double *a_times) {
+  r3d_rvec3 verts[11];
+  r3d_prototype_copy_pts(a_sym_prism_pts, 11, verts);
+  const r3d_prototype *prototype = &sym_prism_prototype;
+  r3d_prototype_split(prototype, verts, a_number_of_planes, a_planes,
+                      a_volumes, a_times);
+}
+
+void r3d_prototype_symHexBySplit(const double *a_sym_hex_pts,
+                                 const int a_number_of_planes,
+                                 const double *a_planes, double *a_volumes,
+                                 double *a_times) {
+  r3d_rvec3 verts[14];
+  r3d_prototype_copy_pts(a_sym_hex_pts, 14, verts);
+  const r3d_prototype *prototype = &sym_hex_prototype;
+  r3d_prototype_split(prototype, verts, a_number_of_planes, a_planes,
+                      a_volumes, a_times);
+}
+
+void r3d_prototype_stelDodecahedronBySplit(const double *a_stel_dodecahedron_pts,
+                                           const int a_number_of_planes,
+                                           const double *a_planes, double *a_volumes,
+                                           double *a_times) {
+  r3d_rvec3 verts[32];
+  r3d_prototype_copy_pts(a_stel_dodecahedron_pts, 32, verts);
+  const r3d_prototype *prototype = &stel_dodecahedron_prototype;
+  r3d_prototype_split(prototype, verts, a_number_of_planes, a_planes,
+                      a_volumes, a_times);
+}
+
+void r3d_prototype_stelIcosahedronBySplit(const double *a_stel_icosahedron_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes, double *a_volumes,
+                                          double *a_times) {
+  r3d_rvec3 verts[32];
+  r3d_prototype_copy_pts(a_stel_icosahedron_pts, 32, verts);
+  const r3d_prototype *prototype = &stel_icosahedron_prototype;
+  r3d_prototype_split(prototype, verts, a_number_of_planes, a_planes,
+                      a_volumes, a_times);
+}
@@ -0,0 +1,171 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Same intersections as in r3d_intersection.h, except that each shape's
+// r3d_poly is built once as a prototype from static face tables. Every
+// call then copies the prototype and only sets the vertex positions,
+// instead of allocating face arrays and running r3d_init_poly.
+
+#ifndef SRC_R3D_R3D_PROTOTYPE_INTERSECTION_H_
+#define SRC_R3D_R3D_PROTOTYPE_INTERSECTION_H_
+
+// Build the prototype of every shape. Must be called once, outside any
+// parallel region, before any of the functions below. The prototypes are
+// only read afterwards, so those functions may be called concurrently.
+void r3d_prototype_initialize(void);
+
+// Perform intersection of plane(s) with a Triangular Prism
+void r3d_prototype_prismByPlanes(const double *a_prism_pts,
+                                 const int a_number_of_planes,
+                                 const double *a_planes, double *a_volume,
+                                 double *a_times);
+
+// Perform intersection of plane(s) with a Unit Cube
+void r3d_prototype_unitCubeByPlanes(const double *a_cube_pts,
+                                    const int a_number_of_planes,
+                                    const double *a_planes, double *a_volume,
+                                    double *a_times);
+
+// Perform intersection of plane(s) with a Triangulated Triangular Prism
+void r3d_prototype_triPrismByPlanes(const double *a_tri_prism_pts,
+                                    const int a_number_of_planes,
+                                    const double *a_planes, double *a_volume,
+                                    double *a_times);
+
+// Perform intersection of plane(s) with a Triangulated Hexahedron
+void r3d_prototype_triHexByPlanes(const double *a_tri_hex_pts,
+                                  const int a_number_of_planes,
+                                  const double *a_planes, double *a_volume,
+                                  double *a_times);
+
+// Perform intersection of plane(s) with a Symmetric Triangular Prism
+void r3d_prototype_symPrismByPlanes(const double *a_sym_prism_pts,
+                                    const int a_number_of_planes,
+                                    const double *a_planes, double *a_volume,
+                                    double *a_times);
+
+// Perform intersection of plane(s) with a Symmetric Hexahedron
+void r3d_prototype_symHexByPlanes(const double *a_sym_hex_pts,
+                                  const int a_number_of_planes,
+                                  const double *a_planes, double *a_volume,
+                                  double *a_times);
+
+// Perform intersection of plane(s) with a Stellated Dodecahedron
+void r3d_prototype_stelDodecahedronByPlanes(const double *a_stel_dodecahedron_pts,
+                                            const int a_number_of_planes,
+                                            const double *a_planes, double *a_volume,
+                                            double *a_times);
+
+// Perform intersection of plane(s) with a Stellated Icosahedron
+void r3d_prototype_stelIcosahedronByPlanes(const double *a_stel_icosahedron_pts,
+                                           const int a_number_of_planes,
+                                           const double *a_planes, double *a_volume,
+                                           double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void r3d_prototype_prismByPlanes_total(const double *a_prism_pts,
+                                       const int a_number_of_planes,
+                                       const double *a_planes, double *a_volume,
+                                       double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void r3d_prototype_unitCubeByPlanes_total(const double *a_cube_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes, double *a_volume,
+                                          double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void r3d_prototype_triPrismByPlanes_total(const double *a_tri_prism_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes, double *a_volume,
+                                          double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void r3d_prototype_triHexByPlanes_total(const double *a_tri_hex_pts,
+                                        const int a_number_of_planes,
+                                        const double *a_planes, double *a_volume,
+                                        double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void r3d_prototype_symPrismByPlanes_total(const double *a_sym_prism_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes, double *a_volume,
+                                          double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void r3d_prototype_symHexByPlanes_total(const double *a_sym_hex_pts,
+                                        const int a_number_of_planes,
+                                        const double *a_planes, double *a_volume,
+                                        double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void r3d_prototype_stelDodecahedronByPlanes_total(const double *a_stel_dodecahedron_pts,
+                                                  const int a_number_of_planes,
+                                                  const double *a_planes, double *a_volume,
+                                                  double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void r3d_prototype_stelIcosahedronByPlanes_total(const double *a_stel_icosahedron_pts,
+                                                 const int a_number_of_planes,
+                                                 const double *a_planes, double *a_volume,
+                                                 double *a_times);
+
+// Split plane(s) through a clone of the prototype with r3d_split, which
+// returns both sides of a plane at once. The part above each plane is
+// added to a_volumes[1], and the part below goes on to the next plane,
+// ending as a_volumes[0]. Only the total is timed, in a_times[0].
+// Split a Triangular Prism by plane(s)
+void r3d_prototype_prismBySplit(const double *a_prism_pts,
+                                const int a_number_of_planes,
+                                const double *a_planes, double *a_volumes,
+                                double *a_times);
+
+// Split a Unit Cube by plane(s)
+void r3d_prototype_unitCubeBySplit(const double *a_cube_pts,
+                                   const int a_number_of_planes,
+                                   const double *a_planes, double *a_volumes,
+                                   double *a_times);
+
+// Split a Triangulated Triangular Prism by plane(s)
+void r3d_prototype_triPrismBySplit(const double *a_tri_prism_pts,
+                                   const int a_number_of_planes,
+                                   const double *a_planes, double *a_volumes,
+                                   double *a_times);
+
+// Split a Triangulated Hexahedron by plane(s)
+void r3d_prototype_triHexBySplit(const double *a_tri_hex_pts,
+                                 const int a_number_of_planes,
+                                 const double *a_planes, double *a_volumes,
+                                 double *a_times);
+
+// Split a Symmetric Triangular Prism by plane(s)
+void r3d_prototype_symPrismBySplit(const double *a_sym_prism_pts,
+                                   const int a_number_of_planes,
+                                   const double *a_planes, double *a_volumes,
+                                   double *a_times);
+
+// Split a Symmetric Hexahedron by plane(s)
+void r3d_prototype_symHexBySplit(const double *a_sym_hex_pts,
+                                 const int a_number_of_planes,
+                                 const double *a_planes, double *a_volumes,
+                                 double *a_times);
+
+// Split a Stellated Dodecahedron by plane(s)
+void r3d_prototype_stelDodecahedronBySplit(const double *a_stel_dodecahedron_pts,
+                                           const int a_number_of_planes,
+                                           const double *a_planes, double *a_volumes,
+                                           double *a_times);
+
+// Split a Stellated Icosahedron by plane(s)
+void r3d_prototype_stelIcosahedronBySplit(const double *a_stel_icosahedron_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes, double *a_volumes,
+                                          double *a_times);
+
+#endif // SRC_R3D_R3D_PROTOTYPE_INTERSECTION_H_
@@ -0,0 +1,307 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/slab_distribution/slab_distribution.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "src/tet_clip/tet_clip_shapes.h"
+
+namespace {
+
+using Vertex = std::array<double, 3>;
+
+// A tet of the signed decomposition of a polyhedron (see
+// tet_clip_shapes.h). Pieces cut from it keep its sign, so their
+// volume is a_sign times their unsigned volume.
+struct SignedTet {
+  std::array<Vertex, 4> pts;
+  double sign;
+};
+
+double signedTetVolume(const std::array<Vertex, 4>& a_tet) {
+  const Vertex a{{a_tet[1][0] - a_tet[0][0], a_tet[1][1] - a_tet[0][1],
+                  a_tet[1][2] - a_tet[0][2]}};
+  const Vertex b{{a_tet[2][0] - a_tet[0][0], a_tet[2][1] - a_tet[0][1],
+                  a_tet[2][2] - a_tet[0][2]}};
+  const Vertex c{{a_tet[3][0] - a_tet[0][0], a_tet[3][1] - a_tet[0][1],
+                  a_tet[3][2] - a_tet[0][2]}};
+  return (a[0] * (b[1] * c[2] - b[2] * c[1]) +
+          a[1] * (b[2] * c[0] - b[0] * c[2]) +
+          a[2] * (b[0] * c[1] - b[1] * c[0])) /
+         6.0;
+}
+
+// Appends the three tets of the triangular prism with bases a_a and a_b
+// and lateral edges a_a[n]-a_b[n].
+void appendPrism(const std::array<Vertex, 3>& a_a,
+                 const std::array<Vertex, 3>& a_b, const double a_sign,
+                 std::vector<SignedTet>* a_tets) {
+  a_tets->push_back(SignedTet{{{a_a[0], a_a[1], a_a[2], a_b[2]}}, a_sign});
+  a_tets->push_back(SignedTet{{{a_a[0], a_a[1], a_b[1], a_b[2]}}, a_sign});
+  a_tets->push_back(SignedTet{{{a_a[0], a_b[0], a_b[1], a_b[2]}}, a_sign});
+}
+
+// Splits every tet of a_tets by the plane x[a_dim] = a_position,
+// appending the pieces below it to a_below and above it to a_above.
+void splitTets(const std::vector<SignedTet>& a_tets, const int a_dim,
+               const double a_position, std::vector<SignedTet>* a_below,
+               std::vector<SignedTet>* a_above) {
+  for (const auto& tet : a_tets) {
+    std::array<double, 4> distance;
+    std::array<int, 4> in;
+    std::array<int, 4> out;
+    int number_in = 0;
+    int number_out = 0;
+    for (int v = 0; v < 4; ++v) {
+      distance[v] = a_position - tet.pts[v][a_dim];
+      if (distance[v] >= 0.0) {
+        in[number_in++] = v;
+      } else {
+        out[number_out++] = v;
+      }
+    }
+    if (number_out == 0) {
+      a_below->push_back(tet);
+      continue;
+    }
+    if (number_in == 0) {
+      a_above->push_back(tet);
+      continue;
+    }
+
+    // Point on the edge from vertex a_in below to vertex a_out above,
+    // placed exactly on the plane
+    auto intersection = [&](const int a_in, const int a_out) {
+      const double inv_total = 1.0 / (distance[a_in] - distance[a_out]);
+      Vertex pt;
+      for (int d = 0; d < 3; ++d) {
+        pt[d] = (distance[a_in] * tet.pts[a_out][d] -
+                 distance[a_out] * tet.pts[a_in][d]) *
+                inv_total;
+      }
+      pt[a_dim] = a_position;
+      return pt;
+    };
+
+    if (number_in == 1) {
+      const std::array<Vertex, 3> cut{{intersection(in[0], out[0]),
+                                       intersection(in[0], out[1]),
+                                       intersection(in[0], out[2])}};
+      a_below->push_back(
+          SignedTet{{{tet.pts[in[0]], cut[0], cut[1], cut[2]}}, tet.sign});
+      appendPrism({{tet.pts[out[0]], tet.pts[out[1]], tet.pts[out[2]]}}, cut,
+                  tet.sign, a_above);
+    } else if (number_in == 3) {
+      const std::array<Vertex, 3> cut{{intersection(in[0], out[0]),
+                                       intersection(in[1], out[0]),
+                                       intersection(in[2], out[0])}};
+      appendPrism({{tet.pts[in[0]], tet.pts[in[1]], tet.pts[in[2]]}}, cut,
+                  tet.sign, a_below);
+      a_above->push_back(
+          SignedTet{{{tet.pts[out[0]], cut[0], cut[1], cut[2]}}, tet.sign});
+    } else {
+      const Vertex cut00 = intersection(in[0], out[0]);
+      const Vertex cut01 = intersection(in[0], out[1]);
+      const Vertex cut10 = intersection(in[1], out[0]);
+      const Vertex cut11 = intersection(in[1], out[1]);
+      appendPrism({{tet.pts[in[0]], cut00, cut01}},
+                  {{tet.pts[in[1]], cut10, cut11}}, tet.sign, a_below);
+      appendPrism({{tet.pts[out[0]], cut00, cut10}},
+                  {{tet.pts[out[1]], cut01, cut11}}, tet.sign, a_above);
+    }
+  }
+}
+
+// Tets still to be cut in each direction, the current slab in each
+// direction, and scratch space. Kept between calls so the vectors are
+// only cleared, not reallocated.
+struct SlabWorkspace {
+  std::array<std::vector<SignedTet>, 3> remaining;
+  std::array<std::vector<SignedTet>, 3> slab;
+  std::vector<SignedTet> scratch;
+};
+
+// Moves the part of a_remaining below x[a_dim] = a_position into a_slab,
+// leaving the part above in a_remaining. The last slab takes everything.
+void cutSlab(const int a_dim, const double a_position, const bool a_last,
+             std::vector<SignedTet>* a_remaining, std::vector<SignedTet>* a_slab,
+             std::vector<SignedTet>* a_scratch) {
+  a_slab->clear();
+  if (a_last) {
+    a_slab->swap(*a_remaining);
+    return;
+  }
+  a_scratch->clear();
+  splitTets(*a_remaining, a_dim, a_position, a_slab, a_scratch);
+  a_remaining->swap(*a_scratch);
+}
+
+// Range of cells in direction a_dim overlapping [a_lower, a_upper],
+// clamped to the mesh
+std::array<int, 2> getCellRange(const double a_lower, const double a_upper,
+                                const int a_dim, const double* a_mesh_bounds,
+                                const int* a_ncells) {
+  const double dx =
+      (a_mesh_bounds[3 + a_dim] - a_mesh_bounds[a_dim]) / a_ncells[a_dim];
+  std::array<int, 2> range{
+      {static_cast<int>(std::floor((a_lower - a_mesh_bounds[a_dim]) / dx)),
+       static_cast<int>(std::floor((a_upper - a_mesh_bounds[a_dim]) / dx))}};
+  for (auto& index : range) {
+    index = std::max(0, std::min(a_ncells[a_dim] - 1, index));
+  }
+  return range;
+}
+
+template <class ShapeType>
+void distributeBySlabs(const double* a_pts, const double* a_mesh_bounds,
+                       const int* a_ncells, double* a_cell_volumes,
+                       double* a_volume, double* a_times,
+                       std::size_t* a_entered_cells) {
+  static thread_local SlabWorkspace workspace;
+
+  double start = omp_get_wtime();
+  // Signed tet decomposition and bounding box of the polyhedron
+  constexpr auto triangles = ShapeType::triangles();
+  auto& tets = workspace.remaining[0];
+  tets.clear();
+  const Vertex origin{{a_pts[0], a_pts[1], a_pts[2]}};
+  for (std::size_t t = 0; t < ShapeType::kNumberOfTriangles; ++t) {
+    SignedTet tet;
+    tet.pts[0] = origin;
+    for (int v = 0; v < 3; ++v) {
+      for (int d = 0; d < 3; ++d) {
+        tet.pts[v + 1][d] = a_pts[3 * triangles[t][v] + d];
+      }
+    }
+    const double volume = signedTetVolume(tet.pts);
+    if (volume == 0.0) {
+      continue;
+    }
+    tet.sign = volume > 0.0 ? 1.0 : -1.0;
+    tets.push_back(tet);
+  }
+  Vertex lower = origin;
+  Vertex upper = origin;
+  for (std::size_t v = 1; v < ShapeType::kNumberOfVertices; ++v) {
+    for (int d = 0; d < 3; ++d) {
+      lower[d] = std::min(lower[d], a_pts[3 * v + d]);
+      upper[d] = std::max(upper[d], a_pts[3 * v + d]);
+    }
+  }
+  std::array<std::array<int, 2>, 3> range;
+  std::array<double, 3> dx;
+  for (int d = 0; d < 3; ++d) {
+    range[d] = getCellRange(lower[d], upper[d], d, a_mesh_bounds, a_ncells);
+    dx[d] = (a_mesh_bounds[3 + d] - a_mesh_bounds[d]) / a_ncells[d];
+  }
+  // Upper face of cell a_index in direction a_dim
+  auto face = [&](const int a_dim, const int a_index) {
+    return a_mesh_bounds[a_dim] + static_cast<double>(a_index + 1) * dx[a_dim];
+  };
+
+  *a_volume = 0.0;
+  *a_entered_cells = 0;
+  for (int i = range[0][0]; i <= range[0][1]; ++i) {
+    cutSlab(0, face(0, i), i == range[0][1], &workspace.remaining[0],
+            &workspace.slab[0], &workspace.scratch);
+    workspace.remaining[1].swap(workspace.slab[0]);
+    for (int j = range[1][0]; j <= range[1][1]; ++j) {
+      if (workspace.remaining[1].empty()) {
+        break;
+      }
+      cutSlab(1, face(1, j), j == range[1][1], &workspace.remaining[1],
+              &workspace.slab[1], &workspace.scratch);
+      workspace.remaining[2].swap(workspace.slab[1]);
+      for (int k = range[2][0]; k <= range[2][1]; ++k) {
+        if (workspace.remaining[2].empty()) {
+          break;
+        }
+        cutSlab(2, face(2, k), k == range[2][1], &workspace.remaining[2],
+                &workspace.slab[2], &workspace.scratch);
+        if (workspace.slab[2].empty()) {
+          continue;
+        }
+        double cell_volume = 0.0;
+        for (const auto& tet : workspace.slab[2]) {
+          cell_volume += tet.sign * std::fabs(signedTetVolume(tet.pts));
+        }
+        a_cell_volumes[i + j * a_ncells[0] + k * a_ncells[0] * a_ncells[1]] +=
+            cell_volume;
+        *a_volume += cell_volume;
+        ++(*a_entered_cells);
+      }
+    }
+  }
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+}
+
+}  // namespace
+
+void slab_cubeOntoCartesianMesh(const double* a_cube_pts,
+                                const double* a_mesh_bounds,
+                                const int* a_ncells, double* a_cell_volumes,
+                                double* a_volume, double* a_times,
+                                std::size_t* a_entered_cells) {
+  double start = omp_get_wtime();
+  std::array<std::array<int, 2>, 3> range;
+  std::array<double, 3> dx;
+  for (int d = 0; d < 3; ++d) {
+    range[d] = getCellRange(a_cube_pts[d], a_cube_pts[3 + d], d,
+                            a_mesh_bounds, a_ncells);
+    dx[d] = (a_mesh_bounds[3 + d] - a_mesh_bounds[d]) / a_ncells[d];
+  }
+  // Length of the cube inside cell a_index in direction a_dim. The
+  // boundary cells extend to cover any part outside the mesh.
+  auto overlap = [&](const int a_dim, const int a_index) {
+    const double cell_lower =
+        a_index == 0 ? a_cube_pts[a_dim]
+                     : a_mesh_bounds[a_dim] +
+                           static_cast<double>(a_index) * dx[a_dim];
+    const double cell_upper =
+        a_index == a_ncells[a_dim] - 1
+            ? a_cube_pts[3 + a_dim]
+            : a_mesh_bounds[a_dim] +
+                  static_cast<double>(a_index + 1) * dx[a_dim];
+    return std::max(0.0, std::min(a_cube_pts[3 + a_dim], cell_upper) -
+                             std::max(a_cube_pts[a_dim], cell_lower));
+  };
+
+  *a_volume = 0.0;
+  *a_entered_cells = 0;
+  for (int k = range[2][0]; k <= range[2][1]; ++k) {
+    const double z_length = overlap(2, k);
+    for (int j = range[1][0]; j <= range[1][1]; ++j) {
+      const double yz_area = overlap(1, j) * z_length;
+      for (int i = range[0][0]; i <= range[0][1]; ++i) {
+        const double cell_volume = overlap(0, i) * yz_area;
+        if (cell_volume > 0.0) {
+          a_cell_volumes[i + j * a_ncells[0] + k * a_ncells[0] * a_ncells[1]] +=
+              cell_volume;
+          *a_volume += cell_volume;
+          ++(*a_entered_cells);
+        }
+      }
+    }
+  }
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+}
+
+void slab_stelIcosahedronOntoCartesianMesh(
+    const double* a_stel_icosahedron_pts, const double* a_mesh_bounds,
+    const int* a_ncells, double* a_cell_volumes, double* a_volume,
+    double* a_times, std::size_t* a_entered_cells) {
+  distributeBySlabs<TetClipStelIcosahedron>(
+      a_stel_icosahedron_pts, a_mesh_bounds, a_ncells, a_cell_volumes,
+      a_volume, a_times, a_entered_cells);
+}
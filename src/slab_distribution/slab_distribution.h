@@ -0,0 +1,41 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Distribution of a polyhedron onto a structured Cartesian mesh without
+// a mesh graph. The range of cells touched is found from the bounding box
+// of the polyhedron, and all cell faces are axis-aligned, so clipping only
+// compares one coordinate against the face position. The polyhedron is
+// cut slab by slab, first in x, then each x-slab in y, then each y-slab in
+// z, so each cut is shared by every cell of the slab behind it. Axis-aligned
+// cuboids skip clipping entirely, using the analytic overlap of two boxes.
+//
+// The mesh covers the box between the lower point a_mesh_bounds[0:3] and
+// the upper point a_mesh_bounds[3:6], with a_ncells[0:3] cells per
+// direction, indexed i + j * a_ncells[0] + k * a_ncells[0] * a_ncells[1].
+// The volume in each cell is added to a_cell_volumes, and any part of the
+// polyhedron outside the mesh is kept in the boundary cells. Only the
+// total time is recorded in a_times[0].
+
+#ifndef SRC_SLAB_DISTRIBUTION_SLAB_DISTRIBUTION_H_
+#define SRC_SLAB_DISTRIBUTION_SLAB_DISTRIBUTION_H_
+
+#include <cstddef>
+
+// Distribute a Cube, given as lower and upper bounding box points,
+// onto a Cartesian Mesh using the analytic box-box overlap
+void slab_cubeOntoCartesianMesh(const double *a_cube_pts,
+                                const double *a_mesh_bounds,
+                                const int *a_ncells, double *a_cell_volumes,
+                                double *a_volume, double *a_times,
+                                std::size_t *a_entered_cells);
+
+// Distribute a Stellated Icosahedron onto a Cartesian Mesh by slab cutting
+void slab_stelIcosahedronOntoCartesianMesh(
+    const double *a_stel_icosahedron_pts, const double *a_mesh_bounds,
+    const int *a_ncells, double *a_cell_volumes, double *a_volume,
+    double *a_times, std::size_t *a_entered_cells);
+
+#endif  // SRC_SLAB_DISTRIBUTION_SLAB_DISTRIBUTION_H_
@@ -0,0 +1,95 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/tet_clip/tet_clip_intersection.h"
+
+#include <omp.h>
+
+#include "src/tet_clip/tet_clip_polyhedron.h"
+#include "src/tet_clip/tet_clip_shapes.h"
+#include "src/vertex_clip/cube_pts.h"
+
+namespace {
+
+template <class ShapeType>
+void clipByPlanes(const double* a_pts, const int a_number_of_planes,
+                  const double* a_planes, double* a_volume, double* a_times) {
+  double start = omp_get_wtime();
+  const TetClipPolyhedron<ShapeType, double, tet_clip_max_planes> poly(a_pts);
+  *a_volume = poly.calculateClippedVolume(a_planes, a_number_of_planes);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+}
+
+}  // namespace
+
+void tet_clip_prismByPlanes(const double* a_prism_pts,
+                            const int a_number_of_planes,
+                            const double* a_planes, double* a_volume,
+                            double* a_times) {
+  clipByPlanes<TetClipPrism>(a_prism_pts, a_number_of_planes, a_planes,
+                             a_volume, a_times);
+}
+
+void tet_clip_unitCubeByPlanes(const double* a_cube_pts,
+                               const int a_number_of_planes,
+                               const double* a_planes, double* a_volume,
+                               double* a_times) {
+  // Expanding the bounding points is input conversion for the fixed
+  // vertex table, so it is kept out of the timed region.
+  const auto cube_pts = getCubePts(a_cube_pts);
+  clipByPlanes<TetClipCube>(cube_pts.data(), a_number_of_planes, a_planes,
+                            a_volume, a_times);
+}
+
+void tet_clip_triPrismByPlanes(const double* a_tri_prism_pts,
+                               const int a_number_of_planes,
+                               const double* a_planes, double* a_volume,
+                               double* a_times) {
+  clipByPlanes<TetClipTriPrism>(a_tri_prism_pts, a_number_of_planes,
+                                a_planes, a_volume, a_times);
+}
+
+void tet_clip_triHexByPlanes(const double* a_tri_hex_pts,
+                             const int a_number_of_planes,
+                             const double* a_planes, double* a_volume,
+                             double* a_times) {
+  clipByPlanes<TetClipTriHex>(a_tri_hex_pts, a_number_of_planes, a_planes,
+                              a_volume, a_times);
+}
+
+void tet_clip_symPrismByPlanes(const double* a_sym_prism_pts,
+                               const int a_number_of_planes,
+                               const double* a_planes, double* a_volume,
+                               double* a_times) {
+  clipByPlanes<TetClipSymPrism>(a_sym_prism_pts, a_number_of_planes,
+                                a_planes, a_volume, a_times);
+}
+
+void tet_clip_symHexByPlanes(const double* a_sym_hex_pts,
+                             const int a_number_of_planes,
+                             const double* a_planes, double* a_volume,
+                             double* a_times) {
+  clipByPlanes<TetClipSymHex>(a_sym_hex_pts, a_number_of_planes, a_planes,
+                              a_volume, a_times);
+}
+
+void tet_clip_stelDodecahedronByPlanes(
+    const double* a_stel_dodecahedron_pts, const int a_number_of_planes,
+    const double* a_planes, double* a_volume, double* a_times) {
+  clipByPlanes<TetClipStelDodecahedron>(a_stel_dodecahedron_pts,
+                                        a_number_of_planes, a_planes,
+                                        a_volume, a_times);
+}
+
+void tet_clip_stelIcosahedronByPlanes(const double* a_stel_icosahedron_pts,
+                                      const int a_number_of_planes,
+                                      const double* a_planes,
+                                      double* a_volume, double* a_times) {
+  clipByPlanes<TetClipStelIcosahedron>(a_stel_icosahedron_pts,
+                                       a_number_of_planes, a_planes,
+                                       a_volume, a_times);
+}
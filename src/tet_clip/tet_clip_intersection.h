@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Plane-polyhedron intersection using TetClipPolyhedron, a signed tet
+// decomposition of each shape built from its fixed topology. Only the
+// total time is recorded in a_times[0].
+
+#ifndef SRC_TET_CLIP_TET_CLIP_INTERSECTION_H_
+#define SRC_TET_CLIP_TET_CLIP_INTERSECTION_H_
+
+// Largest number of planes the functions below can be called with
+constexpr int tet_clip_max_planes = 64;
+
+// Perform intersection of plane(s) with a Triangular Prism
+void tet_clip_prismByPlanes(const double *a_prism_pts,
+                            const int a_number_of_planes,
+                            const double *a_planes, double *a_volume,
+                            double *a_times);
+
+// Perform intersection of plane(s) with a Unit Cube
+void tet_clip_unitCubeByPlanes(const double *a_cube_pts,
+                               const int a_number_of_planes,
+                               const double *a_planes, double *a_volume,
+                               double *a_times);
+
+// Perform intersection of plane(s) with a Triangulated Triangular Prism
+void tet_clip_triPrismByPlanes(const double *a_tri_prism_pts,
+                               const int a_number_of_planes,
+                               const double *a_planes, double *a_volume,
+                               double *a_times);
+
+// Perform intersection of plane(s) with a Triangulated Hexahedron
+void tet_clip_triHexByPlanes(const double *a_tri_hex_pts,
+                             const int a_number_of_planes,
+                             const double *a_planes, double *a_volume,
+                             double *a_times);
+
+// Perform intersection of plane(s) with a Symmetric Triangular Prism
+void tet_clip_symPrismByPlanes(const double *a_sym_prism_pts,
+                               const int a_number_of_planes,
+                               const double *a_planes, double *a_volume,
+                               double *a_times);
+
+// Perform intersection of plane(s) with a Symmetric Hexahedron
+void tet_clip_symHexByPlanes(const double *a_sym_hex_pts,
+                             const int a_number_of_planes,
+                             const double *a_planes, double *a_volume,
+                             double *a_times);
+
+// Perform intersection of plane(s) with a Stellated Dodecahedron
+void tet_clip_stelDodecahedronByPlanes(
+    const double *a_stel_dodecahedron_pts, const int a_number_of_planes,
+    const double *a_planes, double *a_volume, double *a_times);
+
+// Perform intersection of plane(s) with a Stellated Icosahedron
+void tet_clip_stelIcosahedronByPlanes(const double *a_stel_icosahedron_pts,
+                                      const int a_number_of_planes,
+                                      const double *a_planes,
+                                      double *a_volume, double *a_times);
+
+#endif  // SRC_TET_CLIP_TET_CLIP_INTERSECTION_H_
@@ -0,0 +1,54 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Plane clipping by signed tet decomposition. The polyhedron is split
+// into signed tets, one per boundary triangle listed at compile time in
+// tet_clip_shapes.h, and each tet is clipped by splitting it into at
+// most three tets per plane. This is not a face-based clipper: the
+// polyhedron's own vertex/face topology is only used to form the tets,
+// and no clipped polyhedron is ever built. Tets waiting to be clipped
+// are kept in a fixed-capacity stack, so nothing is allocated. Because
+// the decomposition is signed, this also holds for the non-convex
+// shapes.
+
+#ifndef SRC_TET_CLIP_TET_CLIP_POLYHEDRON_H_
+#define SRC_TET_CLIP_TET_CLIP_POLYHEDRON_H_
+
+#include <array>
+#include <cstddef>
+
+template <class ShapeType, class ScalarType = double,
+          std::size_t kMaxPlanes = 64>
+class TetClipPolyhedron {
+ public:
+  // Points ordered Pt 1 X/Y/Z, Pt 2 X/Y/Z, ...
+  explicit TetClipPolyhedron(const double* a_pts);
+
+  // Volume of the unclipped polyhedron.
+  ScalarType calculateVolume(void) const;
+
+  // Volume of the polyhedron below all planes, with the planes given as
+  // Normx, Normy, Normz, Dist and stacked contiguously.
+  // Requires a_number_of_planes <= kMaxPlanes.
+  ScalarType calculateClippedVolume(const double* a_planes,
+                                    const int a_number_of_planes) const;
+
+ private:
+  using Vertex = std::array<ScalarType, 3>;
+  using Tet = std::array<Vertex, 4>;
+
+  static ScalarType signedTetVolume(const Tet& a_tet);
+
+  // Volume of a_tet below all planes, always positive.
+  static ScalarType clippedTetVolume(const Tet& a_tet, const double* a_planes,
+                                     const int a_number_of_planes);
+
+  std::array<Vertex, ShapeType::kNumberOfVertices> vertices_m;
+};
+
+#include "src/tet_clip/tet_clip_polyhedron.tpp"
+
+#endif  // SRC_TET_CLIP_TET_CLIP_POLYHEDRON_H_
@@ -0,0 +1,199 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TET_CLIP_TET_CLIP_POLYHEDRON_TPP_
+#define SRC_TET_CLIP_TET_CLIP_POLYHEDRON_TPP_
+
+#include <cassert>
+#include <cmath>
+
+template <class ShapeType, class ScalarType, std::size_t kMaxPlanes>
+TetClipPolyhedron<ShapeType, ScalarType, kMaxPlanes>::TetClipPolyhedron(
+    const double* a_pts) {
+  for (std::size_t v = 0; v < ShapeType::kNumberOfVertices; ++v) {
+    for (std::size_t d = 0; d < 3; ++d) {
+      vertices_m[v][d] = static_cast<ScalarType>(a_pts[v * 3 + d]);
+    }
+  }
+}
+
+template <class ShapeType, class ScalarType, std::size_t kMaxPlanes>
+ScalarType
+TetClipPolyhedron<ShapeType, ScalarType, kMaxPlanes>::calculateVolume(
+    void) const {
+  constexpr auto triangles = ShapeType::triangles();
+  ScalarType volume = static_cast<ScalarType>(0);
+  for (std::size_t t = 0; t < ShapeType::kNumberOfTriangles; ++t) {
+    volume += signedTetVolume({{vertices_m[0], vertices_m[triangles[t][0]],
+                                vertices_m[triangles[t][1]],
+                                vertices_m[triangles[t][2]]}});
+  }
+  return volume;
+}
+
+template <class ShapeType, class ScalarType, std::size_t kMaxPlanes>
+ScalarType TetClipPolyhedron<ShapeType, ScalarType, kMaxPlanes>::
+    calculateClippedVolume(const double* a_planes,
+                           const int a_number_of_planes) const {
+  assert(a_number_of_planes <= static_cast<int>(kMaxPlanes));
+  constexpr auto triangles = ShapeType::triangles();
+  ScalarType volume = static_cast<ScalarType>(0);
+  for (std::size_t t = 0; t < ShapeType::kNumberOfTriangles; ++t) {
+    const Tet tet{{vertices_m[0], vertices_m[triangles[t][0]],
+                   vertices_m[triangles[t][1]], vertices_m[triangles[t][2]]}};
+    const ScalarType signed_volume = signedTetVolume(tet);
+    if (signed_volume == static_cast<ScalarType>(0)) {
+      continue;
+    }
+    const ScalarType clipped_volume =
+        clippedTetVolume(tet, a_planes, a_number_of_planes);
+    volume += signed_volume > static_cast<ScalarType>(0) ? clipped_volume
+                                                         : -clipped_volume;
+  }
+  return volume;
+}
+
+template <class ShapeType, class ScalarType, std::size_t kMaxPlanes>
+ScalarType
+TetClipPolyhedron<ShapeType, ScalarType, kMaxPlanes>::signedTetVolume(
+    const Tet& a_tet) {
+  const Vertex a{{a_tet[1][0] - a_tet[0][0], a_tet[1][1] - a_tet[0][1],
+                  a_tet[1][2] - a_tet[0][2]}};
+  const Vertex b{{a_tet[2][0] - a_tet[0][0], a_tet[2][1] - a_tet[0][1],
+                  a_tet[2][2] - a_tet[0][2]}};
+  const Vertex c{{a_tet[3][0] - a_tet[0][0], a_tet[3][1] - a_tet[0][1],
+                  a_tet[3][2] - a_tet[0][2]}};
+  return (a[0] * (b[1] * c[2] - b[2] * c[1]) +
+          a[1] * (b[2] * c[0] - b[0] * c[2]) +
+          a[2] * (b[0] * c[1] - b[1] * c[0])) /
+         static_cast<ScalarType>(6);
+}
+
+template <class ShapeType, class ScalarType, std::size_t kMaxPlanes>
+ScalarType
+TetClipPolyhedron<ShapeType, ScalarType, kMaxPlanes>::clippedTetVolume(
+    const Tet& a_tet, const double* a_planes, const int a_number_of_planes) {
+  // Splitting a tet pushes at most three tets, one of which is clipped
+  // next, so the stack grows by at most two per plane.
+  struct Entry {
+    Tet tet;
+    int plane;
+  };
+  if (a_number_of_planes == 0) {
+    return std::fabs(signedTetVolume(a_tet));
+  }
+  std::array<Entry, 2 * kMaxPlanes + 1> stack;
+  int stack_size = 0;
+  stack[stack_size++] = Entry{a_tet, 0};
+
+  ScalarType volume = static_cast<ScalarType>(0);
+  while (stack_size > 0) {
+    const Entry entry = stack[--stack_size];
+
+    // Positive distance is kept (below the plane)
+    const double* plane = a_planes + 4 * entry.plane;
+    std::array<ScalarType, 4> distance;
+    std::array<int, 4> in;
+    std::array<int, 4> out;
+    int number_in = 0;
+    int number_out = 0;
+    for (int v = 0; v < 4; ++v) {
+      distance[v] = static_cast<ScalarType>(plane[3]) -
+                    (static_cast<ScalarType>(plane[0]) * entry.tet[v][0] +
+                     static_cast<ScalarType>(plane[1]) * entry.tet[v][1] +
+                     static_cast<ScalarType>(plane[2]) * entry.tet[v][2]);
+      if (distance[v] >= static_cast<ScalarType>(0)) {
+        in[number_in++] = v;
+      } else {
+        out[number_out++] = v;
+      }
+    }
+
+    const int next_plane = entry.plane + 1;
+    const bool last_plane = next_plane == a_number_of_planes;
+    if (number_in == 0) {
+      continue;
+    }
+    if (number_out == 0) {
+      if (last_plane) {
+        volume += std::fabs(signedTetVolume(entry.tet));
+      } else {
+        stack[stack_size++] = Entry{entry.tet, next_plane};
+      }
+      continue;
+    }
+
+    // On the last plane, the corner tet cut off a vertex is a known
+    // fraction of the tet, so its volume is found without new vertices.
+    if (last_plane && number_in != 2) {
+      const int corner = number_in == 1 ? in[0] : out[0];
+      ScalarType fraction = static_cast<ScalarType>(1);
+      for (int v = 0; v < 4; ++v) {
+        if (v != corner) {
+          fraction *= distance[corner] / (distance[corner] - distance[v]);
+        }
+      }
+      if (number_in == 3) {
+        fraction = static_cast<ScalarType>(1) - fraction;
+      }
+      volume += fraction * std::fabs(signedTetVolume(entry.tet));
+      continue;
+    }
+
+    // Point on the edge from kept vertex a_in to clipped vertex a_out
+    auto intersection = [&](const int a_in, const int a_out) {
+      const ScalarType inv_total =
+          static_cast<ScalarType>(1) / (distance[a_in] - distance[a_out]);
+      Vertex pt;
+      for (int d = 0; d < 3; ++d) {
+        pt[d] = (distance[a_in] * entry.tet[a_out][d] -
+                 distance[a_out] * entry.tet[a_in][d]) *
+                inv_total;
+      }
+      return pt;
+    };
+
+    if (number_in == 1) {
+      const int i = in[0];
+      stack[stack_size++] =
+          Entry{{{entry.tet[i], intersection(i, out[0]),
+                  intersection(i, out[1]), intersection(i, out[2])}},
+                next_plane};
+      continue;
+    }
+
+    // Remaining cases form a triangular prism with bases a and b
+    // and lateral edges a[n]-b[n], split into three tets.
+    std::array<Vertex, 3> a;
+    std::array<Vertex, 3> b;
+    if (number_in == 2) {
+      a = {{entry.tet[in[0]], intersection(in[0], out[0]),
+            intersection(in[0], out[1])}};
+      b = {{entry.tet[in[1]], intersection(in[1], out[0]),
+            intersection(in[1], out[1])}};
+    } else {
+      a = {{entry.tet[in[0]], entry.tet[in[1]], entry.tet[in[2]]}};
+      b = {{intersection(in[0], out[0]), intersection(in[1], out[0]),
+            intersection(in[2], out[0])}};
+    }
+    const std::array<Tet, 3> prism_tets{{{{a[0], a[1], a[2], b[2]}},
+                                         {{a[0], a[1], b[1], b[2]}},
+                                         {{a[0], b[0], b[1], b[2]}}}};
+    if (last_plane) {
+      for (const auto& tet : prism_tets) {
+        volume += std::fabs(signedTetVolume(tet));
+      }
+    } else {
+      assert(stack_size + 3 <= static_cast<int>(stack.size()));
+      for (const auto& tet : prism_tets) {
+        stack[stack_size++] = Entry{tet, next_plane};
+      }
+    }
+  }
+  return volume;
+}
+
+#endif  // SRC_TET_CLIP_TET_CLIP_POLYHEDRON_TPP_
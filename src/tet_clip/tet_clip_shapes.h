@@ -0,0 +1,137 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Compile-time connectivity for the polyhedra used in the benchmarks.
+// Each shape lists the triangles of its boundary (counter-clockwise
+// from outside) that do not touch vertex 0. Joining each triangle to
+// vertex 0 gives the signed tet decomposition used by
+// TetClipPolyhedron. Vertex ordering matches the points given to the
+// other packages in src/timing_comp/intersection_timing.cpp.
+
+#ifndef SRC_TET_CLIP_TET_CLIP_SHAPES_H_
+#define SRC_TET_CLIP_TET_CLIP_SHAPES_H_
+
+#include <array>
+#include <cstddef>
+
+// Triangular Prism
+struct TetClipPrism {
+  static constexpr std::size_t kNumberOfVertices = 6;
+  static constexpr std::size_t kNumberOfTriangles = 3;
+  static constexpr std::array<std::array<int, 3>, kNumberOfTriangles>
+  triangles(void) {
+    return {{
+        {{1, 4, 5}}, {{1, 5, 2}}, {{3, 5, 4}}}};
+  }
+};
+
+// Cube (vertices ordered as in VOFTools make_cuboid)
+struct TetClipCube {
+  static constexpr std::size_t kNumberOfVertices = 8;
+  static constexpr std::size_t kNumberOfTriangles = 7;
+  static constexpr std::array<std::array<int, 3>, kNumberOfTriangles>
+  triangles(void) {
+    return {{
+        {{1, 4, 5}}, {{2, 1, 5}}, {{2, 5, 6}}, {{3, 2, 6}}, {{3, 6, 7}},
+        {{7, 6, 5}}, {{7, 5, 4}}}};
+  }
+};
+
+// Triangulated Triangular Prism
+struct TetClipTriPrism {
+  static constexpr std::size_t kNumberOfVertices = 6;
+  static constexpr std::size_t kNumberOfTriangles = 3;
+  static constexpr std::array<std::array<int, 3>, kNumberOfTriangles>
+  triangles(void) {
+    return {{
+        {{4, 3, 5}}, {{4, 5, 2}}, {{4, 2, 1}}}};
+  }
+};
+
+// Triangulated Hexahedron
+struct TetClipTriHex {
+  static constexpr std::size_t kNumberOfVertices = 8;
+  static constexpr std::size_t kNumberOfTriangles = 8;
+  static constexpr std::array<std::array<int, 3>, kNumberOfTriangles>
+  triangles(void) {
+    return {{
+        {{5, 7, 6}}, {{5, 4, 7}}, {{3, 1, 2}}, {{4, 3, 7}}, {{2, 5, 6}},
+        {{2, 1, 5}}, {{3, 6, 7}}, {{3, 2, 6}}}};
+  }
+};
+
+// Symmetric Triangular Prism
+struct TetClipSymPrism {
+  static constexpr std::size_t kNumberOfVertices = 11;
+  static constexpr std::size_t kNumberOfTriangles = 12;
+  static constexpr std::array<std::array<int, 3>, kNumberOfTriangles>
+  triangles(void) {
+    return {{
+        {{6, 1, 2}}, {{7, 4, 1}}, {{7, 3, 4}}, {{8, 2, 1}}, {{8, 1, 4}},
+        {{8, 4, 5}}, {{8, 5, 2}}, {{9, 5, 3}}, {{9, 2, 5}}, {{10, 4, 3}},
+        {{10, 3, 5}}, {{10, 5, 4}}}};
+  }
+};
+
+// Symmetric Hexahedron
+struct TetClipSymHex {
+  static constexpr std::size_t kNumberOfVertices = 14;
+  static constexpr std::size_t kNumberOfTriangles = 18;
+  static constexpr std::array<std::array<int, 3>, kNumberOfTriangles>
+  triangles(void) {
+    return {{
+        {{1, 2, 8}}, {{2, 3, 8}}, {{5, 1, 9}}, {{4, 5, 9}}, {{1, 5, 10}},
+        {{5, 6, 10}}, {{6, 2, 10}}, {{2, 1, 10}}, {{2, 6, 11}}, {{6, 7,
+        11}}, {{7, 3, 11}}, {{3, 2, 11}}, {{3, 7, 12}}, {{7, 4, 12}}, {{5,
+        4, 13}}, {{4, 7, 13}}, {{7, 6, 13}}, {{6, 5, 13}}}};
+  }
+};
+
+// Stellated Dodecahedron
+struct TetClipStelDodecahedron {
+  static constexpr std::size_t kNumberOfVertices = 32;
+  static constexpr std::size_t kNumberOfTriangles = 54;
+  static constexpr std::array<std::array<int, 3>, kNumberOfTriangles>
+  triangles(void) {
+    return {{
+        {{8, 9, 20}}, {{9, 4, 20}}, {{4, 16, 20}}, {{16, 17, 21}}, {{17, 2,
+        21}}, {{2, 12, 21}}, {{12, 2, 22}}, {{2, 10, 22}}, {{10, 3, 22}},
+        {{3, 13, 22}}, {{13, 12, 22}}, {{9, 5, 23}}, {{5, 15, 23}}, {{15,
+        14, 23}}, {{14, 4, 23}}, {{4, 9, 23}}, {{3, 19, 24}}, {{19, 18,
+        24}}, {{18, 1, 24}}, {{1, 13, 24}}, {{13, 3, 24}}, {{7, 11, 25}},
+        {{11, 6, 25}}, {{6, 14, 25}}, {{14, 15, 25}}, {{15, 7, 25}}, {{12,
+        13, 26}}, {{13, 1, 26}}, {{1, 8, 26}}, {{8, 1, 27}}, {{1, 18, 27}},
+        {{18, 5, 27}}, {{5, 9, 27}}, {{9, 8, 27}}, {{16, 4, 28}}, {{4, 14,
+        28}}, {{14, 6, 28}}, {{6, 17, 28}}, {{17, 16, 28}}, {{6, 11, 29}},
+        {{11, 10, 29}}, {{10, 2, 29}}, {{2, 17, 29}}, {{17, 6, 29}}, {{7,
+        15, 30}}, {{15, 5, 30}}, {{5, 18, 30}}, {{18, 19, 30}}, {{19, 7,
+        30}}, {{7, 19, 31}}, {{19, 3, 31}}, {{3, 10, 31}}, {{10, 11, 31}},
+        {{11, 7, 31}}}};
+  }
+};
+
+// Stellated Icosahedron
+struct TetClipStelIcosahedron {
+  static constexpr std::size_t kNumberOfVertices = 32;
+  static constexpr std::size_t kNumberOfTriangles = 50;
+  static constexpr std::array<std::array<int, 3>, kNumberOfTriangles>
+  triangles(void) {
+    return {{
+        {{8, 4, 12}}, {{5, 10, 13}}, {{2, 4, 14}}, {{4, 9, 14}}, {{9, 2,
+        14}}, {{2, 11, 15}}, {{11, 5, 15}}, {{5, 2, 15}}, {{1, 6, 16}}, {{6,
+        8, 16}}, {{8, 1, 16}}, {{1, 10, 17}}, {{10, 7, 17}}, {{7, 1, 17}},
+        {{3, 9, 18}}, {{9, 6, 18}}, {{6, 3, 18}}, {{3, 7, 19}}, {{7, 11,
+        19}}, {{11, 3, 19}}, {{10, 8, 20}}, {{1, 8, 21}}, {{8, 10, 21}},
+        {{10, 1, 21}}, {{2, 9, 22}}, {{9, 11, 22}}, {{11, 2, 22}}, {{3, 11,
+        23}}, {{11, 9, 23}}, {{9, 3, 23}}, {{4, 2, 24}}, {{2, 5, 25}}, {{6,
+        1, 26}}, {{1, 3, 26}}, {{3, 6, 26}}, {{7, 3, 27}}, {{3, 1, 27}},
+        {{1, 7, 27}}, {{8, 6, 28}}, {{6, 4, 28}}, {{4, 8, 28}}, {{9, 4,
+        29}}, {{4, 6, 29}}, {{6, 9, 29}}, {{10, 5, 30}}, {{5, 7, 30}}, {{7,
+        10, 30}}, {{11, 7, 31}}, {{7, 5, 31}}, {{5, 11, 31}}}};
+  }
+};
+
+#endif  // SRC_TET_CLIP_TET_CLIP_SHAPES_H_
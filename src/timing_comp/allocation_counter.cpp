@@ -0,0 +1,44 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if TIMING_COMP_ALLOCATION_COUNTS
+
+namespace {
+
+std::atomic<std::size_t> allocation_count{0};
+
+}  // namespace
+
+// The default array and nothrow forms call this one, and the default
+// sized and array forms of delete call operator delete(void*).
+void* operator new(std::size_t a_size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  void* ptr = std::malloc(a_size == 0 ? 1 : a_size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* a_ptr) noexcept { std::free(a_ptr); }
+
+void operator delete(void* a_ptr, std::size_t) noexcept { std::free(a_ptr); }
+
+std::size_t getAllocationCount(void) {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+#else
+
+std::size_t getAllocationCount(void) { return 0; }
+
+#endif
@@ -0,0 +1,30 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Counts heap allocations made through the global operator new, which is
+// replaced in allocation_counter.cpp. The replacement applies to the
+// whole executable, including the IRL library linked into it, so the
+// difference in the count around a call gives the allocations it made.
+// Allocations made with malloc directly (R3D, VOFTools) are not counted.
+// The replacement is only compiled in when TIMING_COMP_ALLOCATION_COUNTS
+// is defined to a nonzero value (cmake -DALLOCATION_COUNTS=ON). Otherwise
+// kCountAllocations is false and getAllocationCount always returns 0.
+
+#ifndef SRC_TIMING_COMP_ALLOCATION_COUNTER_H_
+#define SRC_TIMING_COMP_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+#ifndef TIMING_COMP_ALLOCATION_COUNTS
+#define TIMING_COMP_ALLOCATION_COUNTS 0
+#endif
+
+static constexpr bool kCountAllocations = TIMING_COMP_ALLOCATION_COUNTS != 0;
+
+// Number of calls to operator new made so far, by all threads
+std::size_t getAllocationCount(void);
+
+#endif  // SRC_TIMING_COMP_ALLOCATION_COUNTER_H_
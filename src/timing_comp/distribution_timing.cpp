@@ -8,184 +8,367 @@
 
 #include <omp.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdlib>
+#include <memory>
+#include <vector>
 
+#include "src/timing_comp/allocation_counter.h"
 #include "src/timing_comp/files.h"
 #include "src/timing_comp/times.h"
 #include "src/timing_comp/timing_comp.h"
 
 // IRL GVM Timing includes
+#include "src/irl_gvm/cell_box_tree.h"
 #include "src/irl_gvm/irl_gvm_distribution.h"
 #include "src/irl_gvm/stellated_dodecahedron.h"
 #include "src/irl_gvm/stellated_icosahedron.h"
+#include "src/irl_gvm/traversal_stats.h"
 
-void distributeCubeOntoCubicMesh(FILE* a_distribute_file,
-                                 const int a_number_of_trials) {
-  // Pass cube as lower and upper bounding box points
-  const std::array<double, 6> cube{{-1.5, -1.5, -1.5, 1.5, 1.5, 1.5}};
-  const auto total_volume = 27.0;
-
-  // Will distribute onto a region covering [-1.5,1.5]^3
-  Times<1> irl_gvm_times;
-  std::size_t cells_entered = 0;
-  double volume_error = 0.0;
-  double abs_volume_error = -DBL_MAX;
-  for (int n = 0; n < a_number_of_trials; ++n) {
-    const double x_shift = randomDouble();
-    const double y_shift = randomDouble();
-    const double z_shift = randomDouble();
-    std::array<double, 6> shifted_cube;
-    for (std::size_t v = 0; v < shifted_cube.size(); v += 3) {
-      shifted_cube[v] = cube[v] + x_shift;
-      shifted_cube[v + 1] = cube[v + 1] + y_shift;
-      shifted_cube[v + 2] = cube[v + 2] + z_shift;
-    }
-    Times<1> irl_gvm_trial_time;
-    std::size_t trial_cells_entered;
-    double irl_gvm_volume;
+// Slab Distribution Timing includes
+#include "src/slab_distribution/slab_distribution.h"
 
-    irl_gvm_cubeOntoCubicMesh(shifted_cube.data(), &irl_gvm_volume,
-                              irl_gvm_trial_time.data(), &trial_cells_entered);
+// R3D Timing includes
+extern "C" {
+#include "src/r3d/r3d_distribution.h"
+}
 
+namespace {
+
+using DistributeFunction = void (*)(const double*, const LocalizerMesh&,
+                                    const bool, double*, double*,
+                                    std::size_t*);
+
+// Totals over the trials of one distribution test for the baselines that
+// do not use the mesh graph, only gathered when kRunDistributionBaselines
+// is true
+struct BaselineTotals {
+  Times<1> brute_force_times;
+  Times<1> filtered_times;
+  std::size_t filtered_cells_clipped = 0;
+  double max_difference = 0.0;
+};
+
+using BruteForceFunction = void (*)(const double*, const LocalizerMesh&,
+                                    double*, double*, std::size_t*);
+using FilteredFunction = void (*)(const double*, const LocalizerMesh&,
+                                  const CellBoxTree&, double*, double*,
+                                  std::size_t*);
+
+// Distributes a_pts with both baselines and adds the results to
+// a_totals, keeping the largest difference of either from the volume
+// a_graph_volume found by the graph traversal, relative to a_total_volume.
+void runBaselines(const double* a_pts, const LocalizerMesh& a_mesh,
+                  const CellBoxTree& a_tree, const double a_graph_volume,
+                  const double a_total_volume,
+                  BruteForceFunction a_brute_force,
+                  FilteredFunction a_filtered, BaselineTotals* a_totals) {
+  Times<1> trial_time;
+  std::size_t cells_clipped;
+  double volume;
+  a_brute_force(a_pts, a_mesh, &volume, trial_time.data(), &cells_clipped);
+  a_totals->brute_force_times += trial_time;
+  a_totals->max_difference =
+      std::max(a_totals->max_difference,
+               std::fabs(volume - a_graph_volume) / a_total_volume);
+
+  a_filtered(a_pts, a_mesh, a_tree, &volume, trial_time.data(),
+             &cells_clipped);
+  a_totals->filtered_times += trial_time;
+  a_totals->filtered_cells_clipped += cells_clipped;
+  a_totals->max_difference =
+      std::max(a_totals->max_difference,
+               std::fabs(volume - a_graph_volume) / a_total_volume);
+}
 
-    const double error = std::fabs(1.0 - irl_gvm_volume / total_volume);
-    volume_error += error;
-    abs_volume_error = std::max(abs_volume_error, error);    
-
-    if (!sameVolumesFound(total_volume, irl_gvm_volume)) {
-      printf("Shift of %20.12e %20.12e %20.12e\n", x_shift, y_shift, z_shift);
-      printf(
-          "Shifted cube defined by: \n (%20.12e %20.12e %20.12e), (%20.12e "
-          "%20.12e %20.12e)\n",
-          shifted_cube[0], shifted_cube[1], shifted_cube[2], shifted_cube[3],
-          shifted_cube[4], shifted_cube[5]);
-      std::exit(-1);
-    }
-    irl_gvm_times += irl_gvm_trial_time;
-    cells_entered += trial_cells_entered;
-  }
-  // Write out time in seconds
-  fprintf(a_distribute_file, "%19.13e %19.13e %19.13e %19.13e\n",
-          static_cast<double>(cells_entered) /
+// Adds to a line of distribution_timing.txt the brute force time, the
+// average cells clipped and time of the box-filtered baseline, the largest
+// difference of either from the graph traversal, and the time and memory
+// used to build the box tree.
+void writeBaselines(FILE* a_distribute_file, const BaselineTotals& a_totals,
+                    const CellBoxTree& a_tree, const int a_number_of_trials) {
+  fprintf(a_distribute_file,
+          " %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e",
+          a_totals.brute_force_times[0],
+          static_cast<double>(a_totals.filtered_cells_clipped) /
               static_cast<double>(a_number_of_trials),
-          volume_error / static_cast<double>(a_number_of_trials), abs_volume_error,
-          irl_gvm_times[0]);
+          a_totals.filtered_times[0], a_totals.max_difference,
+          a_tree.getSetupTime(),
+          static_cast<double>(a_tree.getMemoryFootprint()));
 }
 
-void distributeStelIcosahedronOntoCubicMesh(FILE* a_distribute_file,
-                                            const int a_number_of_trials) {
-  // A Stellated Icosahedron. Object is non-convex.
-  // Note: Matches VOFtools NCICOSAMESH object
-  // 32 points, ordered Pt 1 X/Y/Z, Pt 2 X/Y/Z, ...
-  const auto stel_icosahedron_pts = getStelIcosahedronPts();
-
-  // Set volume of whole object
-  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
-      32, stel_icosahedron_pts.data());
-  const double total_volume = stel_icosahedron.calculateVolume();
-
-  // Will distribute onto a region covering [-3,3]^3
-  Times<1> irl_gvm_times;
+// Totals over the trials of one distribution test for the instrumented
+// traversal, only gathered when kCollectTraversalStats is true
+struct TraversalTotals {
+  TraversalStats stats;
+  Times<1> times;
   std::size_t cells_entered = 0;
-  double volume_error = 0.0;
-  double abs_volume_error = -DBL_MAX;  
-  for (int n = 0; n < a_number_of_trials; ++n) {
-    const double x_shift = randomDouble();
-    const double y_shift = randomDouble();
-    const double z_shift = randomDouble();
-    std::array<double, 96> shifted_stel_icosahedron_pts;
-    for (std::size_t v = 0; v < stel_icosahedron_pts.size(); v += 3) {
-      shifted_stel_icosahedron_pts[v] = stel_icosahedron_pts[v] + x_shift;
-      shifted_stel_icosahedron_pts[v + 1] =
-          stel_icosahedron_pts[v + 1] + y_shift;
-      shifted_stel_icosahedron_pts[v + 2] =
-          stel_icosahedron_pts[v + 2] + z_shift;
-    }
-
-    Times<1> irl_gvm_trial_time;
-    std::size_t trial_cells_entered;
-    double irl_gvm_volume;
-
-    irl_gvm_stelIcosahedronOntoCubicMesh(
-        shifted_stel_icosahedron_pts.data(), &irl_gvm_volume,
-        irl_gvm_trial_time.data(), &trial_cells_entered);
+  double max_difference = 0.0;
+};
+
+using InstrumentedFunction = void (*)(const double*, const LocalizerMesh&,
+                                      double*, double*, std::size_t*,
+                                      TraversalStats*);
+
+// Distributes a_pts with the instrumented traversal and adds its counters
+// to a_totals, keeping the largest difference from a_graph_volume relative
+// to a_total_volume.
+void runTraversal(const double* a_pts, const LocalizerMesh& a_mesh,
+                  const double a_graph_volume, const double a_total_volume,
+                  InstrumentedFunction a_instrumented,
+                  TraversalTotals* a_totals) {
+  Times<1> trial_time;
+  std::size_t cells_entered;
+  double volume;
+  TraversalStats stats;
+  a_instrumented(a_pts, a_mesh, &volume, trial_time.data(), &cells_entered,
+                 &stats);
+  a_totals->stats += stats;
+  a_totals->times += trial_time;
+  a_totals->cells_entered += cells_entered;
+  a_totals->max_difference =
+      std::max(a_totals->max_difference,
+               std::fabs(volume - a_graph_volume) / a_total_volume);
+}
 
-    const double error = std::fabs(1.0 - irl_gvm_volume / total_volume);
-    volume_error += error;
-    abs_volume_error = std::max(abs_volume_error, error);
+// Adds to a line of distribution_timing.txt, per trial, the links
+// visited, links left with no volume, planes tested and truncations
+// performed, then the largest stack depth and scratch bytes of any trial,
+// the average cells entered and total time of the instrumented traversal,
+// and its largest difference from IRL.
+void writeTraversal(FILE* a_distribute_file, const TraversalTotals& a_totals,
+                    const int a_number_of_trials) {
+  const double trials = static_cast<double>(a_number_of_trials);
+  fprintf(a_distribute_file,
+          " %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+          "%19.13e %19.13e",
+          static_cast<double>(a_totals.stats.links_visited) / trials,
+          static_cast<double>(a_totals.stats.empty_links) / trials,
+          static_cast<double>(a_totals.stats.planes_tested) / trials,
+          static_cast<double>(a_totals.stats.truncations) / trials,
+          static_cast<double>(a_totals.stats.max_stack_depth),
+          static_cast<double>(a_totals.stats.peak_scratch_bytes),
+          static_cast<double>(a_totals.cells_entered) / trials,
+          a_totals.times[0], a_totals.max_difference);
+}
 
-    if (!sameVolumesFound(total_volume, irl_gvm_volume)) {
-      printf("Shift of %20.12e %20.12e %20.12e\n", x_shift, y_shift, z_shift);
-      std::exit(-1);
-    }
-    irl_gvm_times += irl_gvm_trial_time;
-    cells_entered += trial_cells_entered;
-  }
-  // Write out time in seconds
-  fprintf(a_distribute_file, "%19.13e %19.13e %19.13e %19.13e\n",
-          static_cast<double>(cells_entered) /
-              static_cast<double>(a_number_of_trials),
-          volume_error / static_cast<double>(a_number_of_trials), abs_volume_error,
-          irl_gvm_times[0]);
+// Relative volume left unfound at which the early exit traversal stops,
+// the same tolerance sameVolumesFound checks conservation to
+constexpr double kEarlyExitTolerance = 1.0e-14;
+
+// Totals over the trials of one distribution test for the in-repo
+// traversal run over every link and stopped early once the volume of the
+// polyhedron is found, only gathered when kRunEarlyExit is true
+struct EarlyExitTotals {
+  Times<1> full_times;
+  Times<1> early_exit_times;
+  std::size_t skipped_links = 0;
+  double volume_error = 0.0;
+  double abs_volume_error = 0.0;
+};
+
+using EarlyExitFunction = void (*)(const double*, const LocalizerMesh&,
+                                   const double, const double, double*,
+                                   double*, std::size_t*, std::size_t*);
+
+// Distributes a_pts with the in-repo traversal, once over every link and
+// once stopping early, and adds the results to a_totals.
+void runEarlyExit(const double* a_pts, const LocalizerMesh& a_mesh,
+                  const double a_total_volume,
+                  InstrumentedFunction a_full_traversal,
+                  EarlyExitFunction a_early_exit, EarlyExitTotals* a_totals) {
+  Times<1> trial_time;
+  std::size_t cells_entered;
+  double volume;
+  TraversalStats stats;
+  a_full_traversal(a_pts, a_mesh, &volume, trial_time.data(), &cells_entered,
+                   &stats);
+  a_totals->full_times += trial_time;
+
+  std::size_t skipped_links;
+  a_early_exit(a_pts, a_mesh, a_total_volume, kEarlyExitTolerance, &volume,
+               trial_time.data(), &cells_entered, &skipped_links);
+  a_totals->early_exit_times += trial_time;
+  a_totals->skipped_links += skipped_links;
+  const double error = std::fabs(1.0 - volume / a_total_volume);
+  a_totals->volume_error += error;
+  a_totals->abs_volume_error = std::max(a_totals->abs_volume_error, error);
 }
 
-void distributeCubeOntoTetMesh(FILE* a_distribute_file,
-                               const int a_number_of_trials) {
-  // Pass cube as lower and upper bounding box points
-  const std::array<double, 6> cube{{-1.5, -1.5, -1.5, 1.5, 1.5, 1.5}};
-  const auto total_volume = 27.0;
+// Adds to a line of distribution_timing.txt the average links skipped by
+// the early exit, the total times of the full and early exit traversals,
+// the time saved, and the mean and max conservation error of the early
+// exit.
+void writeEarlyExit(FILE* a_distribute_file, const EarlyExitTotals& a_totals,
+                    const int a_number_of_trials) {
+  const double trials = static_cast<double>(a_number_of_trials);
+  fprintf(a_distribute_file,
+          " %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e",
+          static_cast<double>(a_totals.skipped_links) / trials,
+          a_totals.full_times[0], a_totals.early_exit_times[0],
+          a_totals.full_times[0] - a_totals.early_exit_times[0],
+          a_totals.volume_error / trials, a_totals.abs_volume_error);
+}
 
-  // Will distribute onto a region covering [-1.5,1.5]^3
+// Distribution functions of one polyhedron, for each way it can be
+// distributed onto a LocalizerMesh
+struct MeshDistributeFunctions {
+  DistributeFunction distribute;
+  BruteForceFunction brute_force;
+  FilteredFunction filtered;
+  InstrumentedFunction instrumented;
+  EarlyExitFunction early_exit;
+};
+
+// Distributes a polyhedron onto a_mesh a_number_of_trials times, each
+// time shifted by up to 1 in each direction. a_pts holds
+// a_number_of_values coordinates, ordered X/Y/Z, of a polyhedron of volume
+// a_total_volume. Each trial is distributed starting from the cell holding
+// its center and from the fixed seed of the mesh, and the run stops if
+// either loses volume. Writes one line of distribution_timing.txt with the
+// average cells entered, the mean and max conservation error, the total
+// time, the mesh setup time and bytes held by the mesh, and the average
+// cells entered and total time from the fixed seed. The line goes on with
+// the baselines when kRunDistributionBaselines is true, the early exit
+// when kRunEarlyExit is true, and the traversal counters when
+// kCollectTraversalStats is true; each is only run when enabled.
+void distributeOntoMesh(FILE* a_distribute_file, const double* a_pts,
+                        const std::size_t a_number_of_values,
+                        const double a_total_volume,
+                        const LocalizerMesh& a_mesh,
+                        const int a_number_of_trials,
+                        const MeshDistributeFunctions& a_functions) {
+  std::unique_ptr<CellBoxTree> tree;
+  if (kRunDistributionBaselines) {
+    tree.reset(new CellBoxTree(CellBoxTree::fromMesh(a_mesh)));
+  }
+  BaselineTotals baselines;
+  EarlyExitTotals early_exit;
+  TraversalTotals traversal;
   Times<1> irl_gvm_times;
+  Times<1> fixed_seed_times;
   std::size_t cells_entered = 0;
+  std::size_t fixed_seed_cells_entered = 0;
   double volume_error = 0.0;
-  double abs_volume_error = -DBL_MAX;  
+  double abs_volume_error = -DBL_MAX;
+  std::vector<double> shifted_pts(a_number_of_values);
   for (int n = 0; n < a_number_of_trials; ++n) {
-    const double x_shift = randomDouble();
-    const double y_shift = randomDouble();
-    const double z_shift = randomDouble();
-    std::array<double, 6> shifted_cube;
-    for (std::size_t v = 0; v < shifted_cube.size(); v += 3) {
-      shifted_cube[v] = cube[v] + x_shift;
-      shifted_cube[v + 1] = cube[v + 1] + y_shift;
-      shifted_cube[v + 2] = cube[v + 2] + z_shift;
+    const std::array<double, 3> shift{
+        {randomDouble(), randomDouble(), randomDouble()}};
+    for (std::size_t v = 0; v < a_number_of_values; ++v) {
+      shifted_pts[v] = a_pts[v] + shift[v % 3];
     }
+
     Times<1> irl_gvm_trial_time;
     std::size_t trial_cells_entered;
     double irl_gvm_volume;
+    a_functions.distribute(shifted_pts.data(), a_mesh, true, &irl_gvm_volume,
+                           irl_gvm_trial_time.data(), &trial_cells_entered);
+
+    // Same distribution started from the fixed seed of the mesh, which
+    // also enters the cells on the way to the polyhedron
+    Times<1> fixed_seed_trial_time;
+    std::size_t trial_fixed_seed_cells_entered;
+    double fixed_seed_volume;
+    a_functions.distribute(shifted_pts.data(), a_mesh, false,
+                           &fixed_seed_volume, fixed_seed_trial_time.data(),
+                           &trial_fixed_seed_cells_entered);
+
+    // Same trial clipped against every cell, and against the cells whose
+    // boxes overlap the box of the polyhedron
+    if (kRunDistributionBaselines) {
+      runBaselines(shifted_pts.data(), a_mesh, *tree, irl_gvm_volume,
+                   a_total_volume, a_functions.brute_force,
+                   a_functions.filtered, &baselines);
+    }
+    // Same trial with the in-repo traversal, over every link and stopping
+    // once the volume of the polyhedron is found
+    if (kRunEarlyExit) {
+      runEarlyExit(shifted_pts.data(), a_mesh, a_total_volume,
+                   a_functions.instrumented, a_functions.early_exit,
+                   &early_exit);
+    }
+    if (kCollectTraversalStats) {
+      runTraversal(shifted_pts.data(), a_mesh, irl_gvm_volume, a_total_volume,
+                   a_functions.instrumented, &traversal);
+    }
 
-    irl_gvm_cubeOntoTetMesh(shifted_cube.data(), &irl_gvm_volume,
-                            irl_gvm_trial_time.data(), &trial_cells_entered);
-
-    const double error = std::fabs(1.0 - irl_gvm_volume / total_volume);
+    const double error = std::fabs(1.0 - irl_gvm_volume / a_total_volume);
     volume_error += error;
     abs_volume_error = std::max(abs_volume_error, error);
 
-    if (!sameVolumesFound(total_volume, irl_gvm_volume)) {
-      printf("Shift of %20.12e %20.12e %20.12e\n", x_shift, y_shift, z_shift);
-      printf(
-          "Shifted cube defined by: \n (%20.12e %20.12e %20.12e), (%20.12e "
-          "%20.12e %20.12e)\n",
-          shifted_cube[0], shifted_cube[1], shifted_cube[2], shifted_cube[3],
-          shifted_cube[4], shifted_cube[5]);
+    if (!sameVolumesFound(a_total_volume, irl_gvm_volume) ||
+        !sameVolumesFound(a_total_volume, fixed_seed_volume)) {
+      printf("Shift of %20.12e %20.12e %20.12e\n", shift[0], shift[1],
+             shift[2]);
+      printf("Shifted polyhedron defined by: \n");
+      for (std::size_t v = 0; v < a_number_of_values; v += 3) {
+        printf(" (%20.12e %20.12e %20.12e)\n", shifted_pts[v],
+               shifted_pts[v + 1], shifted_pts[v + 2]);
+      }
       std::exit(-1);
     }
     irl_gvm_times += irl_gvm_trial_time;
     cells_entered += trial_cells_entered;
+    fixed_seed_times += fixed_seed_trial_time;
+    fixed_seed_cells_entered += trial_fixed_seed_cells_entered;
   }
-  // Write out time in seconds
-  fprintf(a_distribute_file, "%19.13e %19.13e %19.13e %19.13e\n",
+  // Write out time in seconds and mesh memory in bytes
+  fprintf(a_distribute_file,
+          "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+          "%19.13e",
           static_cast<double>(cells_entered) /
               static_cast<double>(a_number_of_trials),
-          volume_error / static_cast<double>(a_number_of_trials), abs_volume_error,
-          irl_gvm_times[0]);
+          volume_error / static_cast<double>(a_number_of_trials),
+          abs_volume_error, irl_gvm_times[0], a_mesh.getSetupTime(),
+          static_cast<double>(a_mesh.getMemoryFootprint()),
+          static_cast<double>(fixed_seed_cells_entered) /
+              static_cast<double>(a_number_of_trials),
+          fixed_seed_times[0]);
+  if (kRunDistributionBaselines) {
+    writeBaselines(a_distribute_file, baselines, *tree, a_number_of_trials);
+  }
+  if (kRunEarlyExit) {
+    writeEarlyExit(a_distribute_file, early_exit, a_number_of_trials);
+  }
+  if (kCollectTraversalStats) {
+    writeTraversal(a_distribute_file, traversal, a_number_of_trials);
+  }
+  fprintf(a_distribute_file, "\n");
 }
 
-void distributeStelIcosahedronOntoTetMesh(FILE* a_distribute_file,
-                                          const int a_number_of_trials) {
+// Distribution functions for the cube, given as its lower and upper
+// bounding box points
+constexpr MeshDistributeFunctions kCubeFunctions{
+    irl_gvm_cubeOntoMesh, irl_gvm_cubeOntoMeshBruteForce,
+    irl_gvm_cubeOntoMeshFiltered, irl_gvm_cubeOntoMeshInstrumented,
+    irl_gvm_cubeOntoMeshEarlyExit};
+
+constexpr MeshDistributeFunctions kStelIcosahedronFunctions{
+    irl_gvm_stelIcosahedronOntoMesh,
+    irl_gvm_stelIcosahedronOntoMeshBruteForce,
+    irl_gvm_stelIcosahedronOntoMeshFiltered,
+    irl_gvm_stelIcosahedronOntoMeshInstrumented,
+    irl_gvm_stelIcosahedronOntoMeshEarlyExit};
+
+// Cube spanning [-1.5,1.5]^3 before it is shifted
+constexpr std::array<double, 6> kCube{{-1.5, -1.5, -1.5, 1.5, 1.5, 1.5}};
+
+// Distributes the cube onto a_mesh
+void distributeCubeOntoMesh(FILE* a_distribute_file,
+                            const LocalizerMesh& a_mesh,
+                            const int a_number_of_trials) {
+  distributeOntoMesh(a_distribute_file, kCube.data(), kCube.size(), 27.0,
+                     a_mesh, a_number_of_trials, kCubeFunctions);
+}
+
+// Distributes the stellated icosahedron onto a_mesh
+void distributeStelIcosahedronOntoMesh(FILE* a_distribute_file,
+                                       const LocalizerMesh& a_mesh,
+                                       const int a_number_of_trials) {
   // A Stellated Icosahedron. Object is non-convex.
   // Note: Matches VOFtools NCICOSAMESH object
   // 32 points, ordered Pt 1 X/Y/Z, Pt 2 X/Y/Z, ...
@@ -194,157 +377,504 @@ void distributeStelIcosahedronOntoTetMesh(FILE* a_distribute_file,
   // Set volume of whole object
   const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
       32, stel_icosahedron_pts.data());
-  const double total_volume = stel_icosahedron.calculateVolume();
+  distributeOntoMesh(a_distribute_file, stel_icosahedron_pts.data(),
+                     stel_icosahedron_pts.size(),
+                     stel_icosahedron.calculateVolume(), a_mesh,
+                     a_number_of_trials, kStelIcosahedronFunctions);
+}
 
+}  // namespace
+
+void distributeCubeOntoCubicMesh(FILE* a_distribute_file,
+                                 const int a_number_of_trials) {
   // Will distribute onto a region covering [-3,3]^3
-  Times<1> irl_gvm_times;
-  std::size_t cells_entered = 0;
-  double volume_error = 0.0;
-  double abs_volume_error = -DBL_MAX;  
-  for (int n = 0; n < a_number_of_trials; ++n) {
-    const double x_shift = randomDouble();
-    const double y_shift = randomDouble();
-    const double z_shift = randomDouble();
-    std::array<double, 96> shifted_stel_icosahedron_pts;
-    for (std::size_t v = 0; v < stel_icosahedron_pts.size(); v += 3) {
-      shifted_stel_icosahedron_pts[v] = stel_icosahedron_pts[v] + x_shift;
-      shifted_stel_icosahedron_pts[v + 1] =
-          stel_icosahedron_pts[v + 1] + y_shift;
-      shifted_stel_icosahedron_pts[v + 2] =
-          stel_icosahedron_pts[v + 2] + z_shift;
-    }
-    Times<1> irl_gvm_trial_time;
-    std::size_t trial_cells_entered;
-    double irl_gvm_volume;
+  const auto mesh = LocalizerMesh::fromCubic(
+      {{IRL::Pt(-3.0, -3.0, -3.0), IRL::Pt(3.0, 3.0, 3.0)}}, {{3, 3, 3}});
+  distributeCubeOntoMesh(a_distribute_file, mesh, a_number_of_trials);
+}
 
-    irl_gvm_stelIcosahedronOntoTetMesh(
-        shifted_stel_icosahedron_pts.data(), &irl_gvm_volume,
-        irl_gvm_trial_time.data(), &trial_cells_entered);
+void distributeStelIcosahedronOntoCubicMesh(FILE* a_distribute_file,
+                                            const int a_number_of_trials) {
+  // Will distribute onto a region covering [-3,3]^3
+  const auto mesh = LocalizerMesh::fromCubic(
+      {{IRL::Pt(-3.0, -3.0, -3.0), IRL::Pt(3.0, 3.0, 3.0)}}, {{3, 3, 3}});
+  distributeStelIcosahedronOntoMesh(a_distribute_file, mesh,
+                                    a_number_of_trials);
+}
 
-    const double error = std::fabs(1.0 - irl_gvm_volume / total_volume);
-    volume_error += error;
-    abs_volume_error = std::max(abs_volume_error, error);
+void distributeCubeOntoTetMesh(FILE* a_distribute_file,
+                               const int a_number_of_trials) {
+  // Will distribute onto a region covering [-3,3]^3
+  const auto mesh = LocalizerMesh::fromTet(
+      {{IRL::Pt(-3.0, -3.0, -3.0), IRL::Pt(3.0, 3.0, 3.0)}});
+  distributeCubeOntoMesh(a_distribute_file, mesh, a_number_of_trials);
+}
 
-    if (!sameVolumesFound(total_volume, irl_gvm_volume)) {
-      printf("Shift of %20.12e %20.12e %20.12e\n", x_shift, y_shift, z_shift);
-      std::exit(-1);
-    }
-    irl_gvm_times += irl_gvm_trial_time;
-    cells_entered += trial_cells_entered;
-  }
-  // Write out time in seconds
-  fprintf(a_distribute_file, "%19.13e %19.13e %19.13e %19.13e\n",
-          static_cast<double>(cells_entered) /
-              static_cast<double>(a_number_of_trials),
-          volume_error / static_cast<double>(a_number_of_trials), abs_volume_error,
-          irl_gvm_times[0]);
+void distributeStelIcosahedronOntoTetMesh(FILE* a_distribute_file,
+                                          const int a_number_of_trials) {
+  // Will distribute onto a region covering [-3,3]^3
+  const auto mesh = LocalizerMesh::fromTet(
+      {{IRL::Pt(-3.0, -3.0, -3.0), IRL::Pt(3.0, 3.0, 3.0)}});
+  distributeStelIcosahedronOntoMesh(a_distribute_file, mesh,
+                                    a_number_of_trials);
 }
 
 void distributeCubeOntoSphericalCartesianMesh(FILE* a_distribute_file,
                                               const int a_number_of_trials) {
-  // Pass cube as lower and upper bounding box points
-  const std::array<double, 6> cube{{-1.5, -1.5, -1.5, 1.5, 1.5, 1.5}};
-  const auto total_volume = 27.0;
-
-  // Will distribute onto a region covering [-1.5,1.5]^3
-  Times<1> irl_gvm_times;
-  std::size_t cells_entered = 0;
-  double volume_error = 0.0;
-  double abs_volume_error = -DBL_MAX;  
-  for (int n = 0; n < a_number_of_trials; ++n) {
-    const double x_shift = randomDouble();
-    const double y_shift = randomDouble();
-    const double z_shift = randomDouble();
-    std::array<double, 6> shifted_cube;
-    for (std::size_t v = 0; v < shifted_cube.size(); v += 3) {
-      shifted_cube[v] = cube[v] + x_shift;
-      shifted_cube[v + 1] = cube[v + 1] + y_shift;
-      shifted_cube[v + 2] = cube[v + 2] + z_shift;
-    }
-    Times<1> irl_gvm_trial_time;
-    std::size_t trial_cells_entered;
-    double irl_gvm_volume;
+  // Will distribute onto a sphere enclosing [-3,3]^3
+  const auto mesh = LocalizerMesh::fromSphericalCartesian(
+      0.5 * std::sqrt(3.0 * 6.0 * 6.0), 4, 3, 3);
+  distributeCubeOntoMesh(a_distribute_file, mesh, a_number_of_trials);
+}
 
-    irl_gvm_cubeOntoSphericalCartesianMesh(shifted_cube.data(), &irl_gvm_volume,
-                                           irl_gvm_trial_time.data(),
-                                           &trial_cells_entered);
+void distributeStelIcosahedronOntoSphericalCartesianMesh(
+    FILE* a_distribute_file, const int a_number_of_trials) {
+  // Will distribute onto a sphere enclosing [-3,3]^3
+  const auto mesh = LocalizerMesh::fromSphericalCartesian(
+      0.5 * std::sqrt(3.0 * 6.0 * 6.0), 4, 3, 3);
+  distributeStelIcosahedronOntoMesh(a_distribute_file, mesh,
+                                    a_number_of_trials);
+}
 
-    const double error = std::fabs(1.0 - irl_gvm_volume / total_volume);
-    volume_error += error;
-    abs_volume_error = std::max(abs_volume_error, error);
+namespace {
+
+using CellsDistributeFunction = void (*)(const double*, const LocalizerMesh&,
+                                         double*, double*, double*,
+                                         std::size_t*);
+using CartesianDistributeFunction = void (*)(const double*, const double*,
+                                             const int*, double*, double*,
+                                             double*, std::size_t*);
+
+// Largest difference allowed between the per-cell volumes from IRL and
+// the slab engine, summed over all trials, relative to the summed volume
+// of the polyhedra
+constexpr double kCellTolerance = 1.0e-12;
+
+// Distributes a polyhedron onto Cartesian meshes of [-0.5,0.5]^3 with
+// resolutions doubling from 4 cells per direction up to a_max_ncells.
+// a_pts holds a_number_of_values coordinates, ordered X/Y/Z, of a
+// polyhedron centered on the origin with widest extent a_extent and
+// volume a_volume. On each mesh it is scaled to span a_size_ratio cells
+// and randomly shifted by up to half a cell. Meshes too coarse to hold
+// it are skipped. For each mesh, writes the cells per direction, the
+// average cells entered, the time per polyhedron, the time per entered
+// cell, the mesh setup time, the bytes held by the mesh, and the mean and
+// max conservation error. The same trials are then distributed with the
+// axis-aligned engine in slab_distribution.h, adding its average cells
+// entered, time per polyhedron, mean and max conservation error, and the
+// largest difference between the per-cell volumes from IRL and the slab
+// engine, relative to the volume of one polyhedron; the run stops if the
+// two disagree beyond kCellTolerance. Then the same trials are voxelized
+// with R3D (r3d_distribution.h), adding its average cells given a nonzero
+// volume, time per polyhedron, mean and max conservation error, and the
+// largest per-cell difference from IRL relative to the volume of one
+// polyhedron. When kCountAllocations is true, the line ends with the heap
+// allocations per call made by IRL and by the slab engine.
+void sweepOntoCartesianMesh(FILE* a_sweep_file, const double* a_pts,
+                            const std::size_t a_number_of_values,
+                            const double a_extent, const double a_volume,
+                            const int a_number_of_trials,
+                            const int a_max_ncells, const double a_size_ratio,
+                            DistributeFunction a_distribute,
+                            CellsDistributeFunction a_cells_distribute,
+                            CartesianDistributeFunction a_slab_distribute,
+                            CartesianDistributeFunction a_r3d_distribute) {
+  std::vector<int> resolutions;
+  for (int ncells = 4; ncells < a_max_ncells; ncells *= 2) {
+    resolutions.push_back(ncells);
+  }
+  resolutions.push_back(a_max_ncells);
 
-    if (!sameVolumesFound(total_volume, irl_gvm_volume)) {
-      printf("Shift of %20.12e %20.12e %20.12e\n", x_shift, y_shift, z_shift);
-      printf(
-          "Shifted cube defined by: \n (%20.12e %20.12e %20.12e), (%20.12e "
-          "%20.12e %20.12e)\n",
-          shifted_cube[0], shifted_cube[1], shifted_cube[2], shifted_cube[3],
-          shifted_cube[4], shifted_cube[5]);
+  std::vector<double> shifted_pts(a_number_of_values);
+  for (const int ncells : resolutions) {
+    if (a_size_ratio + 1.0 > static_cast<double>(ncells)) {
+      continue;
+    }
+    const double dx = 1.0 / static_cast<double>(ncells);
+    const double scale = a_size_ratio * dx / a_extent;
+    const double total_volume = a_volume * scale * scale * scale;
+    const auto mesh = LocalizerMesh::fromCubic(
+        {{IRL::Pt(-0.5, -0.5, -0.5), IRL::Pt(0.5, 0.5, 0.5)}},
+        {{ncells, ncells, ncells}});
+    const std::array<double, 6> mesh_bounds{{-0.5, -0.5, -0.5, 0.5, 0.5, 0.5}};
+    const std::array<int, 3> mesh_ncells{{ncells, ncells, ncells}};
+    std::vector<double> irl_gvm_cell_volumes(ncells * ncells * ncells, 0.0);
+    std::vector<double> slab_cell_volumes(ncells * ncells * ncells, 0.0);
+    std::vector<double> r3d_cell_volumes(ncells * ncells * ncells, 0.0);
+    std::size_t irl_gvm_allocations = 0;
+    std::size_t slab_allocations = 0;
+
+    Times<1> irl_gvm_times;
+    Times<1> slab_times;
+    std::size_t cells_entered = 0;
+    std::size_t slab_cells_entered = 0;
+    double slab_volume_error = 0.0;
+    double slab_abs_volume_error = -DBL_MAX;
+    Times<1> r3d_times;
+    std::size_t r3d_cells_entered = 0;
+    double r3d_volume_error = 0.0;
+    double r3d_abs_volume_error = -DBL_MAX;
+    double volume_error = 0.0;
+    double abs_volume_error = -DBL_MAX;
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      const std::array<double, 3> shift{{0.5 * dx * randomDouble(),
+                                         0.5 * dx * randomDouble(),
+                                         0.5 * dx * randomDouble()}};
+      for (std::size_t v = 0; v < a_number_of_values; ++v) {
+        shifted_pts[v] = a_pts[v] * scale + shift[v % 3];
+      }
+
+      Times<1> irl_gvm_trial_time;
+      std::size_t trial_cells_entered;
+      double irl_gvm_volume;
+      std::size_t allocations = getAllocationCount();
+      a_distribute(shifted_pts.data(), mesh, true, &irl_gvm_volume,
+                   irl_gvm_trial_time.data(), &trial_cells_entered);
+      irl_gvm_allocations += getAllocationCount() - allocations;
+
+      const double error = std::fabs(1.0 - irl_gvm_volume / total_volume);
+      volume_error += error;
+      abs_volume_error = std::max(abs_volume_error, error);
+      irl_gvm_times += irl_gvm_trial_time;
+      cells_entered += trial_cells_entered;
+
+      // Same distribution, scattered into the per-cell array for the
+      // comparison with the slab engine and R3D. It is neither timed nor
+      // counted: IRL's getVolumeMoments returns a new
+      // TaggedAccumulatedVolumeMoments on every call, so this path cannot
+      // reuse storage and allocates as the call above does.
+      Times<1> cells_trial_time;
+      a_cells_distribute(shifted_pts.data(), mesh,
+                         irl_gvm_cell_volumes.data(), &irl_gvm_volume,
+                         cells_trial_time.data(), &trial_cells_entered);
+
+      Times<1> slab_trial_time;
+      double slab_volume;
+      allocations = getAllocationCount();
+      a_slab_distribute(shifted_pts.data(), mesh_bounds.data(),
+                        mesh_ncells.data(), slab_cell_volumes.data(),
+                        &slab_volume, slab_trial_time.data(),
+                        &trial_cells_entered);
+      slab_allocations += getAllocationCount() - allocations;
+
+      const double slab_error = std::fabs(1.0 - slab_volume / total_volume);
+      slab_volume_error += slab_error;
+      slab_abs_volume_error = std::max(slab_abs_volume_error, slab_error);
+      slab_times += slab_trial_time;
+      slab_cells_entered += trial_cells_entered;
+
+      Times<1> r3d_trial_time;
+      double r3d_volume;
+      a_r3d_distribute(shifted_pts.data(), mesh_bounds.data(),
+                       mesh_ncells.data(), r3d_cell_volumes.data(),
+                       &r3d_volume, r3d_trial_time.data(),
+                       &trial_cells_entered);
+
+      const double r3d_error = std::fabs(1.0 - r3d_volume / total_volume);
+      r3d_volume_error += r3d_error;
+      r3d_abs_volume_error = std::max(r3d_abs_volume_error, r3d_error);
+      r3d_times += r3d_trial_time;
+      r3d_cells_entered += trial_cells_entered;
+    }
+    double max_cell_difference = 0.0;
+    double r3d_max_cell_difference = 0.0;
+    for (std::size_t c = 0; c < slab_cell_volumes.size(); ++c) {
+      max_cell_difference =
+          std::max(max_cell_difference,
+                   std::fabs(irl_gvm_cell_volumes[c] - slab_cell_volumes[c]));
+      r3d_max_cell_difference =
+          std::max(r3d_max_cell_difference,
+                   std::fabs(irl_gvm_cell_volumes[c] - r3d_cell_volumes[c]));
+    }
+    if (max_cell_difference > kCellTolerance * total_volume *
+                                  static_cast<double>(a_number_of_trials)) {
+      printf("Slab engine and IRL cell volumes differ by %20.15e\n",
+             max_cell_difference);
+      printf("Mesh of %d cells per direction\n", ncells);
       std::exit(-1);
     }
-    irl_gvm_times += irl_gvm_trial_time;
-    cells_entered += trial_cells_entered;
+    // Write out time in seconds and mesh memory in bytes
+    fprintf(a_sweep_file,
+            "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+            "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+            "%19.13e %19.13e %19.13e %19.13e",
+            static_cast<double>(ncells),
+            static_cast<double>(cells_entered) /
+                static_cast<double>(a_number_of_trials),
+            irl_gvm_times[0] / static_cast<double>(a_number_of_trials),
+            irl_gvm_times[0] / static_cast<double>(cells_entered),
+            mesh.getSetupTime(),
+            static_cast<double>(mesh.getMemoryFootprint()),
+            volume_error / static_cast<double>(a_number_of_trials),
+            abs_volume_error,
+            static_cast<double>(slab_cells_entered) /
+                static_cast<double>(a_number_of_trials),
+            slab_times[0] / static_cast<double>(a_number_of_trials),
+            slab_volume_error / static_cast<double>(a_number_of_trials),
+            slab_abs_volume_error, max_cell_difference / total_volume,
+            static_cast<double>(r3d_cells_entered) /
+                static_cast<double>(a_number_of_trials),
+            r3d_times[0] / static_cast<double>(a_number_of_trials),
+            r3d_volume_error / static_cast<double>(a_number_of_trials),
+            r3d_abs_volume_error, r3d_max_cell_difference / total_volume);
+    if (kCountAllocations) {
+      fprintf(a_sweep_file, " %19.13e %19.13e",
+              static_cast<double>(irl_gvm_allocations) /
+                  static_cast<double>(a_number_of_trials),
+              static_cast<double>(slab_allocations) /
+                  static_cast<double>(a_number_of_trials));
+    }
+    fprintf(a_sweep_file, "\n");
+    fflush(a_sweep_file);
   }
-  // Write out time in seconds
-  fprintf(a_distribute_file, "%19.13e %19.13e %19.13e %19.13e\n",
-          static_cast<double>(cells_entered) /
-              static_cast<double>(a_number_of_trials),
-          volume_error / static_cast<double>(a_number_of_trials), abs_volume_error,
-          irl_gvm_times[0]);
 }
 
-void distributeStelIcosahedronOntoSphericalCartesianMesh(
-    FILE* a_distribute_file, const int a_number_of_trials) {
+}  // namespace
+
+void sweepCubeOntoCartesianMesh(FILE* a_sweep_file,
+                                const int a_number_of_trials,
+                                const int a_max_ncells,
+                                const double a_size_ratio) {
+  // Pass cube as lower and upper bounding box points
+  const std::array<double, 6> cube{{-0.5, -0.5, -0.5, 0.5, 0.5, 0.5}};
+  sweepOntoCartesianMesh(a_sweep_file, cube.data(), cube.size(), 1.0, 1.0,
+                         a_number_of_trials, a_max_ncells, a_size_ratio,
+                         irl_gvm_cubeOntoMesh, irl_gvm_cubeOntoMeshCells,
+                         slab_cubeOntoCartesianMesh,
+                         r3d_cubeOntoCartesianMesh);
+}
+
+void sweepStelIcosahedronOntoCartesianMesh(FILE* a_sweep_file,
+                                           const int a_number_of_trials,
+                                           const int a_max_ncells,
+                                           const double a_size_ratio) {
   // A Stellated Icosahedron. Object is non-convex.
   // Note: Matches VOFtools NCICOSAMESH object
   // 32 points, ordered Pt 1 X/Y/Z, Pt 2 X/Y/Z, ...
   const auto stel_icosahedron_pts = getStelIcosahedronPts();
-
-  // Set volume of whole object
   const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
       32, stel_icosahedron_pts.data());
-  const double total_volume = stel_icosahedron.calculateVolume();
 
-  // Will distribute onto a region covering [-3.0,3.0]^3
-  Times<1> irl_gvm_times;
-  std::size_t cells_entered = 0;
-  double volume_error = 0.0;
-  double abs_volume_error = -DBL_MAX;
-  for (int n = 0; n < a_number_of_trials; ++n) {
-    const double x_shift = randomDouble();
-    const double y_shift = randomDouble();
-    const double z_shift = randomDouble();
-    std::array<double, 96> shifted_stel_icosahedron_pts;
-    for (std::size_t v = 0; v < stel_icosahedron_pts.size(); v += 3) {
-      shifted_stel_icosahedron_pts[v] = stel_icosahedron_pts[v] + x_shift;
-      shifted_stel_icosahedron_pts[v + 1] =
-          stel_icosahedron_pts[v + 1] + y_shift;
-      shifted_stel_icosahedron_pts[v + 2] =
-          stel_icosahedron_pts[v + 2] + z_shift;
+  // Object is centered on the origin, so its widest extent is
+  // twice the largest coordinate magnitude.
+  double extent = 0.0;
+  for (const auto coordinate : stel_icosahedron_pts) {
+    extent = std::max(extent, 2.0 * std::fabs(coordinate));
+  }
+  sweepOntoCartesianMesh(a_sweep_file, stel_icosahedron_pts.data(),
+                         stel_icosahedron_pts.size(), extent,
+                         stel_icosahedron.calculateVolume(),
+                         a_number_of_trials, a_max_ncells, a_size_ratio,
+                         irl_gvm_stelIcosahedronOntoMesh,
+                         irl_gvm_stelIcosahedronOntoMeshCells,
+                         slab_stelIcosahedronOntoCartesianMesh,
+                         r3d_stelIcosahedronOntoCartesianMesh);
+}
+
+namespace {
+
+using ParallelDistributeFunction = void (*)(const double*, const int,
+                                            const LocalizerMesh&, const int,
+                                            double*, double*);
+
+// Places a_number_of_polyhedra copies of a polyhedron (given as in
+// sweepOntoCartesianMesh), scaled to span a_size_ratio cells, at random
+// positions inside [-0.5,0.5]^3 and distributes them all onto a Cartesian
+// mesh of a_ncells^3 cells with 1, 2, 4, ... up to the maximum number of
+// OpenMP threads. The mesh is built once and shared by all runs. For each
+// thread count, writes the number of threads, the distribution and
+// reduction times, the polyhedra distributed per second, the speedup over
+// one thread, the conservation error of the total distributed volume, and
+// the mesh setup time and bytes held by the mesh.
+void scaleOntoCartesianMesh(FILE* a_scaling_file, const double* a_pts,
+                            const std::size_t a_number_of_values,
+                            const double a_extent, const double a_volume,
+                            const int a_number_of_polyhedra,
+                            const int a_ncells, const double a_size_ratio,
+                            ParallelDistributeFunction a_distribute) {
+  const double dx = 1.0 / static_cast<double>(a_ncells);
+  const double scale = a_size_ratio * dx / a_extent;
+  const double total_volume = static_cast<double>(a_number_of_polyhedra) *
+                              a_volume * scale * scale * scale;
+  const double max_shift = 0.5 - 0.5 * a_size_ratio * dx;
+
+  std::vector<double> all_pts(a_number_of_polyhedra * a_number_of_values);
+  for (int n = 0; n < a_number_of_polyhedra; ++n) {
+    const std::array<double, 3> shift{{max_shift * randomDouble(),
+                                       max_shift * randomDouble(),
+                                       max_shift * randomDouble()}};
+    for (std::size_t v = 0; v < a_number_of_values; ++v) {
+      all_pts[n * a_number_of_values + v] = a_pts[v] * scale + shift[v % 3];
     }
-    Times<1> irl_gvm_trial_time;
-    std::size_t trial_cells_entered;
-    double irl_gvm_volume;
+  }
 
-    irl_gvm_stelIcosahedronOntoSphericalCartesianMesh(
-        shifted_stel_icosahedron_pts.data(), &irl_gvm_volume,
-        irl_gvm_trial_time.data(), &trial_cells_entered);
+  std::vector<int> thread_counts;
+  const int max_threads = omp_get_max_threads();
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(max_threads);
+
+  const auto mesh = LocalizerMesh::fromCubic(
+      {{IRL::Pt(-0.5, -0.5, -0.5), IRL::Pt(0.5, 0.5, 0.5)}},
+      {{a_ncells, a_ncells, a_ncells}});
+  std::vector<double> cell_volumes(mesh.getNumberOfCells());
+  double serial_rate = 0.0;
+  for (const int threads : thread_counts) {
+    Times<2> irl_gvm_times;
+    a_distribute(all_pts.data(), a_number_of_polyhedra, mesh, threads,
+                 cell_volumes.data(), irl_gvm_times.data());
+
+    double distributed_volume = 0.0;
+    for (const auto volume : cell_volumes) {
+      distributed_volume += volume;
+    }
+    const double rate = static_cast<double>(a_number_of_polyhedra) /
+                        (irl_gvm_times[0] + irl_gvm_times[1]);
+    if (threads == 1) {
+      serial_rate = rate;
+    }
+    // Write out time in seconds and mesh memory in bytes
+    fprintf(a_scaling_file,
+            "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+            "%19.13e\n",
+            static_cast<double>(threads), irl_gvm_times[0], irl_gvm_times[1],
+            rate, rate / serial_rate,
+            std::fabs(1.0 - distributed_volume / total_volume),
+            mesh.getSetupTime(),
+            static_cast<double>(mesh.getMemoryFootprint()));
+    fflush(a_scaling_file);
+  }
+}
 
-    const double error = std::fabs(1.0 - irl_gvm_volume / total_volume);
-    volume_error += error;
-    abs_volume_error = std::max(abs_volume_error, error);
+}  // namespace
 
-    if (!sameVolumesFound(total_volume, irl_gvm_volume)) {
-      printf("Shift of %20.12e %20.12e %20.12e\n", x_shift, y_shift, z_shift);
-      std::exit(-1);
+void scaleCubesOntoCartesianMesh(FILE* a_scaling_file,
+                                 const int a_number_of_polyhedra,
+                                 const int a_ncells,
+                                 const double a_size_ratio) {
+  // Pass cube as lower and upper bounding box points
+  const std::array<double, 6> cube{{-0.5, -0.5, -0.5, 0.5, 0.5, 0.5}};
+  scaleOntoCartesianMesh(a_scaling_file, cube.data(), cube.size(), 1.0, 1.0,
+                         a_number_of_polyhedra, a_ncells, a_size_ratio,
+                         irl_gvm_cubesOntoMesh);
+}
+
+void scaleStelIcosahedraOntoCartesianMesh(FILE* a_scaling_file,
+                                          const int a_number_of_polyhedra,
+                                          const int a_ncells,
+                                          const double a_size_ratio) {
+  const auto stel_icosahedron_pts = getStelIcosahedronPts();
+  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, stel_icosahedron_pts.data());
+
+  // Object is centered on the origin, so its widest extent is
+  // twice the largest coordinate magnitude.
+  double extent = 0.0;
+  for (const auto coordinate : stel_icosahedron_pts) {
+    extent = std::max(extent, 2.0 * std::fabs(coordinate));
+  }
+  scaleOntoCartesianMesh(a_scaling_file, stel_icosahedron_pts.data(),
+                         stel_icosahedron_pts.size(), extent,
+                         stel_icosahedron.calculateVolume(),
+                         a_number_of_polyhedra, a_ncells, a_size_ratio,
+                         irl_gvm_stelIcosahedraOntoMesh);
+}
+
+namespace {
+
+// Distributes a polyhedron onto spherical meshes of radius
+// 0.5*sqrt(3*6^2) with a_radial_cells shells and a_angular_cells x
+// a_angular_cells (theta, phi) sectors, the number of sectors per
+// direction doubling from 3 up to a_max_angular_cells. a_pts holds
+// a_number_of_values coordinates, ordered X/Y/Z, of a polyhedron of volume
+// a_volume, which is shifted by up to 1 in each direction as in
+// distributeCubeOntoSphericalCartesianMesh. For each mesh, writes the
+// sectors per direction, the number of cells, the average cells entered,
+// the time per polyhedron, the time per entered cell, the mesh setup time,
+// the bytes held by the mesh, and the mean and max conservation error.
+void sweepOntoSphericalCartesianMesh(FILE* a_sweep_file, const double* a_pts,
+                                     const std::size_t a_number_of_values,
+                                     const double a_volume,
+                                     const int a_number_of_trials,
+                                     const int a_max_angular_cells,
+                                     const int a_radial_cells,
+                                     DistributeFunction a_distribute) {
+  std::vector<int> resolutions;
+  for (int angular_cells = 3; angular_cells < a_max_angular_cells;
+       angular_cells *= 2) {
+    resolutions.push_back(angular_cells);
+  }
+  resolutions.push_back(a_max_angular_cells);
+
+  std::vector<double> shifted_pts(a_number_of_values);
+  for (const int angular_cells : resolutions) {
+    const auto mesh = LocalizerMesh::fromSphericalCartesian(
+        0.5 * std::sqrt(3.0 * 6.0 * 6.0), a_radial_cells, angular_cells,
+        angular_cells);
+
+    Times<1> irl_gvm_times;
+    std::size_t cells_entered = 0;
+    double volume_error = 0.0;
+    double abs_volume_error = -DBL_MAX;
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      const std::array<double, 3> shift{
+          {randomDouble(), randomDouble(), randomDouble()}};
+      for (std::size_t v = 0; v < a_number_of_values; ++v) {
+        shifted_pts[v] = a_pts[v] + shift[v % 3];
+      }
+
+      Times<1> irl_gvm_trial_time;
+      std::size_t trial_cells_entered;
+      double irl_gvm_volume;
+      a_distribute(shifted_pts.data(), mesh, true, &irl_gvm_volume,
+                   irl_gvm_trial_time.data(), &trial_cells_entered);
+
+      const double error = std::fabs(1.0 - irl_gvm_volume / a_volume);
+      volume_error += error;
+      abs_volume_error = std::max(abs_volume_error, error);
+      irl_gvm_times += irl_gvm_trial_time;
+      cells_entered += trial_cells_entered;
     }
-    irl_gvm_times += irl_gvm_trial_time;
-    cells_entered += trial_cells_entered;
+    // Write out time in seconds and mesh memory in bytes
+    fprintf(a_sweep_file,
+            "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+            "%19.13e %19.13e\n",
+            static_cast<double>(angular_cells),
+            static_cast<double>(mesh.getNumberOfCells()),
+            static_cast<double>(cells_entered) /
+                static_cast<double>(a_number_of_trials),
+            irl_gvm_times[0] / static_cast<double>(a_number_of_trials),
+            irl_gvm_times[0] / static_cast<double>(cells_entered),
+            mesh.getSetupTime(),
+            static_cast<double>(mesh.getMemoryFootprint()),
+            volume_error / static_cast<double>(a_number_of_trials),
+            abs_volume_error);
+    fflush(a_sweep_file);
   }
-  // Write out time in seconds
-  fprintf(a_distribute_file, "%19.13e %19.13e %19.13e %19.13e\n",
-          static_cast<double>(cells_entered) /
-              static_cast<double>(a_number_of_trials),
-          volume_error / static_cast<double>(a_number_of_trials), abs_volume_error,
-          irl_gvm_times[0]);
+}
+
+}  // namespace
+
+void sweepCubeOntoSphericalCartesianMesh(FILE* a_sweep_file,
+                                         const int a_number_of_trials,
+                                         const int a_max_angular_cells,
+                                         const int a_radial_cells) {
+  // Pass cube as lower and upper bounding box points
+  const std::array<double, 6> cube{{-1.5, -1.5, -1.5, 1.5, 1.5, 1.5}};
+  sweepOntoSphericalCartesianMesh(a_sweep_file, cube.data(), cube.size(), 27.0,
+                                  a_number_of_trials, a_max_angular_cells,
+                                  a_radial_cells, irl_gvm_cubeOntoMesh);
+}
+
+void sweepStelIcosahedronOntoSphericalCartesianMesh(
+    FILE* a_sweep_file, const int a_number_of_trials,
+    const int a_max_angular_cells, const int a_radial_cells) {
+  const auto stel_icosahedron_pts = getStelIcosahedronPts();
+  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, stel_icosahedron_pts.data());
+  sweepOntoSphericalCartesianMesh(
+      a_sweep_file, stel_icosahedron_pts.data(), stel_icosahedron_pts.size(),
+      stel_icosahedron.calculateVolume(), a_number_of_trials,
+      a_max_angular_cells, a_radial_cells, irl_gvm_stelIcosahedronOntoMesh);
 }
@@ -9,6 +9,25 @@
 
 #include "src/timing_comp/files.h"
 
+// The distribution tests (case 2) can also run each trial through the
+// baselines that do not use the mesh graph, and through the in-repo
+// traversal with and without its early exit. Each is only run, and its
+// columns only written, when TIMING_COMP_DISTRIBUTION_BASELINES or
+// TIMING_COMP_EARLY_EXIT is defined to a nonzero value
+// (cmake -DDISTRIBUTION_BASELINES=ON or -DEARLY_EXIT=ON).
+
+#ifndef TIMING_COMP_DISTRIBUTION_BASELINES
+#define TIMING_COMP_DISTRIBUTION_BASELINES 0
+#endif
+
+#ifndef TIMING_COMP_EARLY_EXIT
+#define TIMING_COMP_EARLY_EXIT 0
+#endif
+
+static constexpr bool kRunDistributionBaselines =
+    TIMING_COMP_DISTRIBUTION_BASELINES != 0;
+static constexpr bool kRunEarlyExit = TIMING_COMP_EARLY_EXIT != 0;
+
 // Distributes Unit Cube onto Cubic Mesh
 void distributeCubeOntoCubicMesh(FILE* a_distribute_file,
                                  const int a_number_of_trials);
@@ -33,4 +52,50 @@ void distributeCubeOntoSphericalCartesianMesh(FILE* a_distribute_file,
 void distributeStelIcosahedronOntoSphericalCartesianMesh(
     FILE* a_distribute_file, const int a_number_of_trials);
 
+// Distributes Unit Cube onto Cartesian Meshes of increasing resolution,
+// up to a_max_ncells cells per direction, with the cube spanning
+// a_size_ratio cells
+void sweepCubeOntoCartesianMesh(FILE* a_sweep_file,
+                                const int a_number_of_trials,
+                                const int a_max_ncells,
+                                const double a_size_ratio);
+
+// Distributes Stellated Icosahedron onto Cartesian Meshes of increasing
+// resolution, up to a_max_ncells cells per direction, with its widest
+// extent spanning a_size_ratio cells
+void sweepStelIcosahedronOntoCartesianMesh(FILE* a_sweep_file,
+                                           const int a_number_of_trials,
+                                           const int a_max_ncells,
+                                           const double a_size_ratio);
+
+// Distributes many Unit Cubes, each spanning a_size_ratio cells, onto a
+// Cartesian Mesh of a_ncells^3 cells with an increasing number of threads
+void scaleCubesOntoCartesianMesh(FILE* a_scaling_file,
+                                 const int a_number_of_polyhedra,
+                                 const int a_ncells,
+                                 const double a_size_ratio);
+
+// Distributes many Stellated Icosahedra, each spanning a_size_ratio cells,
+// onto a Cartesian Mesh of a_ncells^3 cells with an increasing number of
+// threads
+void scaleStelIcosahedraOntoCartesianMesh(FILE* a_scaling_file,
+                                          const int a_number_of_polyhedra,
+                                          const int a_ncells,
+                                          const double a_size_ratio);
+
+// Distributes Unit Cube onto Spherical Cartesian Meshes of a_radial_cells
+// shells, with the (theta, phi) sectors per direction doubling from 3 up
+// to a_max_angular_cells
+void sweepCubeOntoSphericalCartesianMesh(FILE* a_sweep_file,
+                                         const int a_number_of_trials,
+                                         const int a_max_angular_cells,
+                                         const int a_radial_cells);
+
+// Distributes Stellated Icosahedron onto Spherical Cartesian Meshes of
+// a_radial_cells shells, with the (theta, phi) sectors per direction
+// doubling from 3 up to a_max_angular_cells
+void sweepStelIcosahedronOntoSphericalCartesianMesh(
+    FILE* a_sweep_file, const int a_number_of_trials,
+    const int a_max_angular_cells, const int a_radial_cells);
+
 #endif  // SRC_TIMING_COMP_DISTRIBUTION_TIMING_H_
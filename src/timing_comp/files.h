@@ -14,27 +14,37 @@
 struct Files {
   Files(void) = delete;
 
-  Files(std::string irl_name, std::string r3d_name, std::string voftools_name) {
+  Files(std::string irl_name, std::string r3d_name, std::string voftools_name,
+        std::string r3d_prototype_name,
+        std::string voftools_prototype_name) {
     irl = fopen(irl_name.c_str(), "w");
     r3d = fopen(r3d_name.c_str(), "w");
     voftools = fopen(voftools_name.c_str(), "w");
+    r3d_prototype = fopen(r3d_prototype_name.c_str(), "w");
+    voftools_prototype = fopen(voftools_prototype_name.c_str(), "w");
   }
 
   void writeToFiles(const std::string& a_string) {
     fprintf(irl, "%s", a_string.c_str());
     fprintf(r3d, "%s", a_string.c_str());
     fprintf(voftools, "%s", a_string.c_str());
+    fprintf(r3d_prototype, "%s", a_string.c_str());
+    fprintf(voftools_prototype, "%s", a_string.c_str());
   }
 
   ~Files(void) {
     fclose(irl);
     fclose(r3d);
     fclose(voftools);
+    fclose(r3d_prototype);
+    fclose(voftools_prototype);
   }
 
   FILE* irl;
   FILE* r3d;
   FILE* voftools;
+  FILE* r3d_prototype;
+  FILE* voftools_prototype;
 };
 
 #endif  // SRC_TIMING_COMP_FILES_H_
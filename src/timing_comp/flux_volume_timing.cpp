@@ -0,0 +1,231 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/flux_volume_timing.h"
+
+#include <omp.h>
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "src/timing_comp/files.h"
+#include "src/timing_comp/times.h"
+#include "src/timing_comp/timing_comp.h"
+
+// IRL GVM Timing includes
+#include "src/irl_gvm/irl_gvm_distribution.h"
+#include "src/irl_gvm/localizer_mesh.h"
+
+// IRL source directory
+#include "src/geometry/general/pt.h"
+#include "src/geometry/polyhedrons/symmetric_hexahedron.h"
+
+namespace {
+
+// Largest velocity magnitude of any component of deformationVelocity
+constexpr double kMaxVelocity = 2.0;
+
+// Three-dimensional deformation field of LeVeque (1996), shifted from
+// [0,1]^3 onto [-0.5,0.5]^3. It is zero on the domain boundary, so
+// back-traced vertices never leave the mesh.
+IRL::Pt deformationVelocity(const IRL::Pt& a_pt) {
+  const double x = M_PI * (a_pt[0] + 0.5);
+  const double y = M_PI * (a_pt[1] + 0.5);
+  const double z = M_PI * (a_pt[2] + 0.5);
+  return IRL::Pt(
+      2.0 * std::sin(x) * std::sin(x) * std::sin(2.0 * y) * std::sin(2.0 * z),
+      -std::sin(2.0 * x) * std::sin(y) * std::sin(y) * std::sin(2.0 * z),
+      -std::sin(2.0 * x) * std::sin(2.0 * y) * std::sin(z) * std::sin(z));
+}
+
+// Traces a_pt backwards in time by a_dt with classical fourth order
+// Runge-Kutta
+IRL::Pt backTrace(const IRL::Pt& a_pt, const double a_dt) {
+  const IRL::Pt k1 = deformationVelocity(a_pt);
+  const IRL::Pt k2 = deformationVelocity(
+      IRL::Pt(a_pt[0] - 0.5 * a_dt * k1[0], a_pt[1] - 0.5 * a_dt * k1[1],
+              a_pt[2] - 0.5 * a_dt * k1[2]));
+  const IRL::Pt k3 = deformationVelocity(
+      IRL::Pt(a_pt[0] - 0.5 * a_dt * k2[0], a_pt[1] - 0.5 * a_dt * k2[1],
+              a_pt[2] - 0.5 * a_dt * k2[2]));
+  const IRL::Pt k4 = deformationVelocity(
+      IRL::Pt(a_pt[0] - a_dt * k3[0], a_pt[1] - a_dt * k3[1],
+              a_pt[2] - a_dt * k3[2]));
+  IRL::Pt traced;
+  for (int d = 0; d < 3; ++d) {
+    traced[d] = a_pt[d] - a_dt / 6.0 *
+                              (k1[d] + 2.0 * k2[d] + 2.0 * k3[d] + k4[d]);
+  }
+  return traced;
+}
+
+// Back-traces the (a_ncells+1)^3 mesh vertices and builds the 14 points
+// of the flux volume of every interior face into a_flux_pts, using
+// a_number_of_threads OpenMP threads. Faces normal to direction d take
+// their corners in the order of the two tangent directions (d+1)%3 and
+// (d+2)%3, so the face sits at points 0-3 of the Symmetric Hexahedron,
+// the back-traced face at points 4-7, and points 8-13 are the centroids
+// of the six faces. Returns the wall time taken.
+double buildFluxVolumes(const int a_ncells, const double a_dt,
+                        const int a_number_of_threads,
+                        std::vector<double>* a_vertices,
+                        std::vector<double>* a_flux_pts) {
+  // Vertices of each hexahedron face, in the order of points 8-13
+  static constexpr int kFaceVertices[6][4] = {{0, 1, 2, 3}, {0, 4, 5, 1},
+                                              {1, 5, 6, 2}, {2, 6, 7, 3},
+                                              {3, 7, 4, 0}, {4, 7, 6, 5}};
+  const int n = a_ncells + 1;
+  const int number_of_vertices = n * n * n;
+  const int faces_per_direction = a_ncells * a_ncells * (a_ncells - 1);
+  const double dx = 1.0 / static_cast<double>(a_ncells);
+  const std::array<int, 3> stride{{1, n, n * n}};
+
+  const double start = omp_get_wtime();
+#pragma omp parallel num_threads(a_number_of_threads)
+  {
+#pragma omp for schedule(static)
+    for (int v = 0; v < number_of_vertices; ++v) {
+      const IRL::Pt vertex(-0.5 + static_cast<double>(v % n) * dx,
+                           -0.5 + static_cast<double>((v / n) % n) * dx,
+                           -0.5 + static_cast<double>(v / (n * n)) * dx);
+      const IRL::Pt traced = backTrace(vertex, a_dt);
+      for (int d = 0; d < 3; ++d) {
+        (*a_vertices)[3 * v + d] = traced[d];
+      }
+    }
+
+#pragma omp for schedule(static)
+    for (int f = 0; f < 3 * faces_per_direction; ++f) {
+      const int d = f / faces_per_direction;
+      const int index = f % faces_per_direction;
+      const int t1 = (d + 1) % 3;
+      const int t2 = (d + 2) % 3;
+      // Faces normal to d sit on planes 1 to a_ncells-1 along d
+      const int a = index % a_ncells;
+      const int b = (index / a_ncells) % a_ncells;
+      const int plane = index / (a_ncells * a_ncells) + 1;
+      const std::array<std::array<int, 2>, 4> corners{
+          {{{a, b}}, {{a + 1, b}}, {{a + 1, b + 1}}, {{a, b + 1}}}};
+      double* pts = &(*a_flux_pts)[42 * f];
+      for (int c = 0; c < 4; ++c) {
+        const int vertex = plane * stride[d] + corners[c][0] * stride[t1] +
+                           corners[c][1] * stride[t2];
+        pts[3 * c] = -0.5 + static_cast<double>(vertex % n) * dx;
+        pts[3 * c + 1] = -0.5 + static_cast<double>((vertex / n) % n) * dx;
+        pts[3 * c + 2] = -0.5 + static_cast<double>(vertex / (n * n)) * dx;
+        for (int e = 0; e < 3; ++e) {
+          pts[3 * (c + 4) + e] = (*a_vertices)[3 * vertex + e];
+        }
+      }
+      for (int face = 0; face < 6; ++face) {
+        for (int e = 0; e < 3; ++e) {
+          double centroid = 0.0;
+          for (int c = 0; c < 4; ++c) {
+            centroid += pts[3 * kFaceVertices[face][c] + e];
+          }
+          pts[3 * (8 + face) + e] = 0.25 * centroid;
+        }
+      }
+    }
+  }
+  const double end = omp_get_wtime();
+  return end - start;
+}
+
+}  // namespace
+
+int makeSymHexFluxVolumes(const int a_ncells, const double a_cfl,
+                          std::vector<double>* a_flux_pts) {
+  const double dx = 1.0 / static_cast<double>(a_ncells);
+  const double dt = a_cfl * dx / kMaxVelocity;
+  const int number_of_faces = 3 * a_ncells * a_ncells * (a_ncells - 1);
+  std::vector<double> vertices(3 * (a_ncells + 1) * (a_ncells + 1) *
+                               (a_ncells + 1));
+  a_flux_pts->resize(42 * static_cast<std::size_t>(number_of_faces));
+  buildFluxVolumes(a_ncells, dt, omp_get_max_threads(), &vertices,
+                   a_flux_pts);
+  return number_of_faces;
+}
+
+void timeSymHexFluxVolumes(FILE* a_flux_volume_file, const int a_ncells,
+                           const double a_cfl) {
+  // Without interior faces there is nothing to distribute, and the
+  // per-face averages below would divide by zero
+  if (a_ncells < 2) {
+    printf("Flux volumes require at least 2 cells per direction\n");
+    std::exit(-1);
+  }
+  const double dx = 1.0 / static_cast<double>(a_ncells);
+  const double dt = a_cfl * dx / kMaxVelocity;
+  const int number_of_faces = 3 * a_ncells * a_ncells * (a_ncells - 1);
+  const double cell_volume = dx * dx * dx;
+
+  std::vector<int> thread_counts;
+  const int max_threads = omp_get_max_threads();
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(max_threads);
+
+  const auto mesh = LocalizerMesh::fromCubic(
+      {{IRL::Pt(-0.5, -0.5, -0.5), IRL::Pt(0.5, 0.5, 0.5)}},
+      {{a_ncells, a_ncells, a_ncells}});
+  std::vector<double> vertices(3 * (a_ncells + 1) * (a_ncells + 1) *
+                               (a_ncells + 1));
+  std::vector<double> flux_pts(42 * static_cast<std::size_t>(number_of_faces));
+  std::vector<double> cell_moments(4 * mesh.getNumberOfCells());
+  fprintf(a_flux_volume_file, "%d %19.13e\n", number_of_faces, dt);
+
+  double serial_time = 0.0;
+  for (const int threads : thread_counts) {
+    // Construction, distribution, and accumulation
+    Times<3> flux_times;
+    flux_times[0] =
+        buildFluxVolumes(a_ncells, dt, threads, &vertices, &flux_pts);
+    double max_volume_difference;
+    irl_gvm_symHexFluxVolumesOntoMesh(flux_pts.data(), number_of_faces, mesh,
+                                      threads, cell_moments.data(),
+                                      flux_times.data() + 1,
+                                      &max_volume_difference);
+
+    // Every flux volume lies inside the mesh, so the volume accumulated
+    // over all cells should match the sum of the flux volumes
+    double flux_volume_sum = 0.0;
+    double flux_volume_magnitude = 0.0;
+    for (int f = 0; f < number_of_faces; ++f) {
+      const double volume = IRL::SymmetricHexahedron::fromRawDoublePointer(
+                                14, flux_pts.data() + 42 * f)
+                                .calculateVolume();
+      flux_volume_sum += volume;
+      flux_volume_magnitude += std::fabs(volume);
+    }
+    double accumulated_volume = 0.0;
+    for (int c = 0; c < mesh.getNumberOfCells(); ++c) {
+      accumulated_volume += cell_moments[4 * c];
+    }
+
+    const double total_time = flux_times[0] + flux_times[1] + flux_times[2];
+    if (threads == 1) {
+      serial_time = total_time;
+    }
+    const double faces = static_cast<double>(number_of_faces);
+    // Write out time in seconds per face and mesh memory in bytes
+    fprintf(a_flux_volume_file,
+            "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+            "%19.13e %19.13e\n",
+            static_cast<double>(threads), flux_times[0] / faces,
+            flux_times[1] / faces, flux_times[2] / faces, total_time / faces,
+            serial_time / total_time,
+            std::fabs(accumulated_volume - flux_volume_sum) /
+                flux_volume_magnitude,
+            max_volume_difference / cell_volume, mesh.getSetupTime(),
+            static_cast<double>(mesh.getMemoryFootprint()));
+    fflush(a_flux_volume_file);
+  }
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_FLUX_VOLUME_TIMING_H_
+#define SRC_TIMING_COMP_FLUX_VOLUME_TIMING_H_
+
+#include <vector>
+
+#include "src/timing_comp/files.h"
+
+// Builds into a_flux_pts the semi-Lagrangian flux volume of every interior
+// face of a Cartesian Mesh of [-0.5,0.5]^3 with a_ncells^3 cells, as
+// timeSymHexFluxVolumes does, 42 values per face. Returns the number of
+// faces.
+int makeSymHexFluxVolumes(const int a_ncells, const double a_cfl,
+                          std::vector<double>* a_flux_pts);
+
+// Builds the semi-Lagrangian flux volume of every interior face of a
+// Cartesian Mesh of [-0.5,0.5]^3 with a_ncells^3 cells as a Symmetric
+// Hexahedron, from the face vertices back-traced through a deformation
+// velocity field over a time step of CFL number a_cfl, then distributes
+// the flux volumes onto the mesh and accumulates their moments per cell.
+// Runs with 1, 2, 4, ... up to the maximum number of OpenMP threads.
+// Exits if a_ncells < 2, since the mesh then has no interior face.
+void timeSymHexFluxVolumes(FILE* a_flux_volume_file, const int a_ncells,
+                           const double a_cfl);
+
+#endif  // SRC_TIMING_COMP_FLUX_VOLUME_TIMING_H_
@@ -39,11 +39,13 @@
 // R3D Timing includes
 extern "C" {
 #include "src/r3d/r3d_intersection.h"
+#include "src/r3d/r3d_prototype_intersection.h"
 }
 
 // VOFTools Timing includes
 extern "C" {
 #include "src/voftools/voftools_intersection.h"
+#include "src/voftools/voftools_prototype_intersection.h"
 }
 
 void intersectPrismByPlanes(const Files& a_output_files,
@@ -70,12 +72,16 @@ void intersectPrismByPlanes(const Files& a_output_files,
   std::vector<double> planes(a_max_planes*4);
   std::vector<double> irl_volumes(a_number_of_trials);
   std::vector<double> r3d_volumes(a_number_of_trials);
+  std::vector<double> r3d_prototype_volumes(a_number_of_trials);
   std::vector<double> voftools_volumes(a_number_of_trials);  
+  std::vector<double> voftools_prototype_volumes(a_number_of_trials);
   setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes, centroid);
 
   std::vector<Times<4>> irl_times(a_max_planes);
   std::vector<Times<4>> r3d_times(a_max_planes);
+  std::vector<Times<4>> r3d_prototype_times(a_max_planes);
   std::vector<Times<4>> voftools_times(a_max_planes);  
+  std::vector<Times<4>> voftools_prototype_times(a_max_planes);
 
   if(a_timings_to_produce != 0){  
   
@@ -103,6 +109,18 @@ void intersectPrismByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_prismByPlanes_total(prism_pts.data(), p, planes.data(),
+					  &r3d_prototype_volume,
+					  r3d_prototype_trial_time.data() + 3);
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -115,11 +133,27 @@ void intersectPrismByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_prismByPlanes_total(
+	    prism_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data() + 3);
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -161,6 +195,18 @@ void intersectPrismByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	  r3d_prototype_prismByPlanes(prism_pts.data(), p, planes.data(),
+				      &r3d_prototype_volume,
+				      r3d_prototype_trial_time.data());
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -173,11 +219,27 @@ void intersectPrismByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_prismByPlanes(
+	    prism_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data());
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -198,7 +260,9 @@ void intersectPrismByPlanes(const Files& a_output_files,
   for(std::size_t p = 1; p <= a_max_planes; ++p){
     writeTimes(a_output_files.irl, p, irl_times[p-1]);
     writeTimes(a_output_files.r3d, p, r3d_times[p-1]);
+    writeTimes(a_output_files.r3d_prototype, p, r3d_prototype_times[p-1]);
     writeTimes(a_output_files.voftools, p, voftools_times[p-1]);
+    writeTimes(a_output_files.voftools_prototype, p, voftools_prototype_times[p-1]);
   }
 }
 
@@ -224,12 +288,16 @@ void intersectUnitCubeByPlanes(const Files& a_output_files,
   std::vector<double> planes(a_max_planes*4);
   std::vector<double> irl_volumes(a_number_of_trials);
   std::vector<double> r3d_volumes(a_number_of_trials);
+  std::vector<double> r3d_prototype_volumes(a_number_of_trials);
   std::vector<double> voftools_volumes(a_number_of_trials);  
+  std::vector<double> voftools_prototype_volumes(a_number_of_trials);
   setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes, centroid);
 
   std::vector<Times<4>> irl_times(a_max_planes);
   std::vector<Times<4>> r3d_times(a_max_planes);
+  std::vector<Times<4>> r3d_prototype_times(a_max_planes);
   std::vector<Times<4>> voftools_times(a_max_planes);  
+  std::vector<Times<4>> voftools_prototype_times(a_max_planes);
 
   if(a_timings_to_produce != 0){  
   
@@ -257,6 +325,18 @@ void intersectUnitCubeByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_unitCubeByPlanes_total(
+	    cube_pts.data(), p, planes.data(), &r3d_prototype_volume,
+	    r3d_prototype_trial_time.data() + 3);
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -269,11 +349,27 @@ void intersectUnitCubeByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_unitCubeByPlanes_total(
+	    cube_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data() + 3);
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -315,6 +411,18 @@ void intersectUnitCubeByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_unitCubeByPlanes(cube_pts.data(), p, planes.data(),
+				       &r3d_prototype_volume,
+				       r3d_prototype_trial_time.data());
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -326,11 +434,27 @@ void intersectUnitCubeByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_unitCubeByPlanes(
+	    cube_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data());
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -351,7 +475,9 @@ void intersectUnitCubeByPlanes(const Files& a_output_files,
   for(std::size_t p = 1; p <= a_max_planes; ++p){
     writeTimes(a_output_files.irl, p, irl_times[p-1]);
     writeTimes(a_output_files.r3d, p, r3d_times[p-1]);
+    writeTimes(a_output_files.r3d_prototype, p, r3d_prototype_times[p-1]);
     writeTimes(a_output_files.voftools, p, voftools_times[p-1]);
+    writeTimes(a_output_files.voftools_prototype, p, voftools_prototype_times[p-1]);
   }
   
 }
@@ -398,12 +524,16 @@ void intersectTriPrismByPlanes(const Files& a_output_files,
   std::vector<double> planes(a_max_planes*4);
   std::vector<double> irl_volumes(a_number_of_trials);
   std::vector<double> r3d_volumes(a_number_of_trials);
+  std::vector<double> r3d_prototype_volumes(a_number_of_trials);
   std::vector<double> voftools_volumes(a_number_of_trials);  
+  std::vector<double> voftools_prototype_volumes(a_number_of_trials);
   setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes, centroid);
 
   std::vector<Times<4>> irl_times(a_max_planes);
   std::vector<Times<4>> r3d_times(a_max_planes);
+  std::vector<Times<4>> r3d_prototype_times(a_max_planes);
   std::vector<Times<4>> voftools_times(a_max_planes);  
+  std::vector<Times<4>> voftools_prototype_times(a_max_planes);
 
   if(a_timings_to_produce != 0){  
   
@@ -431,6 +561,18 @@ void intersectTriPrismByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_triPrismByPlanes_total(
+	    tri_prism_pts.data(), p, planes.data(), &r3d_prototype_volume,
+	    r3d_prototype_trial_time.data() + 3);
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -443,11 +585,27 @@ void intersectTriPrismByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_triPrismByPlanes_total(
+	    tri_prism_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data() + 3);
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -489,6 +647,18 @@ void intersectTriPrismByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_triPrismByPlanes(tri_prism_pts.data(), p, planes.data(),
+				       &r3d_prototype_volume,
+				       r3d_prototype_trial_time.data());
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -500,11 +670,27 @@ void intersectTriPrismByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_triPrismByPlanes(
+	    tri_prism_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data());
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -525,7 +711,9 @@ void intersectTriPrismByPlanes(const Files& a_output_files,
   for(std::size_t p = 1; p <= a_max_planes; ++p){
     writeTimes(a_output_files.irl, p, irl_times[p-1]);
     writeTimes(a_output_files.r3d, p, r3d_times[p-1]);
+    writeTimes(a_output_files.r3d_prototype, p, r3d_prototype_times[p-1]);
     writeTimes(a_output_files.voftools, p, voftools_times[p-1]);
+    writeTimes(a_output_files.voftools_prototype, p, voftools_prototype_times[p-1]);
   }
   
 }
@@ -556,12 +744,16 @@ void intersectTriHexByPlanes(const Files& a_output_files,
   std::vector<double> planes(a_max_planes*4);
   std::vector<double> irl_volumes(a_number_of_trials);
   std::vector<double> r3d_volumes(a_number_of_trials);
+  std::vector<double> r3d_prototype_volumes(a_number_of_trials);
   std::vector<double> voftools_volumes(a_number_of_trials);  
+  std::vector<double> voftools_prototype_volumes(a_number_of_trials);
   setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes, centroid);
 
   std::vector<Times<4>> irl_times(a_max_planes);
   std::vector<Times<4>> r3d_times(a_max_planes);
+  std::vector<Times<4>> r3d_prototype_times(a_max_planes);
   std::vector<Times<4>> voftools_times(a_max_planes);  
+  std::vector<Times<4>> voftools_prototype_times(a_max_planes);
 
   if(a_timings_to_produce != 0){  
   
@@ -589,6 +781,18 @@ void intersectTriHexByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_triHexByPlanes_total(tri_hex_pts.data(), p, planes.data(),
+					   &r3d_prototype_volume,
+					   r3d_prototype_trial_time.data() + 3);
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -601,11 +805,27 @@ void intersectTriHexByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_triHexByPlanes_total(
+	    tri_hex_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data() + 3);
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -647,6 +867,18 @@ void intersectTriHexByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_triHexByPlanes(tri_hex_pts.data(), p, planes.data(),
+				     &r3d_prototype_volume,
+				     r3d_prototype_trial_time.data());
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -658,11 +890,27 @@ void intersectTriHexByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_triHexByPlanes(
+	    tri_hex_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data());
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -683,7 +931,9 @@ void intersectTriHexByPlanes(const Files& a_output_files,
   for(std::size_t p = 1; p <= a_max_planes; ++p){
     writeTimes(a_output_files.irl, p, irl_times[p-1]);
     writeTimes(a_output_files.r3d, p, r3d_times[p-1]);
+    writeTimes(a_output_files.r3d_prototype, p, r3d_prototype_times[p-1]);
     writeTimes(a_output_files.voftools, p, voftools_times[p-1]);
+    writeTimes(a_output_files.voftools_prototype, p, voftools_prototype_times[p-1]);
   }
   
 }
@@ -745,12 +995,16 @@ void intersectSymPrismByPlanes(const Files& a_output_files,
   std::vector<double> planes(a_max_planes*4);
   std::vector<double> irl_volumes(a_number_of_trials);
   std::vector<double> r3d_volumes(a_number_of_trials);
+  std::vector<double> r3d_prototype_volumes(a_number_of_trials);
   std::vector<double> voftools_volumes(a_number_of_trials);  
+  std::vector<double> voftools_prototype_volumes(a_number_of_trials);
   setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes, centroid);
 
   std::vector<Times<4>> irl_times(a_max_planes);
   std::vector<Times<4>> r3d_times(a_max_planes);
+  std::vector<Times<4>> r3d_prototype_times(a_max_planes);
   std::vector<Times<4>> voftools_times(a_max_planes);  
+  std::vector<Times<4>> voftools_prototype_times(a_max_planes);
 
   if(a_timings_to_produce != 0){  
   
@@ -778,6 +1032,18 @@ void intersectSymPrismByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_symPrismByPlanes_total(
+	    sym_prism_pts.data(), p, planes.data(), &r3d_prototype_volume,
+	    r3d_prototype_trial_time.data() + 3);
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -790,11 +1056,27 @@ void intersectSymPrismByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_symPrismByPlanes_total(
+	    sym_prism_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data() + 3);
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -836,6 +1118,18 @@ void intersectSymPrismByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_symPrismByPlanes(sym_prism_pts.data(), p, planes.data(),
+				       &r3d_prototype_volume,
+				       r3d_prototype_trial_time.data());
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -847,11 +1141,27 @@ void intersectSymPrismByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_symPrismByPlanes(
+	    sym_prism_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data());
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -872,7 +1182,9 @@ void intersectSymPrismByPlanes(const Files& a_output_files,
   for(std::size_t p = 1; p <= a_max_planes; ++p){
     writeTimes(a_output_files.irl, p, irl_times[p-1]);
     writeTimes(a_output_files.r3d, p, r3d_times[p-1]);
+    writeTimes(a_output_files.r3d_prototype, p, r3d_prototype_times[p-1]);
     writeTimes(a_output_files.voftools, p, voftools_times[p-1]);
+    writeTimes(a_output_files.voftools_prototype, p, voftools_prototype_times[p-1]);
   }
   
 }
@@ -904,12 +1216,16 @@ void intersectSymHexByPlanes(const Files& a_output_files,
   std::vector<double> planes(a_max_planes*4);
   std::vector<double> irl_volumes(a_number_of_trials);
   std::vector<double> r3d_volumes(a_number_of_trials);
+  std::vector<double> r3d_prototype_volumes(a_number_of_trials);
   std::vector<double> voftools_volumes(a_number_of_trials);  
+  std::vector<double> voftools_prototype_volumes(a_number_of_trials);
   setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes, centroid);
 
   std::vector<Times<4>> irl_times(a_max_planes);
   std::vector<Times<4>> r3d_times(a_max_planes);
+  std::vector<Times<4>> r3d_prototype_times(a_max_planes);
   std::vector<Times<4>> voftools_times(a_max_planes);  
+  std::vector<Times<4>> voftools_prototype_times(a_max_planes);
 
   if(a_timings_to_produce != 0){  
   
@@ -937,6 +1253,18 @@ void intersectSymHexByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_symHexByPlanes_total(sym_hex_pts.data(), p, planes.data(),
+					   &r3d_prototype_volume,
+					   r3d_prototype_trial_time.data() + 3);
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -949,11 +1277,27 @@ void intersectSymHexByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_symHexByPlanes_total(
+	    sym_hex_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data() + 3);
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -995,6 +1339,18 @@ void intersectSymHexByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_symHexByPlanes(sym_hex_pts.data(), p, planes.data(),
+				     &r3d_prototype_volume,
+				     r3d_prototype_trial_time.data());
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -1006,11 +1362,27 @@ void intersectSymHexByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_symHexByPlanes(
+	    sym_hex_pts.data(), p, planes.data(), &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data());
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -1031,7 +1403,9 @@ void intersectSymHexByPlanes(const Files& a_output_files,
   for(std::size_t p = 1; p <= a_max_planes; ++p){
     writeTimes(a_output_files.irl, p, irl_times[p-1]);
     writeTimes(a_output_files.r3d, p, r3d_times[p-1]);
+    writeTimes(a_output_files.r3d_prototype, p, r3d_prototype_times[p-1]);
     writeTimes(a_output_files.voftools, p, voftools_times[p-1]);
+    writeTimes(a_output_files.voftools_prototype, p, voftools_prototype_times[p-1]);
   }
   
 }
@@ -1060,12 +1434,16 @@ void intersectStelDodecahedronByPlanes(const Files& a_output_files,
   std::vector<double> planes(a_max_planes*4);
   std::vector<double> irl_volumes(a_number_of_trials);
   std::vector<double> r3d_volumes(a_number_of_trials);
+  std::vector<double> r3d_prototype_volumes(a_number_of_trials);
   std::vector<double> voftools_volumes(a_number_of_trials);  
+  std::vector<double> voftools_prototype_volumes(a_number_of_trials);
   setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes, centroid);
 
   std::vector<Times<4>> irl_times(a_max_planes);
   std::vector<Times<4>> r3d_times(a_max_planes);
+  std::vector<Times<4>> r3d_prototype_times(a_max_planes);
   std::vector<Times<4>> voftools_times(a_max_planes);  
+  std::vector<Times<4>> voftools_prototype_times(a_max_planes);
 
   if(a_timings_to_produce != 0){  
   
@@ -1095,6 +1473,18 @@ void intersectStelDodecahedronByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_stelDodecahedronByPlanes_total(
+	    stel_dodecahedron_pts.data(), p, planes.data(),
+	    &r3d_prototype_volume, r3d_prototype_trial_time.data() + 3);
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -1107,11 +1497,28 @@ void intersectStelDodecahedronByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_stelDodecahedronByPlanes_total(
+	    stel_dodecahedron_pts.data(), p, planes.data(),
+	    &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data() + 3);
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -1155,6 +1562,19 @@ void intersectStelDodecahedronByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_stelDodecahedronByPlanes(stel_dodecahedron_pts.data(), p,
+					       planes.data(),
+					       &r3d_prototype_volume,
+					       r3d_prototype_trial_time.data());
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -1167,11 +1587,27 @@ void intersectStelDodecahedronByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_stelDodecahedronByPlanes(
+	    stel_dodecahedron_pts.data(), p, planes.data(),
+	    &voftools_prototype_volume, voftools_prototype_trial_time.data());
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -1192,7 +1628,9 @@ void intersectStelDodecahedronByPlanes(const Files& a_output_files,
   for(std::size_t p = 1; p <= a_max_planes; ++p){
     writeTimes(a_output_files.irl, p, irl_times[p-1]);
     writeTimes(a_output_files.r3d, p, r3d_times[p-1]);
+    writeTimes(a_output_files.r3d_prototype, p, r3d_prototype_times[p-1]);
     writeTimes(a_output_files.voftools, p, voftools_times[p-1]);
+    writeTimes(a_output_files.voftools_prototype, p, voftools_prototype_times[p-1]);
   }
   
 }
@@ -1220,12 +1658,16 @@ void intersectStelIcosahedronByPlanes(const Files& a_output_files,
   std::vector<double> planes(a_max_planes*4);
   std::vector<double> irl_volumes(a_number_of_trials);
   std::vector<double> r3d_volumes(a_number_of_trials);
+  std::vector<double> r3d_prototype_volumes(a_number_of_trials);
   std::vector<double> voftools_volumes(a_number_of_trials);  
+  std::vector<double> voftools_prototype_volumes(a_number_of_trials);
   setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes, centroid);
 
   std::vector<Times<4>> irl_times(a_max_planes);
   std::vector<Times<4>> r3d_times(a_max_planes);
+  std::vector<Times<4>> r3d_prototype_times(a_max_planes);
   std::vector<Times<4>> voftools_times(a_max_planes);  
+  std::vector<Times<4>> voftools_prototype_times(a_max_planes);
 
   if(a_timings_to_produce != 0){  
   
@@ -1255,6 +1697,18 @@ void intersectStelIcosahedronByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_stelIcosahedronByPlanes_total(
+	    stel_icosahedron_pts.data(), p, planes.data(),
+	    &r3d_prototype_volume, r3d_prototype_trial_time.data() + 3);
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -1267,11 +1721,28 @@ void intersectStelIcosahedronByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_stelIcosahedronByPlanes_total(
+	    stel_icosahedron_pts.data(), p, planes.data(),
+	    &voftools_prototype_volume,
+	    voftools_prototype_trial_time.data() + 3);
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -1313,6 +1784,19 @@ void intersectStelIcosahedronByPlanes(const Files& a_output_files,
 	r3d_volumes[n] = r3d_volume;
 	r3d_times[p-1] += r3d_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> r3d_prototype_trial_time;
+	double r3d_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	r3d_prototype_stelIcosahedronByPlanes(stel_icosahedron_pts.data(), p,
+					      planes.data(),
+					      &r3d_prototype_volume,
+					      r3d_prototype_trial_time.data());
+	r3d_prototype_volumes[n] = r3d_prototype_volume;
+	r3d_prototype_times[p-1] += r3d_prototype_trial_time;	
+      }
       for (int n = 0; n < a_number_of_trials; ++n) {	
 	Times<4> voftools_trial_time;
 	double voftools_volume;
@@ -1325,11 +1809,27 @@ void intersectStelIcosahedronByPlanes(const Files& a_output_files,
 	voftools_volumes[n] = voftools_volume;
 	voftools_times[p-1] += voftools_trial_time;	
       }
+      for (int n = 0; n < a_number_of_trials; ++n) {	
+	Times<4> voftools_prototype_trial_time;
+	double voftools_prototype_volume;
+	std::copy(&plane_set[n*a_max_planes*4],
+		  &plane_set[n*a_max_planes*4+p*4],
+		  planes.data());
+	c_voftools_prototype_stelIcosahedronByPlanes(
+	    stel_icosahedron_pts.data(), p, planes.data(),
+	    &voftools_prototype_volume, voftools_prototype_trial_time.data());	
+	voftools_prototype_volumes[n] = voftools_prototype_volume;
+	voftools_prototype_times[p-1] += voftools_prototype_trial_time;	
+      }
 
 
       for (int n = 0; n < a_number_of_trials; ++n) {	    
 	if (!sameVolumesFound(irl_volumes[n], r3d_volumes[n], voftools_volumes[n],
-			      scale)) {
+			      scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_prototype_volumes[n],
+			      voftools_volumes[n], scale) ||
+	    !sameVolumesFound(irl_volumes[n], r3d_volumes[n],
+			      voftools_prototype_volumes[n], scale)) {
 	  std::cout << "Planes are: \n";
 	  std::copy(&plane_set[n*a_max_planes*4],
 		    &plane_set[n*a_max_planes*4+p*4],
@@ -1350,7 +1850,9 @@ void intersectStelIcosahedronByPlanes(const Files& a_output_files,
   for(std::size_t p = 1; p <= a_max_planes; ++p){
     writeTimes(a_output_files.irl, p, irl_times[p-1]);
     writeTimes(a_output_files.r3d, p, r3d_times[p-1]);
+    writeTimes(a_output_files.r3d_prototype, p, r3d_prototype_times[p-1]);
     writeTimes(a_output_files.voftools, p, voftools_times[p-1]);
+    writeTimes(a_output_files.voftools_prototype, p, voftools_prototype_times[p-1]);
   }
 
   
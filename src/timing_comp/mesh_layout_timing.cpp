@@ -0,0 +1,129 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/mesh_layout_timing.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "src/timing_comp/files.h"
+#include "src/timing_comp/times.h"
+#include "src/timing_comp/timing_comp.h"
+
+// IRL GVM Timing includes
+#include "src/irl_gvm/compact_mesh.h"
+#include "src/irl_gvm/irl_gvm_traversal.h"
+#include "src/irl_gvm/localizer_mesh.h"
+
+namespace {
+
+// Cells visited by each walk, roughly the cells entered when distributing
+// a polyhedron spanning 10 cells per direction
+constexpr int kWalkCells = 1000;
+
+// Walks a_mesh from each seed in a_seeds, marking visits with a_first_mark
+// onwards, and returns the time per visited cell. The checksum of each
+// walk is written to a_checksums.
+template <class MeshType, class WalkFunction>
+double timeWalks(const MeshType& a_mesh, WalkFunction a_walk,
+                 const std::vector<int>& a_seeds, const int a_first_mark,
+                 std::vector<int>* a_visit_marks,
+                 std::vector<double>* a_checksums) {
+  Times<1> walk_times;
+  std::size_t visited_cells = 0;
+  for (std::size_t n = 0; n < a_seeds.size(); ++n) {
+    Times<1> times;
+    std::size_t visited;
+    a_walk(a_mesh, a_seeds[n], kWalkCells, a_visit_marks->data(),
+           a_first_mark + static_cast<int>(n), &(*a_checksums)[n],
+           times.data(), &visited);
+    walk_times += times;
+    visited_cells += visited;
+  }
+  return walk_times[0] / static_cast<double>(visited_cells);
+}
+
+}  // namespace
+
+void compareCubicMeshLayouts(FILE* a_layout_file, const int a_number_of_walks,
+                             const int a_max_ncells) {
+  // Resolutions double the number of cells from 100^3 (or a_max_ncells^3
+  // if smaller) up to a_max_ncells^3
+  std::vector<int> resolutions;
+  for (int ncells = std::min(100, a_max_ncells); ncells < a_max_ncells;
+       ncells = static_cast<int>(
+           std::lround(static_cast<double>(ncells) * std::cbrt(2.0)))) {
+    resolutions.push_back(ncells);
+  }
+  resolutions.push_back(a_max_ncells);
+
+  const std::array<IRL::Pt, 2> bounding_pts{
+      {IRL::Pt(-0.5, -0.5, -0.5), IRL::Pt(0.5, 0.5, 0.5)}};
+  for (const int ncells : resolutions) {
+    const std::array<int, 3> mesh_ncells{{ncells, ncells, ncells}};
+    const int number_of_cells = ncells * ncells * ncells;
+    const double cells = static_cast<double>(number_of_cells);
+
+    // Same seeds for every layout, so every walk visits the same cells
+    std::vector<int> seeds(a_number_of_walks);
+    for (auto& seed : seeds) {
+      seed = std::min(number_of_cells - 1,
+                      static_cast<int>(0.5 * (randomDouble() + 1.0) * cells));
+    }
+    std::vector<int> visit_marks(number_of_cells, -1);
+    std::vector<double> link_checksums(a_number_of_walks);
+    std::vector<double> compact_checksums(a_number_of_walks);
+    std::vector<double> converted_checksums(a_number_of_walks);
+
+    // Only one LocalizerLink mesh is held at a time
+    double link_setup_time, link_bytes, link_walk_time;
+    {
+      const auto mesh = LocalizerMesh::fromCubic(bounding_pts, mesh_ncells);
+      link_setup_time = mesh.getSetupTime();
+      link_bytes = static_cast<double>(mesh.getMemoryFootprint());
+      link_walk_time = timeWalks(mesh, irl_gvm_walkLocalizerMesh, seeds, 0,
+                                 &visit_marks, &link_checksums);
+    }
+
+    const auto compact_mesh = CompactMesh::fromCubic(bounding_pts, mesh_ncells);
+    const double compact_walk_time =
+        timeWalks(compact_mesh, irl_gvm_walkCompactMesh, seeds,
+                  a_number_of_walks, &visit_marks, &compact_checksums);
+
+    double conversion_time, converted_walk_time;
+    {
+      const auto mesh = LocalizerMesh::fromCompact(compact_mesh);
+      conversion_time = mesh.getSetupTime();
+      converted_walk_time =
+          timeWalks(mesh, irl_gvm_walkLocalizerMesh, seeds,
+                    2 * a_number_of_walks, &visit_marks, &converted_checksums);
+    }
+
+    // Both layouts visit the same cells in the same order, so the
+    // checksums should match exactly
+    double max_checksum_difference = 0.0;
+    for (int n = 0; n < a_number_of_walks; ++n) {
+      max_checksum_difference =
+          std::max({max_checksum_difference,
+                    std::fabs(link_checksums[n] - compact_checksums[n]),
+                    std::fabs(link_checksums[n] - converted_checksums[n])});
+    }
+
+    // Write out time in seconds and memory in bytes per cell
+    fprintf(a_layout_file,
+            "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+            "%19.13e %19.13e %19.13e\n",
+            cells, link_setup_time, link_bytes / cells, link_walk_time,
+            compact_mesh.getSetupTime(),
+            static_cast<double>(compact_mesh.getMemoryFootprint()) / cells,
+            compact_walk_time, conversion_time, converted_walk_time,
+            max_checksum_difference);
+    fflush(a_layout_file);
+  }
+}
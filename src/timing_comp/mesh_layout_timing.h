@@ -0,0 +1,19 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_MESH_LAYOUT_TIMING_H_
+#define SRC_TIMING_COMP_MESH_LAYOUT_TIMING_H_
+
+#include "src/timing_comp/files.h"
+
+// Builds Cartesian Meshes of increasing resolution, up to a_max_ncells
+// cells per direction, as LocalizerLink objects and as a CompactMesh, and
+// compares their setup time, memory, and the time to walk a_number_of_walks
+// breadth-first walks over each
+void compareCubicMeshLayouts(FILE* a_layout_file, const int a_number_of_walks,
+                             const int a_max_ncells);
+
+#endif  // SRC_TIMING_COMP_MESH_LAYOUT_TIMING_H_
@@ -0,0 +1,193 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/plane_sweep_timing.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "src/timing_comp/times.h"
+#include "src/timing_comp/timing_comp.h"
+
+// IRL Includes
+#include "src/geometry/general/normal.h"
+
+// IRL GVM Timing includes
+#include "src/irl_gvm/irl_gvm_intersection.h"
+
+// Volume profile includes
+#include "src/volume_profile/volume_profile_intersection.h"
+
+namespace {
+
+using SweepFunction = void (*)(const double*, const double*, const int,
+                               const double*, double*, double*);
+
+// Largest difference allowed between the volumes from IRL and the
+// VolumeProfile, relative to the polyhedron volume
+constexpr double kSweepTolerance = 1.0e-10;
+
+// Sweeps planes with a_number_of_trials random normals through a_shape,
+// 1, 2, 4, ... up to a_max_planes planes per normal, each at a random
+// distance within the sphere around its centroid holding all its points.
+// IRL constructs the polyhedron once per normal and cuts it once per
+// plane, while the VolumeProfile is built once per normal and evaluated
+// per plane. For each number of planes, writes the
+// IRL construction time per normal and time per plane, the profile build
+// time per normal and time per plane, the profile time per plane
+// including its build, the speedup of the profile over IRL with
+// construction and build included, and the max difference in volume,
+// scaled by the polyhedron volume. Exits if that difference exceeds
+// kSweepTolerance.
+void timePlaneSweep(FILE* a_sweep_file, const ShapeFixture& a_shape,
+                    const int a_number_of_trials, const int a_max_planes,
+                    SweepFunction a_irl_function,
+                    SweepFunction a_volume_profile_function) {
+  const double* pts = a_shape.pts.data();
+  const double scale = a_shape.volume;
+  const int number_of_pts = static_cast<int>(a_shape.pts.size() / 3);
+  double radius = 0.0;
+  for (int v = 0; v < number_of_pts; ++v) {
+    double distance_squared = 0.0;
+    for (int d = 0; d < 3; ++d) {
+      const double difference = pts[3 * v + d] - a_shape.centroid[d];
+      distance_squared += difference * difference;
+    }
+    radius = std::max(radius, std::sqrt(distance_squared));
+  }
+
+  std::vector<double> normals(3 * a_number_of_trials);
+  std::vector<double> distances(a_number_of_trials * a_max_planes);
+  for (int n = 0; n < a_number_of_trials; ++n) {
+    const IRL::Normal normal = randomNormal();
+    double centroid_distance = 0.0;
+    for (int d = 0; d < 3; ++d) {
+      normals[3 * n + d] = normal[d];
+      centroid_distance += normal[d] * a_shape.centroid[d];
+    }
+    for (int p = 0; p < a_max_planes; ++p) {
+      distances[n * a_max_planes + p] =
+          centroid_distance + randomDouble() * radius;
+    }
+  }
+
+  std::vector<double> irl_volumes(a_max_planes);
+  std::vector<double> volumes(a_max_planes);
+  int p = 1;
+  while (true) {
+    // IRL construction and cuts, then profile build and evaluations
+    Times<4> times;
+    double max_error = 0.0;
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      Times<2> irl_times;
+      a_irl_function(pts, &normals[3 * n], p, &distances[n * a_max_planes],
+                     irl_volumes.data(), irl_times.data());
+      Times<2> profile_times;
+      a_volume_profile_function(pts, &normals[3 * n], p,
+                                &distances[n * a_max_planes], volumes.data(),
+                                profile_times.data());
+      times[0] += irl_times[0];
+      times[1] += irl_times[1];
+      times[2] += profile_times[0];
+      times[3] += profile_times[1];
+      for (int q = 0; q < p; ++q) {
+        const double error = std::fabs(volumes[q] - irl_volumes[q]) / scale;
+        if (error > kSweepTolerance) {
+          printf("Profile differs from IRL by %20.15e in trial %d\n", error,
+                 n);
+          printf("Normal : (%20.15e %20.15e %20.15e) Distance : %20.15e\n",
+                 normals[3 * n], normals[3 * n + 1], normals[3 * n + 2],
+                 distances[n * a_max_planes + q]);
+          std::exit(-1);
+        }
+        max_error = std::max(max_error, error);
+      }
+    }
+
+    const double trials = static_cast<double>(a_number_of_trials);
+    const double queries = trials * static_cast<double>(p);
+    fprintf(a_sweep_file,
+            "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+            "%19.13e\n",
+            static_cast<double>(p), times[0] / trials, times[1] / queries,
+            times[2] / trials, times[3] / queries,
+            (times[2] + times[3]) / queries,
+            (times[0] + times[1]) / (times[2] + times[3]), max_error);
+
+    if (p == a_max_planes) {
+      break;
+    }
+    p = std::min(2 * p, a_max_planes);
+  }
+}
+
+}  // namespace
+
+void timeSweepPrismByPlanes(FILE* a_sweep_file, const int a_number_of_trials,
+                            const int a_max_planes) {
+  timePlaneSweep(a_sweep_file, getPrismFixture(), a_number_of_trials,
+                 a_max_planes, irl_gvm_prismBySweep,
+                 volume_profile_prismBySweep);
+}
+
+void timeSweepUnitCubeByPlanes(FILE* a_sweep_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes) {
+  timePlaneSweep(a_sweep_file, getUnitCubeFixture(), a_number_of_trials,
+                 a_max_planes, irl_gvm_unitCubeBySweep,
+                 volume_profile_unitCubeBySweep);
+}
+
+void timeSweepTriPrismByPlanes(FILE* a_sweep_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes) {
+  timePlaneSweep(a_sweep_file, getTriPrismFixture(), a_number_of_trials,
+                 a_max_planes, irl_gvm_triPrismBySweep,
+                 volume_profile_triPrismBySweep);
+}
+
+void timeSweepTriHexByPlanes(FILE* a_sweep_file, const int a_number_of_trials,
+                             const int a_max_planes) {
+  timePlaneSweep(a_sweep_file, getTriHexFixture(), a_number_of_trials,
+                 a_max_planes, irl_gvm_triHexBySweep,
+                 volume_profile_triHexBySweep);
+}
+
+void timeSweepSymPrismByPlanes(FILE* a_sweep_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes) {
+  timePlaneSweep(a_sweep_file, getSymPrismFixture(), a_number_of_trials,
+                 a_max_planes, irl_gvm_symPrismBySweep,
+                 volume_profile_symPrismBySweep);
+}
+
+void timeSweepSymHexByPlanes(FILE* a_sweep_file, const int a_number_of_trials,
+                             const int a_max_planes) {
+  timePlaneSweep(a_sweep_file, getSymHexFixture(), a_number_of_trials,
+                 a_max_planes, irl_gvm_symHexBySweep,
+                 volume_profile_symHexBySweep);
+}
+
+void timeSweepStelDodecahedronByPlanes(FILE* a_sweep_file,
+                                       const int a_number_of_trials,
+                                       const int a_max_planes) {
+  timePlaneSweep(a_sweep_file, getStelDodecahedronFixture(), a_number_of_trials,
+                 a_max_planes, irl_gvm_stelDodecahedronBySweep,
+                 volume_profile_stelDodecahedronBySweep);
+}
+
+void timeSweepStelIcosahedronByPlanes(FILE* a_sweep_file,
+                                      const int a_number_of_trials,
+                                      const int a_max_planes) {
+  timePlaneSweep(a_sweep_file, getStelIcosahedronFixture(), a_number_of_trials,
+                 a_max_planes, irl_gvm_stelIcosahedronBySweep,
+                 volume_profile_stelIcosahedronBySweep);
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_PLANE_SWEEP_TIMING_H_
+#define SRC_TIMING_COMP_PLANE_SWEEP_TIMING_H_
+
+#include <cstdio>
+
+// Time plane sweeps through a Triangular Prism
+void timeSweepPrismByPlanes(FILE* a_sweep_file,
+                            const int a_number_of_trials,
+                            const int a_max_planes);
+
+// Time plane sweeps through a Unit Cube
+void timeSweepUnitCubeByPlanes(FILE* a_sweep_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes);
+
+// Time plane sweeps through a Triangulated Triangular Prism
+void timeSweepTriPrismByPlanes(FILE* a_sweep_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes);
+
+// Time plane sweeps through a Triangulated Hexahedron
+void timeSweepTriHexByPlanes(FILE* a_sweep_file,
+                             const int a_number_of_trials,
+                             const int a_max_planes);
+
+// Time plane sweeps through a Symmetric Triangular Prism
+void timeSweepSymPrismByPlanes(FILE* a_sweep_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes);
+
+// Time plane sweeps through a Symmetric Hexahedron
+void timeSweepSymHexByPlanes(FILE* a_sweep_file,
+                             const int a_number_of_trials,
+                             const int a_max_planes);
+
+// Time plane sweeps through a Stellated Dodecahedron
+void timeSweepStelDodecahedronByPlanes(FILE* a_sweep_file,
+                                       const int a_number_of_trials,
+                                       const int a_max_planes);
+
+// Time plane sweeps through a Stellated Icosahedron
+void timeSweepStelIcosahedronByPlanes(FILE* a_sweep_file,
+                                      const int a_number_of_trials,
+                                      const int a_max_planes);
+
+#endif  // SRC_TIMING_COMP_PLANE_SWEEP_TIMING_H_
@@ -0,0 +1,179 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/precision_timing.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "src/timing_comp/times.h"
+#include "src/timing_comp/timing_comp.h"
+
+// IRL GVM Timing includes
+#include "src/irl_gvm/irl_gvm_intersection.h"
+
+// Single/double precision clipping includes
+#include "src/vertex_clip/vertex_clip_intersection.h"
+
+namespace {
+
+using ClipFunction = void (*)(const double*, const int, const double*,
+                              double*, double*);
+
+// Largest difference allowed between the volumes from IRL and the in-repo
+// clipper in double precision, relative to the unclipped volume
+constexpr double kDoubleTolerance = 1.0e-10;
+
+// Clips the polyhedron by the same random planes with IRL (in double
+// precision, used as the reference volume) and with the in-repo clipper
+// instantiated for double and float. For each number of planes, writes
+// the total times of each and the mean/max error of the float volumes
+// relative to the IRL volumes, scaled by the unclipped volume of a_shape.
+// Exits if a double volume differs from IRL by more than kDoubleTolerance,
+// while the float errors are only reported.
+void comparePrecision(FILE* a_precision_file, const ShapeFixture& a_shape,
+                      const int a_number_of_trials, const int a_max_planes,
+                      ClipFunction a_irl_function,
+                      ClipFunction a_double_function,
+                      ClipFunction a_float_function) {
+  const double* pts = a_shape.pts.data();
+  const double scale = a_shape.volume;
+  std::vector<double> plane_set(a_number_of_trials * a_max_planes * 4);
+  std::vector<double> irl_volumes(a_number_of_trials);
+  setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes,
+                  a_shape.centroid);
+
+  for (int p = 1; p <= a_max_planes; ++p) {
+    Times<3> times;
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      Times<1> trial_time;
+      a_irl_function(pts, p, &plane_set[n * a_max_planes * 4],
+                     &irl_volumes[n], trial_time.data());
+      times[0] += trial_time[0];
+    }
+
+    double double_max_error = 0.0;
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      Times<1> trial_time;
+      double volume;
+      a_double_function(pts, p, &plane_set[n * a_max_planes * 4], &volume,
+                        trial_time.data());
+      times[1] += trial_time[0];
+      const double error = std::fabs(volume - irl_volumes[n]) / scale;
+      if (error > kDoubleTolerance) {
+        printf("Double differs from IRL by %20.15e for %d planes in trial %d\n",
+               error, p, n);
+        for (int rp = 0; rp < p; ++rp) {
+          const double* plane = &plane_set[(n * a_max_planes + rp) * 4];
+          printf("Normal : (%20.15e %20.15e %20.15e) Distance : %20.15e\n",
+                 plane[0], plane[1], plane[2], plane[3]);
+        }
+        std::exit(-1);
+      }
+      double_max_error = std::max(double_max_error, error);
+    }
+
+    double float_mean_error = 0.0;
+    double float_max_error = 0.0;
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      Times<1> trial_time;
+      double volume;
+      a_float_function(pts, p, &plane_set[n * a_max_planes * 4], &volume,
+                       trial_time.data());
+      times[2] += trial_time[0];
+      const double error = std::fabs(volume - irl_volumes[n]) / scale;
+      float_mean_error += error;
+      float_max_error = std::max(float_max_error, error);
+    }
+    float_mean_error /= static_cast<double>(a_number_of_trials);
+
+    fprintf(a_precision_file,
+            "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e\n",
+            static_cast<double>(p), times[0], times[1], times[2],
+            double_max_error, float_mean_error, float_max_error);
+  }
+}
+
+}  // namespace
+
+void comparePrecisionPrismByPlanes(FILE* a_precision_file,
+                                   const int a_number_of_trials,
+                                   const int a_max_planes) {
+  comparePrecision(a_precision_file, getPrismFixture(), a_number_of_trials,
+                   a_max_planes, irl_gvm_prismByPlanes,
+                   vertex_clip_prismByPlanes<double>,
+                   vertex_clip_prismByPlanes<float>);
+}
+
+void comparePrecisionUnitCubeByPlanes(FILE* a_precision_file,
+                                      const int a_number_of_trials,
+                                      const int a_max_planes) {
+  comparePrecision(a_precision_file, getUnitCubeFixture(), a_number_of_trials,
+                   a_max_planes, irl_gvm_unitCubeByPlanes,
+                   vertex_clip_unitCubeByPlanes<double>,
+                   vertex_clip_unitCubeByPlanes<float>);
+}
+
+void comparePrecisionTriPrismByPlanes(FILE* a_precision_file,
+                                      const int a_number_of_trials,
+                                      const int a_max_planes) {
+  comparePrecision(a_precision_file, getTriPrismFixture(), a_number_of_trials,
+                   a_max_planes, irl_gvm_triPrismByPlanes,
+                   vertex_clip_triPrismByPlanes<double>,
+                   vertex_clip_triPrismByPlanes<float>);
+}
+
+void comparePrecisionTriHexByPlanes(FILE* a_precision_file,
+                                    const int a_number_of_trials,
+                                    const int a_max_planes) {
+  comparePrecision(a_precision_file, getTriHexFixture(), a_number_of_trials,
+                   a_max_planes, irl_gvm_triHexByPlanes,
+                   vertex_clip_triHexByPlanes<double>,
+                   vertex_clip_triHexByPlanes<float>);
+}
+
+void comparePrecisionSymPrismByPlanes(FILE* a_precision_file,
+                                      const int a_number_of_trials,
+                                      const int a_max_planes) {
+  comparePrecision(a_precision_file, getSymPrismFixture(), a_number_of_trials,
+                   a_max_planes, irl_gvm_symPrismByPlanes,
+                   vertex_clip_symPrismByPlanes<double>,
+                   vertex_clip_symPrismByPlanes<float>);
+}
+
+void comparePrecisionSymHexByPlanes(FILE* a_precision_file,
+                                    const int a_number_of_trials,
+                                    const int a_max_planes) {
+  comparePrecision(a_precision_file, getSymHexFixture(), a_number_of_trials,
+                   a_max_planes, irl_gvm_symHexByPlanes,
+                   vertex_clip_symHexByPlanes<double>,
+                   vertex_clip_symHexByPlanes<float>);
+}
+
+void comparePrecisionStelDodecahedronByPlanes(FILE* a_precision_file,
+                                              const int a_number_of_trials,
+                                              const int a_max_planes) {
+  comparePrecision(a_precision_file, getStelDodecahedronFixture(),
+                   a_number_of_trials, a_max_planes,
+                   irl_gvm_stelDodecahedronByPlanes,
+                   vertex_clip_stelDodecahedronByPlanes<double>,
+                   vertex_clip_stelDodecahedronByPlanes<float>);
+}
+
+void comparePrecisionStelIcosahedronByPlanes(FILE* a_precision_file,
+                                             const int a_number_of_trials,
+                                             const int a_max_planes) {
+  comparePrecision(a_precision_file, getStelIcosahedronFixture(),
+                   a_number_of_trials, a_max_planes,
+                   irl_gvm_stelIcosahedronByPlanes,
+                   vertex_clip_stelIcosahedronByPlanes<double>,
+                   vertex_clip_stelIcosahedronByPlanes<float>);
+}
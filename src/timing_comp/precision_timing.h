@@ -0,0 +1,54 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_PRECISION_TIMING_H_
+#define SRC_TIMING_COMP_PRECISION_TIMING_H_
+
+#include <cstdio>
+
+// Compare single and double precision clipping of Triangular Prism
+void comparePrecisionPrismByPlanes(FILE* a_precision_file,
+                                   const int a_number_of_trials,
+                                   const int a_max_planes);
+
+// Compare single and double precision clipping of Unit Cube
+void comparePrecisionUnitCubeByPlanes(FILE* a_precision_file,
+                                      const int a_number_of_trials,
+                                      const int a_max_planes);
+
+// Compare single and double precision clipping of Triangulated
+// Triangular Prism
+void comparePrecisionTriPrismByPlanes(FILE* a_precision_file,
+                                      const int a_number_of_trials,
+                                      const int a_max_planes);
+
+// Compare single and double precision clipping of Triangulated Hexahedron
+void comparePrecisionTriHexByPlanes(FILE* a_precision_file,
+                                    const int a_number_of_trials,
+                                    const int a_max_planes);
+
+// Compare single and double precision clipping of Symmetric
+// Triangular Prism
+void comparePrecisionSymPrismByPlanes(FILE* a_precision_file,
+                                      const int a_number_of_trials,
+                                      const int a_max_planes);
+
+// Compare single and double precision clipping of Symmetric Hexahedron
+void comparePrecisionSymHexByPlanes(FILE* a_precision_file,
+                                    const int a_number_of_trials,
+                                    const int a_max_planes);
+
+// Compare single and double precision clipping of Stellated Dodecahedron
+void comparePrecisionStelDodecahedronByPlanes(FILE* a_precision_file,
+                                              const int a_number_of_trials,
+                                              const int a_max_planes);
+
+// Compare single and double precision clipping of Stellated Icosahedron
+void comparePrecisionStelIcosahedronByPlanes(FILE* a_precision_file,
+                                             const int a_number_of_trials,
+                                             const int a_max_planes);
+
+#endif  // SRC_TIMING_COMP_PRECISION_TIMING_H_
@@ -0,0 +1,317 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/reconstruction_timing.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "src/timing_comp/files.h"
+#include "src/timing_comp/timing_comp.h"
+
+// IRL GVM Timing includes
+#include "src/irl_gvm/irl_gvm_reconstruction.h"
+
+// IRL source directory
+#include "src/generic_cutting/generic_cutting.h"
+#include "src/geometry/general/normal.h"
+#include "src/geometry/general/plane.h"
+#include "src/geometry/general/pt.h"
+#include "src/geometry/polyhedrons/rectangular_cuboid.h"
+#include "src/moments/separated_volume_moments.h"
+#include "src/moments/volume_moments.h"
+#include "src/parameters/defined_types.h"
+#include "src/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+// Adds the moments of one cell, as liquid volume and first moments
+// followed by gas volume and first moments, into a_moments
+using MomentsFunction = void (*)(const IRL::Pt&, const double, const double,
+                                 double*);
+// Returns the exact interface normal, pointing out of the liquid, nearest
+// to a point
+using NormalFunction = IRL::Normal (*)(const IRL::Pt&, const double);
+using ReconstructionFunction = void (*)(const int, const double*,
+                                        const double, const double*,
+                                        const double*, const int, const int*,
+                                        const int, double*, double*);
+
+// Radius of the spherical interface, centered on the origin
+constexpr double kSphereRadius = 0.3;
+
+// Number of sub-cells per direction used to integrate the sphere
+constexpr int kSphereSubCells = 4;
+
+// Normal of the sheet, which is centered on the origin, before
+// normalization. Tilted so no cell face is parallel to the interface.
+constexpr double kSheetNormal[3] = {1.0, 2.0, 3.0};
+
+// Adds a_sign times a_volume_moments into a_moments
+void addMoments(const IRL::VolumeMoments& a_volume_moments,
+                const double a_sign, double* a_moments) {
+  a_moments[0] += a_sign * static_cast<double>(a_volume_moments.volume());
+  for (int d = 0; d < 3; ++d) {
+    a_moments[d + 1] += a_sign * a_volume_moments.centroid()[d];
+  }
+}
+
+IRL::Normal getSphereNormal(const IRL::Pt& a_pt, const double) {
+  const double radius =
+      std::sqrt(a_pt[0] * a_pt[0] + a_pt[1] * a_pt[1] + a_pt[2] * a_pt[2]);
+  return radius > DBL_EPSILON
+             ? IRL::Normal(a_pt[0] / radius, a_pt[1] / radius,
+                           a_pt[2] / radius)
+             : IRL::Normal(0.0, 0.0, 1.0);
+}
+
+// Integrates the sphere of radius a_radius over the cell of width
+// a_cell_size with lower corner a_lower, cutting each of its sub-cells by
+// the plane tangent to the sphere where it is closest to the sub-cell
+// center. Cells further from the sphere than half their diagonal are
+// taken whole without cutting.
+void getSphereMoments(const IRL::Pt& a_lower, const double a_cell_size,
+                      const double a_radius, double* a_moments) {
+  const double half_size = 0.5 * a_cell_size;
+  const IRL::Pt center(a_lower[0] + half_size, a_lower[1] + half_size,
+                       a_lower[2] + half_size);
+  const double distance =
+      std::sqrt(center[0] * center[0] + center[1] * center[1] +
+                center[2] * center[2]) -
+      a_radius;
+  if (std::fabs(distance) > std::sqrt(3.0) * half_size) {
+    const double volume = a_cell_size * a_cell_size * a_cell_size;
+    double* phase_moments = distance < 0.0 ? a_moments : a_moments + 4;
+    phase_moments[0] += volume;
+    for (int d = 0; d < 3; ++d) {
+      phase_moments[d + 1] += volume * center[d];
+    }
+    return;
+  }
+  const double sub_cell_size =
+      a_cell_size / static_cast<double>(kSphereSubCells);
+  for (int k = 0; k < kSphereSubCells; ++k) {
+    for (int j = 0; j < kSphereSubCells; ++j) {
+      for (int i = 0; i < kSphereSubCells; ++i) {
+        const IRL::Pt lower(
+            a_lower[0] + static_cast<double>(i) * sub_cell_size,
+            a_lower[1] + static_cast<double>(j) * sub_cell_size,
+            a_lower[2] + static_cast<double>(k) * sub_cell_size);
+        const IRL::Pt upper(lower[0] + sub_cell_size, lower[1] + sub_cell_size,
+                            lower[2] + sub_cell_size);
+        const auto sub_cell =
+            IRL::RectangularCuboid::fromBoundingPts(lower, upper);
+        const auto separator = IRL::PlanarSeparator::fromOnePlane(IRL::Plane(
+            getSphereNormal(0.5 * (lower + upper), a_radius), a_radius));
+        const auto moments = IRL::getVolumeMoments<
+            IRL::SeparatedMoments<IRL::VolumeMoments>>(sub_cell, separator);
+        addMoments(moments[0], 1.0, a_moments);
+        addMoments(moments[1], 1.0, a_moments + 4);
+      }
+    }
+  }
+}
+
+// Unit normal of the upper face of the sheet
+IRL::Normal getSheetDirection(void) {
+  const double magnitude =
+      std::sqrt(kSheetNormal[0] * kSheetNormal[0] +
+                kSheetNormal[1] * kSheetNormal[1] +
+                kSheetNormal[2] * kSheetNormal[2]);
+  return IRL::Normal(kSheetNormal[0] / magnitude,
+                     kSheetNormal[1] / magnitude,
+                     kSheetNormal[2] / magnitude);
+}
+
+IRL::Normal getSheetNormal(const IRL::Pt& a_pt, const double) {
+  const IRL::Normal direction = getSheetDirection();
+  return direction * a_pt < 0.0 ? -direction : direction;
+}
+
+// Integrates the sheet of thickness a_thickness exactly over the cell,
+// as the part below its upper face less the part below its lower face.
+void getSheetMoments(const IRL::Pt& a_lower, const double a_cell_size,
+                     const double a_thickness, double* a_moments) {
+  const auto cell = IRL::RectangularCuboid::fromBoundingPts(
+      a_lower, IRL::Pt(a_lower[0] + a_cell_size, a_lower[1] + a_cell_size,
+                       a_lower[2] + a_cell_size));
+  const IRL::Normal normal = getSheetDirection();
+  const auto upper_face =
+      IRL::getVolumeMoments<IRL::SeparatedMoments<IRL::VolumeMoments>>(
+          cell,
+          IRL::PlanarSeparator::fromOnePlane(IRL::Plane(normal,
+                                                        0.5 * a_thickness)));
+  const auto below_lower_face = IRL::getVolumeMoments<IRL::VolumeMoments>(
+      cell, IRL::PlanarSeparator::fromOnePlane(
+                IRL::Plane(normal, -0.5 * a_thickness)));
+  addMoments(upper_face[0], 1.0, a_moments);
+  addMoments(below_lower_face, -1.0, a_moments);
+  addMoments(upper_face[1], 1.0, a_moments + 4);
+  addMoments(below_lower_face, 1.0, a_moments + 4);
+}
+
+// Times the reconstructions of the field given by a_moments_function with
+// a_parameter on a Cartesian Mesh of [-0.5,0.5]^3 with a_ncells^3 cells.
+// Writes the number of interface cells and the time to build the field,
+// then a line per reconstruction method and thread count.
+void reconstructField(FILE* a_reconstruction_file, const int a_ncells,
+                      const std::vector<int>& a_thread_counts,
+                      MomentsFunction a_moments_function,
+                      NormalFunction a_normal_function,
+                      const double a_parameter) {
+  const std::array<double, 3> lower{{-0.5, -0.5, -0.5}};
+  const double cell_size = 1.0 / static_cast<double>(a_ncells);
+  const double cell_volume = cell_size * cell_size * cell_size;
+  const int number_of_cells = a_ncells * a_ncells * a_ncells;
+
+  // Volume fractions of every cell, and moments of the interface cells
+  // away from the mesh boundary, with phase centroids
+  const double setup_start = omp_get_wtime();
+  std::vector<double> volume_fractions(number_of_cells);
+  std::vector<int> interface_cells;
+  std::vector<double> interface_moments;
+  for (int k = 0; k < a_ncells; ++k) {
+    for (int j = 0; j < a_ncells; ++j) {
+      for (int i = 0; i < a_ncells; ++i) {
+        const int cell = i + a_ncells * (j + a_ncells * k);
+        std::array<double, 8> moments{};
+        a_moments_function(
+            IRL::Pt(lower[0] + static_cast<double>(i) * cell_size,
+                    lower[1] + static_cast<double>(j) * cell_size,
+                    lower[2] + static_cast<double>(k) * cell_size),
+            cell_size, a_parameter, moments.data());
+        volume_fractions[cell] = moments[0] / cell_volume;
+        const bool interior = i > 0 && j > 0 && k > 0 && i < a_ncells - 1 &&
+                              j < a_ncells - 1 && k < a_ncells - 1;
+        if (interior &&
+            volume_fractions[cell] > IRL::global_constants::VF_LOW &&
+            volume_fractions[cell] < IRL::global_constants::VF_HIGH) {
+          interface_cells.push_back(cell);
+          for (int p = 0; p < 2; ++p) {
+            for (int d = 1; d < 4; ++d) {
+              moments[4 * p + d] /= moments[4 * p];
+            }
+          }
+          interface_moments.insert(interface_moments.end(), moments.begin(),
+                                   moments.end());
+        }
+      }
+    }
+  }
+  const double setup_end = omp_get_wtime();
+  const int number_of_interface_cells =
+      static_cast<int>(interface_cells.size());
+  fprintf(a_reconstruction_file, "%d %19.13e\n", number_of_interface_cells,
+          setup_end - setup_start);
+
+  // Exact normal at the center of each interface cell
+  std::vector<IRL::Normal> exact_normals(number_of_interface_cells);
+  for (int n = 0; n < number_of_interface_cells; ++n) {
+    const int cell = interface_cells[n];
+    const double i = static_cast<double>(cell % a_ncells);
+    const double j = static_cast<double>((cell / a_ncells) % a_ncells);
+    const double k = static_cast<double>(cell / (a_ncells * a_ncells));
+    exact_normals[n] = a_normal_function(
+        IRL::Pt(lower[0] + (i + 0.5) * cell_size,
+                lower[1] + (j + 0.5) * cell_size,
+                lower[2] + (k + 0.5) * cell_size),
+        a_parameter);
+  }
+
+  const std::array<const char*, 3> names{{"ELVIRA", "LVIRA", "MoF"}};
+  const std::array<ReconstructionFunction, 3> reconstructions{
+      {irl_gvm_elviraReconstructions, irl_gvm_lviraReconstructions,
+       irl_gvm_mofReconstructions}};
+  std::vector<double> planes(4 * number_of_interface_cells);
+  std::vector<double> elvira_planes;
+  std::vector<double> cut_volume_fractions(number_of_interface_cells);
+  for (std::size_t m = 0; m < reconstructions.size(); ++m) {
+    std::cout << "    " << names[m] << std::endl;
+    double serial_time = 0.0;
+    for (const int threads : a_thread_counts) {
+      // LVIRA starts from the ELVIRA reconstruction, which is not timed
+      if (m == 1) {
+        planes = elvira_planes;
+      }
+      double reconstruction_time;
+      reconstructions[m](a_ncells, lower.data(), cell_size,
+                         volume_fractions.data(), interface_moments.data(),
+                         number_of_interface_cells, interface_cells.data(),
+                         threads, planes.data(), &reconstruction_time);
+      if (m == 0 && threads == 1) {
+        elvira_planes = planes;
+      }
+      double cut_time;
+      irl_gvm_cutByReconstructions(a_ncells, lower.data(), cell_size,
+                                   number_of_interface_cells,
+                                   interface_cells.data(), threads,
+                                   planes.data(), cut_volume_fractions.data(),
+                                   &cut_time);
+
+      double angle_error = 0.0;
+      double max_angle_error = 0.0;
+      double max_volume_fraction_error = 0.0;
+      for (int n = 0; n < number_of_interface_cells; ++n) {
+        const double alignment =
+            planes[4 * n] * exact_normals[n][0] +
+            planes[4 * n + 1] * exact_normals[n][1] +
+            planes[4 * n + 2] * exact_normals[n][2];
+        const double angle =
+            std::acos(std::max(-1.0, std::min(1.0, alignment)));
+        angle_error += angle;
+        max_angle_error = std::max(max_angle_error, angle);
+        max_volume_fraction_error = std::max(
+            max_volume_fraction_error,
+            std::fabs(cut_volume_fractions[n] -
+                      volume_fractions[interface_cells[n]]));
+      }
+
+      if (threads == 1) {
+        serial_time = reconstruction_time;
+      }
+      const double cells = static_cast<double>(number_of_interface_cells);
+      // Write out time in seconds per reconstruction and angles in radians
+      fprintf(a_reconstruction_file,
+              "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+              "%19.13e\n",
+              static_cast<double>(threads), reconstruction_time / cells,
+              cells / reconstruction_time, serial_time / reconstruction_time,
+              reconstruction_time / cut_time, angle_error / cells,
+              max_angle_error, max_volume_fraction_error);
+      fflush(a_reconstruction_file);
+    }
+  }
+}
+
+}  // namespace
+
+void timeReconstructions(FILE* a_reconstruction_file, const int a_ncells,
+                         const double a_sheet_thickness) {
+  std::vector<int> thread_counts;
+  const int max_threads = omp_get_max_threads();
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(max_threads);
+
+  std::cout << "  Sphere" << std::endl;
+  reconstructField(a_reconstruction_file, a_ncells, thread_counts,
+                   getSphereMoments, getSphereNormal, kSphereRadius);
+
+  fprintf(a_reconstruction_file, "\n");
+
+  std::cout << "  Sheet" << std::endl;
+  reconstructField(a_reconstruction_file, a_ncells, thread_counts,
+                   getSheetMoments, getSheetNormal,
+                   a_sheet_thickness / static_cast<double>(a_ncells));
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_RECONSTRUCTION_TIMING_H_
+#define SRC_TIMING_COMP_RECONSTRUCTION_TIMING_H_
+
+#include "src/timing_comp/files.h"
+
+// Builds the volume fractions and phase centroids of a sphere and of a
+// tilted sheet a_sheet_thickness cells thick on a Cartesian Mesh of
+// [-0.5,0.5]^3 with a_ncells^3 cells, then times the ELVIRA, LVIRA, and
+// MoF reconstructions of IRL in every interface cell away from the mesh
+// boundary. Runs with 1, 2, 4, ... up to the maximum number of OpenMP
+// threads.
+void timeReconstructions(FILE* a_reconstruction_file, const int a_ncells,
+                         const double a_sheet_thickness);
+
+#endif  // SRC_TIMING_COMP_RECONSTRUCTION_TIMING_H_
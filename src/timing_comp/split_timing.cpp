@@ -0,0 +1,243 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/split_timing.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "src/timing_comp/times.h"
+#include "src/timing_comp/timing_comp.h"
+
+// IRL GVM Timing includes
+#include "src/irl_gvm/irl_gvm_intersection.h"
+
+// R3D Timing includes
+extern "C" {
+#include "src/r3d/r3d_prototype_intersection.h"
+}
+
+// VOFTools Timing includes
+extern "C" {
+#include "src/voftools/voftools_prototype_intersection.h"
+}
+
+namespace {
+
+using SplitFunction = void (*)(const double*, const int, const double*,
+                               double*, double*);
+
+// IRL, R3D, and VOFTools, in that order
+constexpr std::size_t kNumberOfBackends = 3;
+constexpr std::array<const char*, kNumberOfBackends> kBackendNames{
+    {"IRL", "R3D", "VOFTools"}};
+
+// Largest difference allowed between the volumes found by any backend and
+// those of the IRL split, relative to the unclipped volume
+constexpr double kSplitTolerance = 1.0e-10;
+
+// Returns the larger difference between a_volumes and a_irl_volumes,
+// scaled by a_scale, after exiting with the planes of the trial if it
+// exceeds kSplitTolerance.
+double checkSplitVolumes(const std::array<double, 2>& a_volumes,
+                         const std::array<double, 2>& a_irl_volumes,
+                         const double a_scale, const char* a_method,
+                         const std::size_t a_backend,
+                         const int a_number_of_planes, const int a_trial,
+                         const double* a_planes) {
+  double error = 0.0;
+  for (int side = 0; side < 2; ++side) {
+    error = std::max(
+        error, std::fabs(a_volumes[side] - a_irl_volumes[side]) / a_scale);
+  }
+  if (error > kSplitTolerance) {
+    printf("%s %s differs from IRL split by %20.15e for %d planes in trial "
+           "%d\n",
+           kBackendNames[a_backend], a_method, error, a_number_of_planes,
+           a_trial);
+    for (int rp = 0; rp < a_number_of_planes; ++rp) {
+      const double* plane = &a_planes[rp * 4];
+      printf("Normal : (%20.15e %20.15e %20.15e) Distance : %20.15e\n",
+             plane[0], plane[1], plane[2], plane[3]);
+    }
+    std::exit(-1);
+  }
+  return error;
+}
+
+// Splits the polyhedron by the same random planes with each backend, once
+// in a single pass that keeps both sides of every plane, and once with
+// independent clips that each keep only the part below their planes: one
+// below all planes, and one for each plane j below planes 0 to j-1 and
+// above plane j (so two clips for a single plane). For each number of
+// planes, writes the split and clip total times of each backend, the max
+// difference between any volume found and that of the IRL split, and the
+// max conservation error of the splits, all scaled by the unclipped
+// volume of a_shape. Exits if a volume differs from that of the IRL split
+// by more than kSplitTolerance.
+void timeSplit(FILE* a_split_file, const ShapeFixture& a_shape,
+               const int a_number_of_trials, const int a_max_planes,
+               const std::array<SplitFunction, kNumberOfBackends>& a_split,
+               const std::array<SplitFunction, kNumberOfBackends>& a_clip) {
+  const double* pts = a_shape.pts.data();
+  const double scale = a_shape.volume;
+  std::vector<double> plane_set(a_number_of_trials * a_max_planes * 4);
+  std::vector<std::array<double, 2>> irl_volumes(a_number_of_trials);
+  std::vector<double> clip_planes(a_max_planes * 4);
+  setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes,
+                  a_shape.centroid);
+
+  for (int p = 1; p <= a_max_planes; ++p) {
+    // Split then clip time of each backend
+    Times<2 * kNumberOfBackends> times;
+    double max_error = 0.0;
+    double max_conservation_error = 0.0;
+    for (std::size_t b = 0; b < kNumberOfBackends; ++b) {
+      for (int n = 0; n < a_number_of_trials; ++n) {
+        Times<1> trial_time;
+        std::array<double, 2> volumes;
+        a_split[b](pts, p, &plane_set[n * a_max_planes * 4], volumes.data(),
+                   trial_time.data());
+        times[2 * b] += trial_time[0];
+        if (b == 0) {
+          irl_volumes[n] = volumes;
+        }
+        max_error = std::max(
+            max_error,
+            checkSplitVolumes(volumes, irl_volumes[n], scale, "split", b, p,
+                              n, &plane_set[n * a_max_planes * 4]));
+        max_conservation_error =
+            std::max(max_conservation_error,
+                     std::fabs(volumes[0] + volumes[1] - scale) / scale);
+      }
+
+      for (int n = 0; n < a_number_of_trials; ++n) {
+        const double* planes = &plane_set[n * a_max_planes * 4];
+        Times<1> trial_time;
+        std::array<double, 2> volumes{{0.0, 0.0}};
+        a_clip[b](pts, p, planes, &volumes[0], trial_time.data());
+        times[2 * b + 1] += trial_time[0];
+        for (int j = 0; j < p; ++j) {
+          // Planes before j as given, then plane j flipped
+          std::copy(planes, planes + j * 4, clip_planes.begin());
+          for (int d = 0; d < 4; ++d) {
+            clip_planes[j * 4 + d] = -planes[j * 4 + d];
+          }
+          double volume;
+          a_clip[b](pts, j + 1, clip_planes.data(), &volume,
+                    trial_time.data());
+          times[2 * b + 1] += trial_time[0];
+          volumes[1] += volume;
+        }
+        max_error = std::max(max_error,
+                             checkSplitVolumes(volumes, irl_volumes[n], scale,
+                                               "clips", b, p, n, planes));
+      }
+    }
+
+    fprintf(a_split_file,
+            "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+            "%19.13e\n",
+            static_cast<double>(p), times[0], times[1], times[2], times[3],
+            times[4], times[5], max_error, max_conservation_error);
+  }
+}
+
+}  // namespace
+
+void timeSplitPrismByPlanes(FILE* a_split_file,
+                            const int a_number_of_trials,
+                            const int a_max_planes) {
+  timeSplit(a_split_file, getPrismFixture(), a_number_of_trials, a_max_planes,
+            {{irl_gvm_prismBySplit, r3d_prototype_prismBySplit,
+              c_voftools_prototype_prismBySplit}},
+            {{irl_gvm_prismByPlanes, r3d_prototype_prismByPlanes_total,
+              c_voftools_prototype_prismByPlanes_total}});
+}
+
+void timeSplitUnitCubeByPlanes(FILE* a_split_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes) {
+  timeSplit(a_split_file, getUnitCubeFixture(), a_number_of_trials,
+            a_max_planes,
+            {{irl_gvm_unitCubeBySplit, r3d_prototype_unitCubeBySplit,
+              c_voftools_prototype_unitCubeBySplit}},
+            {{irl_gvm_unitCubeByPlanes, r3d_prototype_unitCubeByPlanes_total,
+              c_voftools_prototype_unitCubeByPlanes_total}});
+}
+
+void timeSplitTriPrismByPlanes(FILE* a_split_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes) {
+  timeSplit(a_split_file, getTriPrismFixture(), a_number_of_trials,
+            a_max_planes,
+            {{irl_gvm_triPrismBySplit, r3d_prototype_triPrismBySplit,
+              c_voftools_prototype_triPrismBySplit}},
+            {{irl_gvm_triPrismByPlanes, r3d_prototype_triPrismByPlanes_total,
+              c_voftools_prototype_triPrismByPlanes_total}});
+}
+
+void timeSplitTriHexByPlanes(FILE* a_split_file,
+                             const int a_number_of_trials,
+                             const int a_max_planes) {
+  timeSplit(a_split_file, getTriHexFixture(), a_number_of_trials, a_max_planes,
+            {{irl_gvm_triHexBySplit, r3d_prototype_triHexBySplit,
+              c_voftools_prototype_triHexBySplit}},
+            {{irl_gvm_triHexByPlanes, r3d_prototype_triHexByPlanes_total,
+              c_voftools_prototype_triHexByPlanes_total}});
+}
+
+void timeSplitSymPrismByPlanes(FILE* a_split_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes) {
+  timeSplit(a_split_file, getSymPrismFixture(), a_number_of_trials,
+            a_max_planes,
+            {{irl_gvm_symPrismBySplit, r3d_prototype_symPrismBySplit,
+              c_voftools_prototype_symPrismBySplit}},
+            {{irl_gvm_symPrismByPlanes, r3d_prototype_symPrismByPlanes_total,
+              c_voftools_prototype_symPrismByPlanes_total}});
+}
+
+void timeSplitSymHexByPlanes(FILE* a_split_file,
+                             const int a_number_of_trials,
+                             const int a_max_planes) {
+  timeSplit(a_split_file, getSymHexFixture(), a_number_of_trials, a_max_planes,
+            {{irl_gvm_symHexBySplit, r3d_prototype_symHexBySplit,
+              c_voftools_prototype_symHexBySplit}},
+            {{irl_gvm_symHexByPlanes, r3d_prototype_symHexByPlanes_total,
+              c_voftools_prototype_symHexByPlanes_total}});
+}
+
+void timeSplitStelDodecahedronByPlanes(FILE* a_split_file,
+                                       const int a_number_of_trials,
+                                       const int a_max_planes) {
+  timeSplit(
+      a_split_file, getStelDodecahedronFixture(), a_number_of_trials,
+      a_max_planes,
+      {{irl_gvm_stelDodecahedronBySplit, r3d_prototype_stelDodecahedronBySplit,
+        c_voftools_prototype_stelDodecahedronBySplit}},
+      {{irl_gvm_stelDodecahedronByPlanes,
+        r3d_prototype_stelDodecahedronByPlanes_total,
+        c_voftools_prototype_stelDodecahedronByPlanes_total}});
+}
+
+void timeSplitStelIcosahedronByPlanes(FILE* a_split_file,
+                                      const int a_number_of_trials,
+                                      const int a_max_planes) {
+  timeSplit(
+      a_split_file, getStelIcosahedronFixture(), a_number_of_trials,
+      a_max_planes,
+      {{irl_gvm_stelIcosahedronBySplit, r3d_prototype_stelIcosahedronBySplit,
+        c_voftools_prototype_stelIcosahedronBySplit}},
+      {{irl_gvm_stelIcosahedronByPlanes,
+        r3d_prototype_stelIcosahedronByPlanes_total,
+        c_voftools_prototype_stelIcosahedronByPlanes_total}});
+}
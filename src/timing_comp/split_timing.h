@@ -0,0 +1,54 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_SPLIT_TIMING_H_
+#define SRC_TIMING_COMP_SPLIT_TIMING_H_
+
+#include <cstdio>
+
+// Time splitting by planes of Triangular Prism
+void timeSplitPrismByPlanes(FILE* a_split_file,
+                            const int a_number_of_trials,
+                            const int a_max_planes);
+
+// Time splitting by planes of Unit Cube
+void timeSplitUnitCubeByPlanes(FILE* a_split_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes);
+
+// Time splitting by planes of Triangulated Triangular
+// Prism
+void timeSplitTriPrismByPlanes(FILE* a_split_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes);
+
+// Time splitting by planes of Triangulated Hexahedron
+void timeSplitTriHexByPlanes(FILE* a_split_file,
+                             const int a_number_of_trials,
+                             const int a_max_planes);
+
+// Time splitting by planes of Symmetric Triangular
+// Prism
+void timeSplitSymPrismByPlanes(FILE* a_split_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes);
+
+// Time splitting by planes of Symmetric Hexahedron
+void timeSplitSymHexByPlanes(FILE* a_split_file,
+                             const int a_number_of_trials,
+                             const int a_max_planes);
+
+// Time splitting by planes of Stellated Dodecahedron
+void timeSplitStelDodecahedronByPlanes(FILE* a_split_file,
+                                       const int a_number_of_trials,
+                                       const int a_max_planes);
+
+// Time splitting by planes of Stellated Icosahedron
+void timeSplitStelIcosahedronByPlanes(FILE* a_split_file,
+                                      const int a_number_of_trials,
+                                      const int a_max_planes);
+
+#endif  // SRC_TIMING_COMP_SPLIT_TIMING_H_
@@ -0,0 +1,153 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/tet_clip_timing.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "src/timing_comp/times.h"
+#include "src/timing_comp/timing_comp.h"
+
+// IRL GVM Timing includes
+#include "src/irl_gvm/irl_gvm_intersection.h"
+
+// Tet decomposition clipping includes
+#include "src/tet_clip/tet_clip_intersection.h"
+
+namespace {
+
+using ClipFunction = void (*)(const double*, const int, const double*,
+                              double*, double*);
+
+// Largest difference allowed between the volumes from IRL and the tet
+// decomposition, relative to the unclipped volume
+constexpr double kTetClipTolerance = 1.0e-10;
+
+// Clips the polyhedron by the same random planes with IRL, using the
+// general half-edge path, and with the signed tet decomposition in
+// TetClipPolyhedron. For each number of planes, writes the total times
+// of each and the max difference in volume, scaled by the unclipped
+// volume of a_shape. Exits if that difference exceeds kTetClipTolerance.
+void timeTetClip(FILE* a_tet_clip_file, const ShapeFixture& a_shape,
+                 const int a_number_of_trials, const int a_max_planes,
+                 ClipFunction a_irl_function,
+                 ClipFunction a_tet_clip_function) {
+  const double* pts = a_shape.pts.data();
+  const double scale = a_shape.volume;
+  std::vector<double> plane_set(a_number_of_trials * a_max_planes * 4);
+  std::vector<double> irl_volumes(a_number_of_trials);
+  setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes,
+                  a_shape.centroid);
+
+  for (int p = 1; p <= a_max_planes; ++p) {
+    Times<2> times;
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      Times<1> trial_time;
+      a_irl_function(pts, p, &plane_set[n * a_max_planes * 4],
+                     &irl_volumes[n], trial_time.data());
+      times[0] += trial_time[0];
+    }
+
+    double max_error = 0.0;
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      Times<1> trial_time;
+      double volume;
+      a_tet_clip_function(pts, p, &plane_set[n * a_max_planes * 4],
+                          &volume, trial_time.data());
+      times[1] += trial_time[0];
+      const double error = std::fabs(volume - irl_volumes[n]) / scale;
+      if (error > kTetClipTolerance) {
+        printf("Tet clip differs from IRL by %20.15e for %d planes in trial "
+               "%d\n",
+               error, p, n);
+        for (int rp = 0; rp < p; ++rp) {
+          const double* plane = &plane_set[(n * a_max_planes + rp) * 4];
+          printf("Normal : (%20.15e %20.15e %20.15e) Distance : %20.15e\n",
+                 plane[0], plane[1], plane[2], plane[3]);
+        }
+        std::exit(-1);
+      }
+      max_error = std::max(max_error, error);
+    }
+
+    fprintf(a_tet_clip_file, "%19.13e %19.13e %19.13e %19.13e\n",
+            static_cast<double>(p), times[0], times[1], max_error);
+  }
+}
+
+}  // namespace
+
+void timeTetClipPrismByPlanes(FILE* a_tet_clip_file,
+                              const int a_number_of_trials,
+                              const int a_max_planes) {
+  timeTetClip(a_tet_clip_file, getPrismFixture(), a_number_of_trials,
+              a_max_planes, irl_gvm_prismByPlanes,
+              tet_clip_prismByPlanes);
+}
+
+void timeTetClipUnitCubeByPlanes(FILE* a_tet_clip_file,
+                                 const int a_number_of_trials,
+                                 const int a_max_planes) {
+  timeTetClip(a_tet_clip_file, getUnitCubeFixture(), a_number_of_trials,
+              a_max_planes, irl_gvm_unitCubeByPlanes,
+              tet_clip_unitCubeByPlanes);
+}
+
+void timeTetClipTriPrismByPlanes(FILE* a_tet_clip_file,
+                                 const int a_number_of_trials,
+                                 const int a_max_planes) {
+  timeTetClip(a_tet_clip_file, getTriPrismFixture(), a_number_of_trials,
+              a_max_planes, irl_gvm_triPrismByPlanes,
+              tet_clip_triPrismByPlanes);
+}
+
+void timeTetClipTriHexByPlanes(FILE* a_tet_clip_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes) {
+  timeTetClip(a_tet_clip_file, getTriHexFixture(), a_number_of_trials,
+              a_max_planes, irl_gvm_triHexByPlanes,
+              tet_clip_triHexByPlanes);
+}
+
+void timeTetClipSymPrismByPlanes(FILE* a_tet_clip_file,
+                                 const int a_number_of_trials,
+                                 const int a_max_planes) {
+  timeTetClip(a_tet_clip_file, getSymPrismFixture(), a_number_of_trials,
+              a_max_planes, irl_gvm_symPrismByPlanes,
+              tet_clip_symPrismByPlanes);
+}
+
+void timeTetClipSymHexByPlanes(FILE* a_tet_clip_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes) {
+  timeTetClip(a_tet_clip_file, getSymHexFixture(), a_number_of_trials,
+              a_max_planes, irl_gvm_symHexByPlanes,
+              tet_clip_symHexByPlanes);
+}
+
+void timeTetClipStelDodecahedronByPlanes(FILE* a_tet_clip_file,
+                                         const int a_number_of_trials,
+                                         const int a_max_planes) {
+  timeTetClip(a_tet_clip_file, getStelDodecahedronFixture(),
+              a_number_of_trials, a_max_planes,
+              irl_gvm_stelDodecahedronByPlanes,
+              tet_clip_stelDodecahedronByPlanes);
+}
+
+void timeTetClipStelIcosahedronByPlanes(FILE* a_tet_clip_file,
+                                        const int a_number_of_trials,
+                                        const int a_max_planes) {
+  timeTetClip(a_tet_clip_file, getStelIcosahedronFixture(),
+              a_number_of_trials, a_max_planes,
+              irl_gvm_stelIcosahedronByPlanes,
+              tet_clip_stelIcosahedronByPlanes);
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_TET_CLIP_TIMING_H_
+#define SRC_TIMING_COMP_TET_CLIP_TIMING_H_
+
+#include <cstdio>
+
+// Time tet decomposition clipping of Triangular Prism
+void timeTetClipPrismByPlanes(FILE* a_tet_clip_file,
+                              const int a_number_of_trials,
+                              const int a_max_planes);
+
+// Time tet decomposition clipping of Unit Cube
+void timeTetClipUnitCubeByPlanes(FILE* a_tet_clip_file,
+                                 const int a_number_of_trials,
+                                 const int a_max_planes);
+
+// Time tet decomposition clipping of Triangulated Triangular
+// Prism
+void timeTetClipTriPrismByPlanes(FILE* a_tet_clip_file,
+                                 const int a_number_of_trials,
+                                 const int a_max_planes);
+
+// Time tet decomposition clipping of Triangulated Hexahedron
+void timeTetClipTriHexByPlanes(FILE* a_tet_clip_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes);
+
+// Time tet decomposition clipping of Symmetric Triangular
+// Prism
+void timeTetClipSymPrismByPlanes(FILE* a_tet_clip_file,
+                                 const int a_number_of_trials,
+                                 const int a_max_planes);
+
+// Time tet decomposition clipping of Symmetric Hexahedron
+void timeTetClipSymHexByPlanes(FILE* a_tet_clip_file,
+                               const int a_number_of_trials,
+                               const int a_max_planes);
+
+// Time tet decomposition clipping of Stellated Dodecahedron
+void timeTetClipStelDodecahedronByPlanes(FILE* a_tet_clip_file,
+                                         const int a_number_of_trials,
+                                         const int a_max_planes);
+
+// Time tet decomposition clipping of Stellated Icosahedron
+void timeTetClipStelIcosahedronByPlanes(FILE* a_tet_clip_file,
+                                        const int a_number_of_trials,
+                                        const int a_max_planes);
+
+#endif  // SRC_TIMING_COMP_TET_CLIP_TIMING_H_
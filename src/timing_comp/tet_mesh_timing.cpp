@@ -0,0 +1,254 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/tet_mesh_timing.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "src/timing_comp/files.h"
+#include "src/timing_comp/times.h"
+#include "src/timing_comp/timing_comp.h"
+
+// IRL GVM Timing includes
+#include "src/irl_gvm/compact_mesh.h"
+#include "src/irl_gvm/gmsh_reader.h"
+#include "src/irl_gvm/irl_gvm_distribution.h"
+#include "src/irl_gvm/localizer_mesh.h"
+#include "src/irl_gvm/stellated_icosahedron.h"
+
+void makeShuffledKuhnMesh(const int a_ncells, std::vector<double>* a_nodes,
+                          std::vector<int>* a_tets) {
+  const int n = a_ncells + 1;
+  const double dx = 1.0 / static_cast<double>(a_ncells);
+  a_nodes->resize(3 * n * n * n);
+  for (int k = 0; k < n; ++k) {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        double* node = &(*a_nodes)[3 * (i + j * n + k * n * n)];
+        node[0] = -0.5 + static_cast<double>(i) * dx;
+        node[1] = -0.5 + static_cast<double>(j) * dx;
+        node[2] = -0.5 + static_cast<double>(k) * dx;
+      }
+    }
+  }
+
+  // Each tet walks from corner 0 to corner 7 of the cell along one axis
+  // ordering, with corner bits ordered X/Y/Z
+  const std::array<std::array<int, 3>, 6> axis_orders{
+      {{{0, 1, 2}}, {{0, 2, 1}}, {{1, 0, 2}}, {{1, 2, 0}}, {{2, 0, 1}},
+       {{2, 1, 0}}}};
+  std::vector<int> tets;
+  tets.reserve(24 * a_ncells * a_ncells * a_ncells);
+  for (int k = 0; k < a_ncells; ++k) {
+    for (int j = 0; j < a_ncells; ++j) {
+      for (int i = 0; i < a_ncells; ++i) {
+        for (const auto& order : axis_orders) {
+          const std::array<int, 4> corners{
+              {0, 1 << order[0], (1 << order[0]) | (1 << order[1]), 7}};
+          for (const int corner : corners) {
+            tets.push_back((i + (corner & 1)) + (j + ((corner >> 1) & 1)) * n +
+                           (k + ((corner >> 2) & 1)) * n * n);
+          }
+        }
+      }
+    }
+  }
+
+  // Fixed seed, so every run uses the same mesh
+  std::mt19937 gen(12345);
+  std::vector<int> node_order(n * n * n);
+  std::iota(node_order.begin(), node_order.end(), 0);
+  std::shuffle(node_order.begin(), node_order.end(), gen);
+  std::vector<double> nodes(a_nodes->size());
+  std::vector<int> new_index(node_order.size());
+  for (std::size_t v = 0; v < node_order.size(); ++v) {
+    new_index[node_order[v]] = static_cast<int>(v);
+    for (int d = 0; d < 3; ++d) {
+      nodes[3 * v + d] = (*a_nodes)[3 * node_order[v] + d];
+    }
+  }
+  a_nodes->swap(nodes);
+
+  std::vector<int> tet_order(tets.size() / 4);
+  std::iota(tet_order.begin(), tet_order.end(), 0);
+  std::shuffle(tet_order.begin(), tet_order.end(), gen);
+  a_tets->resize(tets.size());
+  for (std::size_t t = 0; t < tet_order.size(); ++t) {
+    for (int v = 0; v < 4; ++v) {
+      (*a_tets)[4 * t + v] = new_index[tets[4 * tet_order[t] + v]];
+    }
+  }
+}
+
+namespace {
+
+using DistributeFunction = void (*)(const double*, const LocalizerMesh&,
+                                    const bool, double*, double*,
+                                    std::size_t*);
+
+// Volume of the tets in a_tets, in either orientation
+double getTetMeshVolume(const std::vector<double>& a_nodes,
+                        const std::vector<int>& a_tets) {
+  double volume = 0.0;
+  for (std::size_t t = 0; t < a_tets.size() / 4; ++t) {
+    const double* p0 = &a_nodes[3 * a_tets[4 * t]];
+    std::array<std::array<double, 3>, 3> edges;
+    for (int v = 0; v < 3; ++v) {
+      for (int d = 0; d < 3; ++d) {
+        edges[v][d] = a_nodes[3 * a_tets[4 * t + v + 1] + d] - p0[d];
+      }
+    }
+    volume += std::fabs(
+                  edges[0][0] * (edges[1][1] * edges[2][2] -
+                                 edges[1][2] * edges[2][1]) -
+                  edges[0][1] * (edges[1][0] * edges[2][2] -
+                                 edges[1][2] * edges[2][0]) +
+                  edges[0][2] * (edges[1][0] * edges[2][1] -
+                                 edges[1][1] * edges[2][0])) /
+              6.0;
+  }
+  return volume;
+}
+
+// Distributes a polyhedron centered on the origin, given as in
+// sweepOntoCartesianMesh, onto a_mesh a_number_of_trials times. It is
+// scaled so its widest extent a_extent spans a_size_ratio times
+// a_cell_size, and placed at random inside the bounding box of the mesh.
+// Writes the average cells entered, the time per polyhedron, the time per
+// entered cell, and the mean and max conservation error.
+void distributeOntoTetMesh(FILE* a_tet_mesh_file, const double* a_pts,
+                           const std::size_t a_number_of_values,
+                           const double a_extent, const double a_volume,
+                           const int a_number_of_trials,
+                           const LocalizerMesh& a_mesh,
+                           const std::array<IRL::Pt, 2>& a_bounding_pts,
+                           const double a_cell_size, const double a_size_ratio,
+                           DistributeFunction a_distribute) {
+  const double scale = a_size_ratio * a_cell_size / a_extent;
+  const double total_volume = a_volume * scale * scale * scale;
+  std::array<double, 3> center;
+  std::array<double, 3> max_shift;
+  for (int d = 0; d < 3; ++d) {
+    center[d] = 0.5 * (a_bounding_pts[0][d] + a_bounding_pts[1][d]);
+    max_shift[d] = std::max(
+        0.0, 0.5 * (a_bounding_pts[1][d] - a_bounding_pts[0][d]) -
+                 0.5 * a_size_ratio * a_cell_size);
+  }
+
+  std::vector<double> shifted_pts(a_number_of_values);
+  Times<1> irl_gvm_times;
+  std::size_t cells_entered = 0;
+  double volume_error = 0.0;
+  double abs_volume_error = -DBL_MAX;
+  for (int n = 0; n < a_number_of_trials; ++n) {
+    const std::array<double, 3> shift{
+        {center[0] + max_shift[0] * randomDouble(),
+         center[1] + max_shift[1] * randomDouble(),
+         center[2] + max_shift[2] * randomDouble()}};
+    for (std::size_t v = 0; v < a_number_of_values; ++v) {
+      shifted_pts[v] = a_pts[v] * scale + shift[v % 3];
+    }
+
+    Times<1> irl_gvm_trial_time;
+    std::size_t trial_cells_entered;
+    double irl_gvm_volume;
+    a_distribute(shifted_pts.data(), a_mesh, true, &irl_gvm_volume,
+                 irl_gvm_trial_time.data(), &trial_cells_entered);
+
+    const double error = std::fabs(1.0 - irl_gvm_volume / total_volume);
+    volume_error += error;
+    abs_volume_error = std::max(abs_volume_error, error);
+    irl_gvm_times += irl_gvm_trial_time;
+    cells_entered += trial_cells_entered;
+  }
+  // Write out time in seconds
+  fprintf(a_tet_mesh_file, "%19.13e %19.13e %19.13e %19.13e %19.13e\n",
+          static_cast<double>(cells_entered) /
+              static_cast<double>(a_number_of_trials),
+          irl_gvm_times[0] / static_cast<double>(a_number_of_trials),
+          irl_gvm_times[0] / static_cast<double>(cells_entered),
+          volume_error / static_cast<double>(a_number_of_trials),
+          abs_volume_error);
+  fflush(a_tet_mesh_file);
+}
+
+}  // namespace
+
+void distributeOntoUnstructuredTetMesh(FILE* a_tet_mesh_file,
+                                       const std::string& a_mesh_file_name,
+                                       const int a_number_of_trials,
+                                       const int a_ncells,
+                                       const double a_size_ratio) {
+  std::vector<double> nodes;
+  std::vector<int> tets;
+  double start = omp_get_wtime();
+  if (std::ifstream(a_mesh_file_name)) {
+    std::cout << "Reading " << a_mesh_file_name << std::endl;
+    if (!readGmshTetMesh(a_mesh_file_name, &nodes, &tets)) {
+      return;
+    }
+  } else {
+    std::cout << "Generating shuffled tet mesh with " << 6 * a_ncells *
+                     a_ncells * a_ncells << " tets" << std::endl;
+    makeShuffledKuhnMesh(a_ncells, &nodes, &tets);
+  }
+  double end = omp_get_wtime();
+  const double load_time = end - start;
+
+  const auto compact_mesh = CompactMesh::fromTets(nodes, tets);
+  const auto mesh = LocalizerMesh::fromCompact(compact_mesh);
+  const int number_of_tets = compact_mesh.getNumberOfCells();
+
+  // Polyhedra are sized relative to the edge of a cube holding six
+  // average tets, which is the cell size of a generated mesh
+  const double cell_size = std::cbrt(
+      6.0 * getTetMeshVolume(nodes, tets) / static_cast<double>(number_of_tets));
+
+  // Write out time in seconds and memory in bytes
+  fprintf(a_tet_mesh_file,
+          "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e\n\n",
+          static_cast<double>(number_of_tets),
+          static_cast<double>(nodes.size() / 3), load_time,
+          compact_mesh.getSetupTime(),
+          static_cast<double>(compact_mesh.getMemoryFootprint()),
+          mesh.getSetupTime(), static_cast<double>(mesh.getMemoryFootprint()));
+
+  std::cout << "Distribute Cube onto Unstructured Tet Mesh" << std::endl;
+  // Pass cube as lower and upper bounding box points
+  const std::array<double, 6> cube{{-0.5, -0.5, -0.5, 0.5, 0.5, 0.5}};
+  distributeOntoTetMesh(a_tet_mesh_file, cube.data(), cube.size(), 1.0, 1.0,
+                        a_number_of_trials, mesh,
+                        compact_mesh.getBoundingPts(), cell_size,
+                        a_size_ratio, irl_gvm_cubeOntoMesh);
+
+  std::cout << "Distribute Stellated Icosahedron onto Unstructured Tet Mesh"
+            << std::endl;
+  const auto stel_icosahedron_pts = getStelIcosahedronPts();
+  const auto stel_icosahedron = IRL::StellatedIcosahedron::fromRawDoublePointer(
+      32, stel_icosahedron_pts.data());
+  // Object is centered on the origin, so its widest extent is
+  // twice the largest coordinate magnitude.
+  double extent = 0.0;
+  for (const auto coordinate : stel_icosahedron_pts) {
+    extent = std::max(extent, 2.0 * std::fabs(coordinate));
+  }
+  distributeOntoTetMesh(a_tet_mesh_file, stel_icosahedron_pts.data(),
+                        stel_icosahedron_pts.size(), extent,
+                        stel_icosahedron.calculateVolume(),
+                        a_number_of_trials, mesh,
+                        compact_mesh.getBoundingPts(), cell_size,
+                        a_size_ratio, irl_gvm_stelIcosahedronOntoMesh);
+}
@@ -0,0 +1,33 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_TET_MESH_TIMING_H_
+#define SRC_TIMING_COMP_TET_MESH_TIMING_H_
+
+#include <string>
+#include <vector>
+
+#include "src/timing_comp/files.h"
+
+// Splits each cell of a Cartesian Mesh of [-0.5,0.5]^3 with a_ncells^3
+// cells into the 6 tets around its main diagonal, which conform across
+// cells. Nodes and tets are then renumbered in a random order, as in a
+// mesh from an unstructured mesh generator.
+void makeShuffledKuhnMesh(const int a_ncells, std::vector<double>* a_nodes,
+                          std::vector<int>* a_tets);
+
+// Distributes Unit Cubes and Stellated Icosahedra, each spanning
+// a_size_ratio cells, onto an unstructured Tet Mesh. The mesh is read from
+// the Gmsh file a_mesh_file_name if it exists, and otherwise generated by
+// splitting each cell of a Cartesian Mesh of a_ncells^3 cells into 6 tets
+// and shuffling the node and tet numbering.
+void distributeOntoUnstructuredTetMesh(FILE* a_tet_mesh_file,
+                                       const std::string& a_mesh_file_name,
+                                       const int a_number_of_trials,
+                                       const int a_ncells,
+                                       const double a_size_ratio);
+
+#endif  // SRC_TIMING_COMP_TET_MESH_TIMING_H_
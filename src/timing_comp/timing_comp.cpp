@@ -17,12 +17,46 @@
 
 #include "src/timing_comp/distribution_timing.h"
 #include "src/timing_comp/files.h"
+#include "src/timing_comp/flux_volume_timing.h"
 #include "src/timing_comp/intersection_timing.h"
+#include "src/timing_comp/mesh_layout_timing.h"
+#include "src/timing_comp/plane_sweep_timing.h"
+#include "src/timing_comp/precision_timing.h"
+#include "src/timing_comp/reconstruction_timing.h"
+#include "src/timing_comp/split_timing.h"
+#include "src/timing_comp/tet_clip_timing.h"
+#include "src/timing_comp/tet_mesh_timing.h"
+#include "src/timing_comp/two_phase_timing.h"
+#include "src/timing_comp/volume_fraction_timing.h"
+#include "src/timing_comp/voftools_batch_timing.h"
 
 // IRL Includes
 #include "src/geometry/general/normal.h"
 #include "src/geometry/general/plane.h"
 #include "src/geometry/general/pt.h"
+#include "src/geometry/polyhedrons/dodecahedron.h"
+#include "src/geometry/polyhedrons/octahedron.h"
+#include "src/geometry/polyhedrons/rectangular_cuboid.h"
+#include "src/geometry/polyhedrons/symmetric_decompositions/symmetric_hexahedron.h"
+#include "src/geometry/polyhedrons/symmetric_decompositions/symmetric_triangular_prism.h"
+#include "src/geometry/polyhedrons/triangular_prism.h"
+
+// IRL GVM includes
+#include "src/irl_gvm/stellated_dodecahedron.h"
+#include "src/irl_gvm/stellated_icosahedron.h"
+
+// Tet decomposition clipping includes
+#include "src/tet_clip/tet_clip_intersection.h"
+
+// R3D Includes
+extern "C" {
+#include "src/r3d/r3d_prototype_intersection.h"
+}
+
+// VOFTools Includes
+extern "C" {
+#include "src/voftools/voftools_intersection.h"
+}
 
 int main(int argc, char** argv) {
   printf("Timing with precision %16.8e\n", omp_get_wtick());
@@ -34,14 +68,61 @@ int main(int argc, char** argv) {
     std::cout << "     Sample file of interface planes (0)" << std::endl;
     std::cout << "     Plane intersections with polyhedra (1)" << std::endl;
     std::cout << "     Distribution of polyhedron onto meshes (2)" << std::endl;
+    std::cout << "     Single vs. double precision intersections (3)"
+              << std::endl;
+    std::cout << "     Tet decomposition intersections (4)" << std::endl;
+    std::cout << "     Batched VOFTools intersections (5)" << std::endl;
+    std::cout << "     Distribution onto Cartesian meshes of increasing "
+                 "resolution (6)"
+              << std::endl;
+    std::cout << "     Parallel distribution of many polyhedra onto a "
+                 "Cartesian mesh (7)"
+              << std::endl;
+    std::cout << "     Mesh layout memory and traversal (8)" << std::endl;
+    std::cout << "     Distribution onto an unstructured tet mesh (9)"
+              << std::endl;
+    std::cout << "     Distribution onto spherical meshes of increasing "
+                 "angular resolution (10)"
+              << std::endl;
+    std::cout << "     Semi-Lagrangian flux volumes on a Cartesian mesh (11)"
+              << std::endl;
+    std::cout << "     Two-phase distribution onto meshes with interface "
+                 "reconstructions (12)"
+              << std::endl;
+    std::cout << "     Two-sided splits of polyhedra by planes (13)"
+              << std::endl;
+    std::cout << "     Interface reconstructions from volume fraction fields "
+                 "(14)"
+              << std::endl;
+    std::cout << "     Volume fraction matching in polyhedra (15)" << std::endl;
+    std::cout << "     Plane sweeps through polyhedra at fixed normals (16)"
+              << std::endl;
     std::cout << "2 -- Number of trials per test (integer >1000)" << std::endl;
     std::cout
         << "3 -- Max number of planes to intersect at one time (integer >0)\n"
-        << "     Note: This only has an effect if the first input on CLI is 1"
+        << "     Note: This only has an effect if the first input on CLI is 1, "
+           "3, 4, 5, 13, or 16\n"
+        << "     For case 6, this is instead the largest number of mesh cells "
+           "per direction, and for case 7 the number of mesh cells per "
+           "direction\n"
+        << "     For case 8, this is the largest number of mesh cells per "
+           "direction (e.g. 216 for 10^7 cells), and for case 9 the number "
+           "of cells per direction split into 6 tets each when tet_mesh.msh "
+           "is not present\n"
+        << "     For case 10, this is the largest number of angular cells per "
+           "direction, and for cases 11, 12, and 14 the number of mesh cells "
+           "per direction"
         << std::endl;
     std::cout
         << "4 -- Whether to produce section timings (0), total timings (1), or both (2)\n"
-        << "     Note: This only has an effect if the first input on CLI is 1"
+        << "     Note: This only has an effect if the first input on CLI is 1\n"
+        << "     For cases 6 and 7, this is instead the number of cells (can be "
+           "fractional) spanned by the polyhedron, and for case 9 the same "
+           "in cells of the tet mesh\n"
+        << "     For case 10, this is the number of radial cells (integer >0), "
+           "and for cases 11 and 12 the CFL number (can be fractional)\n"
+        << "     For case 14, this is the thickness of the sheet in cells (can "
+           "be fractional)"
 	<< std::endl;
     return -1;
   }
@@ -61,6 +142,9 @@ int main(int argc, char** argv) {
     return -1;
   }
 
+  // Shared by every thread, so built before any parallel region
+  r3d_prototype_initialize();
+
   switch (case_number) {
     // Just export randomly generated planes for display
     // with python script sample_example.py
@@ -83,17 +167,22 @@ int main(int argc, char** argv) {
 
     // Perform intersections of sets of [1:max_planes] random planes
     // with different polyhedra. Writes out results to
-    // irl_timing.txt, r3d_timing.txt, and voftools_timing.txt
+    // irl_timing.txt, r3d_timing.txt, voftools_timing.txt,
+    // r3d_prototype_timing.txt, and voftools_prototype_timing.txt
     // Results can be displayed in aggregate by running
     // the python script postprocess.py
     case 1: {
       // Intersection of polyhedra with random planes
       auto output_files =
-          Files("irl_timing.txt", "r3d_timing.txt", "voftools_timing.txt");
+          Files("irl_timing.txt", "r3d_timing.txt", "voftools_timing.txt",
+                "r3d_prototype_timing.txt", "voftools_prototype_timing.txt");
 
       output_files.writeToFiles(std::to_string(number_of_trials) + " " +
                                 std::to_string(max_planes) + "\n\n");
 
+      std::cout << "VOFTools polyhedron storage: "
+                << c_voftools_polyhedronBytes() << " bytes" << std::endl;
+
       std::cout << "Intersecting Prism by Planes" << std::endl;
       intersectPrismByPlanes(output_files, number_of_trials, max_planes, timings_to_produce);
 
@@ -181,6 +270,540 @@ int main(int argc, char** argv) {
       break;
     }
 
+    // Perform intersections of sets of [1:max_planes] random planes
+    // with the in-repo clipper in single and double precision,
+    // using IRL (double precision) as the reference volume.
+    // Results are exported to precision_timing.txt.
+    case 3: {
+      FILE* precision_file = fopen("precision_timing.txt", "w");
+      fprintf(precision_file, "%d %d\n\n", number_of_trials, max_planes);
+
+      std::cout << "Precision of Prism by Planes" << std::endl;
+      comparePrecisionPrismByPlanes(precision_file, number_of_trials,
+                                    max_planes);
+
+      fprintf(precision_file, "\n");
+
+      std::cout << "Precision of Unit Cube by Planes" << std::endl;
+      comparePrecisionUnitCubeByPlanes(precision_file, number_of_trials,
+                                       max_planes);
+
+      fprintf(precision_file, "\n");
+
+      std::cout << "Precision of Triangulated Prism by Planes" << std::endl;
+      comparePrecisionTriPrismByPlanes(precision_file, number_of_trials,
+                                       max_planes);
+
+      fprintf(precision_file, "\n");
+
+      std::cout << "Precision of Triangulated Hexahedron by Planes"
+                << std::endl;
+      comparePrecisionTriHexByPlanes(precision_file, number_of_trials,
+                                     max_planes);
+
+      fprintf(precision_file, "\n");
+
+      std::cout << "Precision of Symmetric Prism by Planes" << std::endl;
+      comparePrecisionSymPrismByPlanes(precision_file, number_of_trials,
+                                       max_planes);
+
+      fprintf(precision_file, "\n");
+
+      std::cout << "Precision of Symmetric Hexahedron by Planes" << std::endl;
+      comparePrecisionSymHexByPlanes(precision_file, number_of_trials,
+                                     max_planes);
+
+      fprintf(precision_file, "\n");
+
+      std::cout << "Precision of Stellated Dodecahedron by Planes"
+                << std::endl;
+      comparePrecisionStelDodecahedronByPlanes(precision_file,
+                                               number_of_trials, max_planes);
+
+      fprintf(precision_file, "\n");
+
+      std::cout << "Precision of Stellated Icosahedron by Planes" << std::endl;
+      comparePrecisionStelIcosahedronByPlanes(precision_file,
+                                              number_of_trials, max_planes);
+
+      fclose(precision_file);
+      break;
+    }
+
+    // Perform intersections of sets of [1:max_planes] random planes
+    // with IRL and with a signed tet decomposition of each polyhedron,
+    // built from its fixed topology. Results are exported to
+    // tet_clip_timing.txt.
+    case 4: {
+      if (max_planes > tet_clip_max_planes) {
+        std::cout << "Requires max_planes set to <= " << tet_clip_max_planes
+                  << std::endl;
+        return -1;
+      }
+      FILE* tet_clip_file = fopen("tet_clip_timing.txt", "w");
+      fprintf(tet_clip_file, "%d %d\n\n", number_of_trials, max_planes);
+
+      std::cout << "Tet Clipping of Prism by Planes" << std::endl;
+      timeTetClipPrismByPlanes(tet_clip_file, number_of_trials, max_planes);
+
+      fprintf(tet_clip_file, "\n");
+
+      std::cout << "Tet Clipping of Unit Cube by Planes" << std::endl;
+      timeTetClipUnitCubeByPlanes(tet_clip_file, number_of_trials, max_planes);
+
+      fprintf(tet_clip_file, "\n");
+
+      std::cout << "Tet Clipping of Triangulated Prism by Planes" << std::endl;
+      timeTetClipTriPrismByPlanes(tet_clip_file, number_of_trials, max_planes);
+
+      fprintf(tet_clip_file, "\n");
+
+      std::cout << "Tet Clipping of Triangulated Hexahedron by Planes"
+                << std::endl;
+      timeTetClipTriHexByPlanes(tet_clip_file, number_of_trials, max_planes);
+
+      fprintf(tet_clip_file, "\n");
+
+      std::cout << "Tet Clipping of Symmetric Prism by Planes" << std::endl;
+      timeTetClipSymPrismByPlanes(tet_clip_file, number_of_trials, max_planes);
+
+      fprintf(tet_clip_file, "\n");
+
+      std::cout << "Tet Clipping of Symmetric Hexahedron by Planes"
+                << std::endl;
+      timeTetClipSymHexByPlanes(tet_clip_file, number_of_trials, max_planes);
+
+      fprintf(tet_clip_file, "\n");
+
+      std::cout << "Tet Clipping of Stellated Dodecahedron by Planes"
+                << std::endl;
+      timeTetClipStelDodecahedronByPlanes(tet_clip_file, number_of_trials,
+                                          max_planes);
+
+      fprintf(tet_clip_file, "\n");
+
+      std::cout << "Tet Clipping of Stellated Icosahedron by Planes"
+                << std::endl;
+      timeTetClipStelIcosahedronByPlanes(tet_clip_file, number_of_trials,
+                                         max_planes);
+
+      fclose(tet_clip_file);
+      break;
+    }
+
+    // Perform intersections of sets of [1:max_planes] random planes
+    // with VOFTools, once calling into Fortran per polyhedron and once
+    // for the whole set of trials through an OpenMP Fortran loop.
+    // Results are exported to voftools_batch_timing.txt.
+    case 5: {
+      FILE* voftools_batch_file = fopen("voftools_batch_timing.txt", "w");
+      fprintf(voftools_batch_file, "%d %d %d\n\n", number_of_trials,
+              max_planes, omp_get_max_threads());
+
+      std::cout << "Batched VOFTools Prism by Planes" << std::endl;
+      timeVoftoolsBatchPrismByPlanes(voftools_batch_file, number_of_trials,
+                                     max_planes);
+
+      fprintf(voftools_batch_file, "\n");
+
+      std::cout << "Batched VOFTools Unit Cube by Planes" << std::endl;
+      timeVoftoolsBatchUnitCubeByPlanes(voftools_batch_file, number_of_trials,
+                                        max_planes);
+
+      fprintf(voftools_batch_file, "\n");
+
+      std::cout << "Batched VOFTools Triangulated Prism by Planes" << std::endl;
+      timeVoftoolsBatchTriPrismByPlanes(voftools_batch_file, number_of_trials,
+                                        max_planes);
+
+      fprintf(voftools_batch_file, "\n");
+
+      std::cout << "Batched VOFTools Triangulated Hexahedron by Planes"
+                << std::endl;
+      timeVoftoolsBatchTriHexByPlanes(voftools_batch_file, number_of_trials,
+                                      max_planes);
+
+      fprintf(voftools_batch_file, "\n");
+
+      std::cout << "Batched VOFTools Symmetric Prism by Planes" << std::endl;
+      timeVoftoolsBatchSymPrismByPlanes(voftools_batch_file, number_of_trials,
+                                        max_planes);
+
+      fprintf(voftools_batch_file, "\n");
+
+      std::cout << "Batched VOFTools Symmetric Hexahedron by Planes"
+                << std::endl;
+      timeVoftoolsBatchSymHexByPlanes(voftools_batch_file, number_of_trials,
+                                      max_planes);
+
+      fprintf(voftools_batch_file, "\n");
+
+      std::cout << "Batched VOFTools Stellated Dodecahedron by Planes"
+                << std::endl;
+      timeVoftoolsBatchStelDodecahedronByPlanes(voftools_batch_file,
+                                                number_of_trials, max_planes);
+
+      fprintf(voftools_batch_file, "\n");
+
+      std::cout << "Batched VOFTools Stellated Icosahedron by Planes"
+                << std::endl;
+      timeVoftoolsBatchStelIcosahedronByPlanes(voftools_batch_file,
+                                               number_of_trials, max_planes);
+
+      fclose(voftools_batch_file);
+      break;
+    }
+
+    // Distribute polyhedra onto Cartesian meshes with resolutions
+    // doubling up to max_planes cells per direction, with the polyhedra
+    // spanning the number of cells given by the fourth CLI argument.
+    // Results are exported to distribution_sweep_timing.txt.
+    case 6: {
+      const double size_ratio = std::stod(std::string(argv[4]));
+      if (size_ratio <= 0.0 || size_ratio + 1.0 > max_planes) {
+        std::cout << "Requires polyhedron size in cells to be > 0 and "
+                     "<= number of cells per direction - 1"
+                  << std::endl;
+        return -1;
+      }
+      FILE* sweep_file = fopen("distribution_sweep_timing.txt", "w");
+      fprintf(sweep_file, "%d %d %19.13e\n\n", number_of_trials, max_planes,
+              size_ratio);
+
+      std::cout << "Distribute Cube onto Cartesian Meshes" << std::endl;
+      sweepCubeOntoCartesianMesh(sweep_file, number_of_trials, max_planes,
+                                 size_ratio);
+
+      fprintf(sweep_file, "\n");
+
+      std::cout << "Distribute Stellated Icosahedron onto Cartesian Meshes"
+                << std::endl;
+      sweepStelIcosahedronOntoCartesianMesh(sweep_file, number_of_trials,
+                                            max_planes, size_ratio);
+
+      fclose(sweep_file);
+      break;
+    }
+
+    // Distribute number_of_trials polyhedra, at random positions, onto a
+    // Cartesian mesh of max_planes cells per direction with an increasing
+    // number of OpenMP threads, each polyhedron spanning the number of
+    // cells given by the fourth CLI argument.
+    // Results are exported to distribution_scaling_timing.txt.
+    case 7: {
+      const double size_ratio = std::stod(std::string(argv[4]));
+      if (size_ratio <= 0.0 || size_ratio >= max_planes) {
+        std::cout << "Requires polyhedron size in cells to be > 0 and "
+                     "< number of cells per direction"
+                  << std::endl;
+        return -1;
+      }
+      FILE* scaling_file = fopen("distribution_scaling_timing.txt", "w");
+      fprintf(scaling_file, "%d %d %19.13e\n\n", number_of_trials,
+              max_planes, size_ratio);
+
+      std::cout << "Distribute Cubes onto Cartesian Mesh in Parallel"
+                << std::endl;
+      scaleCubesOntoCartesianMesh(scaling_file, number_of_trials, max_planes,
+                                  size_ratio);
+
+      fprintf(scaling_file, "\n");
+
+      std::cout
+          << "Distribute Stellated Icosahedra onto Cartesian Mesh in Parallel"
+          << std::endl;
+      scaleStelIcosahedraOntoCartesianMesh(scaling_file, number_of_trials,
+                                           max_planes, size_ratio);
+
+      fclose(scaling_file);
+      break;
+    }
+
+    // Build Cartesian meshes of 100^3 cells, doubling the number of cells
+    // up to max_planes^3, both as LocalizerLink objects and as a
+    // CompactMesh, and walk number_of_trials breadth-first walks over each.
+    // Results are exported to mesh_layout_timing.txt.
+    case 8: {
+      FILE* layout_file = fopen("mesh_layout_timing.txt", "w");
+      fprintf(layout_file, "%d %d\n\n", number_of_trials, max_planes);
+
+      std::cout << "Compare Cartesian Mesh Layouts" << std::endl;
+      compareCubicMeshLayouts(layout_file, number_of_trials, max_planes);
+
+      fclose(layout_file);
+      break;
+    }
+
+    // Distribute number_of_trials polyhedra, each spanning the number of
+    // cells given by the fourth CLI argument, onto an unstructured tet
+    // mesh read from tet_mesh.msh (Gmsh version 2) if present, or else
+    // generated from max_planes^3 Cartesian cells.
+    // Results are exported to distribution_tet_mesh_timing.txt.
+    case 9: {
+      const double size_ratio = std::stod(std::string(argv[4]));
+      if (size_ratio <= 0.0) {
+        std::cout << "Requires polyhedron size in cells to be > 0"
+                  << std::endl;
+        return -1;
+      }
+      FILE* tet_mesh_file = fopen("distribution_tet_mesh_timing.txt", "w");
+      fprintf(tet_mesh_file, "%d %d %19.13e\n\n", number_of_trials,
+              max_planes, size_ratio);
+
+      distributeOntoUnstructuredTetMesh(tet_mesh_file, "tet_mesh.msh",
+                                        number_of_trials, max_planes,
+                                        size_ratio);
+
+      fclose(tet_mesh_file);
+      break;
+    }
+
+    // Distribute polyhedra onto spherical meshes with the number of
+    // (theta, phi) sectors per direction doubling from 3 up to max_planes,
+    // and the number of radial cells given by the fourth CLI argument.
+    // Results are exported to distribution_spherical_sweep_timing.txt.
+    case 10: {
+      if (max_planes < 3 || timings_to_produce < 1) {
+        std::cout << "Requires at least 3 angular cells per direction and "
+                     "at least 1 radial cell"
+                  << std::endl;
+        return -1;
+      }
+      FILE* sweep_file = fopen("distribution_spherical_sweep_timing.txt", "w");
+      fprintf(sweep_file, "%d %d %d\n\n", number_of_trials, max_planes,
+              timings_to_produce);
+
+      std::cout << "Distribute Cube onto Spherical Cartesian Meshes"
+                << std::endl;
+      sweepCubeOntoSphericalCartesianMesh(sweep_file, number_of_trials,
+                                          max_planes, timings_to_produce);
+
+      fprintf(sweep_file, "\n");
+
+      std::cout
+          << "Distribute Stellated Icosahedron onto Spherical Cartesian Meshes"
+          << std::endl;
+      sweepStelIcosahedronOntoSphericalCartesianMesh(
+          sweep_file, number_of_trials, max_planes, timings_to_produce);
+
+      fclose(sweep_file);
+      break;
+    }
+
+    // Build the semi-Lagrangian flux volume of every interior face of a
+    // Cartesian mesh with max_planes^3 cells as a Symmetric Hexahedron,
+    // back-traced through a deformation field with the CFL number given
+    // by the fourth CLI argument, then distribute them onto the mesh with
+    // increasing numbers of threads. The number of trials is not used.
+    // Results are exported to flux_volume_timing.txt.
+    case 11: {
+      const double cfl = std::stod(std::string(argv[4]));
+      if (max_planes < 2 || cfl <= 0.0) {
+        std::cout << "Requires at least 2 cells per direction and a CFL "
+                     "number > 0"
+                  << std::endl;
+        return -1;
+      }
+      FILE* flux_volume_file = fopen("flux_volume_timing.txt", "w");
+      fprintf(flux_volume_file, "%d %19.13e %d\n\n", max_planes, cfl,
+              omp_get_max_threads());
+
+      std::cout << "Semi-Lagrangian Symmetric Hexahedron Flux Volumes"
+                << std::endl;
+      timeSymHexFluxVolumes(flux_volume_file, max_planes, cfl);
+
+      fclose(flux_volume_file);
+      break;
+    }
+
+    // Distribute the semi-Lagrangian flux volumes of case 11, for the CFL
+    // number given by the fourth CLI argument, onto a Cartesian mesh with
+    // max_planes^3 cells and onto the tet mesh made from it, where every
+    // cell carries a planar reconstruction of a sphere, returning the
+    // volume on each side of the interface.
+    // Results are exported to distribution_two_phase_timing.txt.
+    case 12: {
+      const double cfl = std::stod(std::string(argv[4]));
+      if (max_planes < 2 || cfl <= 0.0) {
+        std::cout << "Requires at least 2 cells per direction and a CFL "
+                     "number > 0"
+                  << std::endl;
+        return -1;
+      }
+      FILE* two_phase_file = fopen("distribution_two_phase_timing.txt", "w");
+      fprintf(two_phase_file, "%d %19.13e\n\n", max_planes, cfl);
+
+      distributeTwoPhaseOntoMeshes(two_phase_file, max_planes, cfl);
+
+      fclose(two_phase_file);
+      break;
+    }
+
+    // Split each polyhedron by sets of [1:max_planes] random planes with
+    // IRL, R3D, and VOFTools, keeping the volume on both sides in a single
+    // pass, and compare with independent clips that each keep one part.
+    // Results are exported to split_timing.txt.
+    case 13: {
+      FILE* split_file = fopen("split_timing.txt", "w");
+      fprintf(split_file, "%d %d\n\n", number_of_trials, max_planes);
+
+      std::cout << "Split Triangular Prism by Planes" << std::endl;
+      timeSplitPrismByPlanes(split_file, number_of_trials, max_planes);
+
+      fprintf(split_file, "\n");
+
+      std::cout << "Split Unit Cube by Planes" << std::endl;
+      timeSplitUnitCubeByPlanes(split_file, number_of_trials, max_planes);
+
+      fprintf(split_file, "\n");
+
+      std::cout << "Split Triangulated Triangular Prism by Planes" << std::endl;
+      timeSplitTriPrismByPlanes(split_file, number_of_trials, max_planes);
+
+      fprintf(split_file, "\n");
+
+      std::cout << "Split Triangulated Hexahedron by Planes" << std::endl;
+      timeSplitTriHexByPlanes(split_file, number_of_trials, max_planes);
+
+      fprintf(split_file, "\n");
+
+      std::cout << "Split Symmetric Triangular Prism by Planes" << std::endl;
+      timeSplitSymPrismByPlanes(split_file, number_of_trials, max_planes);
+
+      fprintf(split_file, "\n");
+
+      std::cout << "Split Symmetric Hexahedron by Planes" << std::endl;
+      timeSplitSymHexByPlanes(split_file, number_of_trials, max_planes);
+
+      fprintf(split_file, "\n");
+
+      std::cout << "Split Stellated Dodecahedron by Planes" << std::endl;
+      timeSplitStelDodecahedronByPlanes(split_file, number_of_trials,
+                                        max_planes);
+
+      fprintf(split_file, "\n");
+
+      std::cout << "Split Stellated Icosahedron by Planes" << std::endl;
+      timeSplitStelIcosahedronByPlanes(split_file, number_of_trials,
+                                       max_planes);
+
+      fclose(split_file);
+      break;
+    }
+
+    // Build volume fraction fields of a sphere and a sheet on a Cartesian
+    // mesh with max_planes^3 cells, and time the ELVIRA, LVIRA, and MoF
+    // reconstructions of IRL in their interface cells.
+    // Results are exported to reconstruction_timing.txt.
+    case 14: {
+      const double sheet_thickness = std::stod(std::string(argv[4]));
+      if (max_planes < 4 || sheet_thickness <= 0.0) {
+        std::cout << "Requires at least 4 cells per direction and a sheet "
+                     "thickness > 0"
+                  << std::endl;
+        return -1;
+      }
+      FILE* reconstruction_file = fopen("reconstruction_timing.txt", "w");
+      fprintf(reconstruction_file, "%d %19.13e %d\n\n", max_planes,
+              sheet_thickness, omp_get_max_threads());
+
+      std::cout << "Interface Reconstructions" << std::endl;
+      timeReconstructions(reconstruction_file, max_planes, sheet_thickness);
+
+      fclose(reconstruction_file);
+      break;
+    }
+
+    // Find the plane distance matching number_of_trials random volume
+    // fractions, each with a random normal, in each polyhedron with IRL,
+    // VOFTools, and a VolumeProfile.
+    // Results are exported to volume_fraction_timing.txt.
+    case 15: {
+      FILE* matching_file = fopen("volume_fraction_timing.txt", "w");
+      fprintf(matching_file, "%d\n\n", number_of_trials);
+
+      std::cout << "Volume Fraction Matching in Triangular Prism" << std::endl;
+      timeMatchPrismVolumeFraction(matching_file, number_of_trials);
+
+      std::cout << "Volume Fraction Matching in Unit Cube" << std::endl;
+      timeMatchUnitCubeVolumeFraction(matching_file, number_of_trials);
+
+      std::cout << "Volume Fraction Matching in Triangulated Triangular Prism" << std::endl;
+      timeMatchTriPrismVolumeFraction(matching_file, number_of_trials);
+
+      std::cout << "Volume Fraction Matching in Triangulated Hexahedron" << std::endl;
+      timeMatchTriHexVolumeFraction(matching_file, number_of_trials);
+
+      std::cout << "Volume Fraction Matching in Symmetric Triangular Prism" << std::endl;
+      timeMatchSymPrismVolumeFraction(matching_file, number_of_trials);
+
+      std::cout << "Volume Fraction Matching in Symmetric Hexahedron" << std::endl;
+      timeMatchSymHexVolumeFraction(matching_file, number_of_trials);
+
+      std::cout << "Volume Fraction Matching in Stellated Dodecahedron" << std::endl;
+      timeMatchStelDodecahedronVolumeFraction(matching_file, number_of_trials);
+
+      std::cout << "Volume Fraction Matching in Stellated Icosahedron" << std::endl;
+      timeMatchStelIcosahedronVolumeFraction(matching_file, number_of_trials);
+
+      fclose(matching_file);
+      break;
+    }
+
+    // Sweep [1:max_planes] planes, doubling, with number_of_trials random
+    // normals through each polyhedron, finding the volume below each plane
+    // with IRL and with a VolumeProfile built once per normal.
+    // Results are exported to plane_sweep_timing.txt.
+    case 16: {
+      FILE* sweep_file = fopen("plane_sweep_timing.txt", "w");
+      fprintf(sweep_file, "%d %d\n\n", number_of_trials, max_planes);
+
+      std::cout << "Sweep Planes through Triangular Prism" << std::endl;
+      timeSweepPrismByPlanes(sweep_file, number_of_trials, max_planes);
+
+      fprintf(sweep_file, "\n");
+
+      std::cout << "Sweep Planes through Unit Cube" << std::endl;
+      timeSweepUnitCubeByPlanes(sweep_file, number_of_trials, max_planes);
+
+      fprintf(sweep_file, "\n");
+
+      std::cout << "Sweep Planes through Triangulated Triangular Prism"
+                << std::endl;
+      timeSweepTriPrismByPlanes(sweep_file, number_of_trials, max_planes);
+
+      fprintf(sweep_file, "\n");
+
+      std::cout << "Sweep Planes through Triangulated Hexahedron" << std::endl;
+      timeSweepTriHexByPlanes(sweep_file, number_of_trials, max_planes);
+
+      fprintf(sweep_file, "\n");
+
+      std::cout << "Sweep Planes through Symmetric Triangular Prism"
+                << std::endl;
+      timeSweepSymPrismByPlanes(sweep_file, number_of_trials, max_planes);
+
+      fprintf(sweep_file, "\n");
+
+      std::cout << "Sweep Planes through Symmetric Hexahedron" << std::endl;
+      timeSweepSymHexByPlanes(sweep_file, number_of_trials, max_planes);
+
+      fprintf(sweep_file, "\n");
+
+      std::cout << "Sweep Planes through Stellated Dodecahedron" << std::endl;
+      timeSweepStelDodecahedronByPlanes(sweep_file, number_of_trials,
+                                        max_planes);
+
+      fprintf(sweep_file, "\n");
+
+      std::cout << "Sweep Planes through Stellated Icosahedron" << std::endl;
+      timeSweepStelIcosahedronByPlanes(sweep_file, number_of_trials,
+                                       max_planes);
+
+      fclose(sweep_file);
+      break;
+    }
+
     default: {
       std::cout << "Unknown case switch (first CLI argument) of " << case_number
                 << std::endl;
@@ -381,3 +1004,121 @@ std::array<double, 96> getStelIcosahedronPts(void) {
   }
   return stel_icosahedron_pts;
 }
+
+// Builds the fixture holding a_pts, with the centroid and volume of
+// a_polyhedron, built from them.
+template <class PolyhedronType, std::size_t kLength>
+static ShapeFixture makeFixture(const std::array<double, kLength>& a_pts,
+                                const PolyhedronType& a_polyhedron) {
+  ShapeFixture fixture;
+  fixture.pts.assign(a_pts.begin(), a_pts.end());
+  fixture.centroid = a_polyhedron.calculateCentroid();
+  fixture.volume = a_polyhedron.calculateVolume();
+  return fixture;
+}
+
+ShapeFixture getPrismFixture(void) {
+  std::array<double, 18> prism_pts{{1.0, 0.0, -1.0, 1.0, 1.0, 0.0, 1.0, 0.0,
+                                    1.0, 0.0, 0.0, -1.0, 0.0, 1.0, 0.0, 0.0,
+                                    0.0, 1.0}};
+  return makeFixture(prism_pts, IRL::TriangularPrism::fromRawDoublePointer(
+                                    6, prism_pts.data()));
+}
+
+ShapeFixture getUnitCubeFixture(void) {
+  std::array<double, 6> cube_pts{{-0.5, -0.5, -0.5, 0.5, 0.5, 0.5}};
+  return makeFixture(cube_pts,
+                     IRL::RectangularCuboid::fromBoundingPts(
+                         IRL::Pt(cube_pts[0], cube_pts[1], cube_pts[2]),
+                         IRL::Pt(cube_pts[3], cube_pts[4], cube_pts[5])));
+}
+
+ShapeFixture getTriPrismFixture(void) {
+  // A Prism with each face triangulated, making it non-convex.
+  std::array<double, 18> tri_prism_pts{{1.0, 0.0, -1.0, 1.0, 1.0, 0.0, 1.0,
+                                        -0.5, 1.0, 0.0, -0.5, -1.0, 0.0, 1.0,
+                                        0.0, 0.0, 0.0, 1.0}};
+  return makeFixture(tri_prism_pts, IRL::Octahedron::fromRawDoublePointer(
+                                        6, tri_prism_pts.data()));
+}
+
+ShapeFixture getTriHexFixture(void) {
+  // A Hexahedron with each face triangulated, making it non-convex.
+  std::array<double, 24> tri_hex_pts{{
+      0.5,  -0.5,  -0.5, 0.5,  0.5,  -0.5, 0.5,  0.25, 0.5, 0.5,  -0.25, 0.5,
+      -0.5, -0.25, -0.5, -0.5, 0.25, -0.5, -0.5, 0.5,  0.5, -0.5, -0.5,  0.5,
+  }};
+  return makeFixture(tri_hex_pts, IRL::Dodecahedron::fromRawDoublePointer(
+                                      8, tri_hex_pts.data()));
+}
+
+ShapeFixture getSymPrismFixture(void) {
+  // A Prism with each face triangulated to a face-internal point
+  // Indentation of face points make this case non-convex.
+  static constexpr double one_over_sqrt2 = 1.0 / std::sqrt(2.0);
+  static constexpr double indent = 0.3;
+  std::array<double, 33> sym_prism_pts{
+      {1.0,
+       0.0,
+       -1.0,
+       1.0,
+       1.0,
+       0.0,
+       1.0,
+       0.0,
+       1.0,
+       0.0,
+       0.0,
+       -1.0,
+       0.0,
+       1.0,
+       0.0,
+       0.0,
+       0.0,
+       1.0,
+       1.0 - indent,
+       1.0 / 3.0,
+       0.0,
+       0.5,
+       0.5 - indent * one_over_sqrt2,
+       -0.5 + indent * one_over_sqrt2,
+       0.5,
+       0.5 - indent * one_over_sqrt2,
+       0.5 - indent * one_over_sqrt2,
+       0.5,
+       indent,
+       0.0,
+       indent,
+       1.0 / 3.0,
+       0.0}};
+  return makeFixture(sym_prism_pts,
+                     IRL::SymmetricTriangularPrism::fromRawDoublePointer(
+                         11, sym_prism_pts.data()));
+}
+
+ShapeFixture getSymHexFixture(void) {
+  // A Hexahedron with each face triangulated to a face-internal point
+  // Indentation of face points make this case non-convex.
+  std::array<double, 42> sym_hex_pts{
+      {0.5,  -0.5, -0.5, 0.5,  0.5,  -0.5, 0.5,  0.5,  0.5, 0.5, -0.5,
+       0.5,  -0.5, -0.5, -0.5, -0.5, 0.5,  -0.5, -0.5, 0.5, 0.5, -0.5,
+       -0.5, 0.5,  0.2,  0.0,  0.0,  0.0,  0.0,  -0.2, 0.0, 0.2, 0.0,
+       0.0,  0.0,  0.2,  0.0,  -0.2, 0.0,  -0.2, 0.0,  0.0}};
+  return makeFixture(sym_hex_pts,
+                     IRL::SymmetricHexahedron::fromRawDoublePointer(
+                         14, sym_hex_pts.data()));
+}
+
+ShapeFixture getStelDodecahedronFixture(void) {
+  const auto stel_dodecahedron_pts = getStelDodecahedronPts();
+  return makeFixture(stel_dodecahedron_pts,
+                     IRL::StellatedDodecahedron::fromRawDoublePointer(
+                         32, stel_dodecahedron_pts.data()));
+}
+
+ShapeFixture getStelIcosahedronFixture(void) {
+  const auto stel_icosahedron_pts = getStelIcosahedronPts();
+  return makeFixture(stel_icosahedron_pts,
+                     IRL::StellatedIcosahedron::fromRawDoublePointer(
+                         32, stel_icosahedron_pts.data()));
+}
@@ -51,4 +51,38 @@ std::array<double, 96> getStelDodecahedronPts(void);
 // to be constructed by each package.
 std::array<double, 96> getStelIcosahedronPts(void);
 
+// Points of one of the polyhedra of case 1 as passed to every package,
+// ordered Pt 1 X/Y/Z, Pt 2 X/Y/Z, ..., along with its centroid and volume
+// from IRL. The Unit Cube is passed as its lower and upper bounding box
+// points, which are also its points farthest from the centroid.
+struct ShapeFixture {
+  std::vector<double> pts;
+  IRL::Pt centroid;
+  double volume;
+};
+
+// Returns the Triangular Prism
+ShapeFixture getPrismFixture(void);
+
+// Returns the Unit Cube
+ShapeFixture getUnitCubeFixture(void);
+
+// Returns the Triangulated Triangular Prism, which is non-convex
+ShapeFixture getTriPrismFixture(void);
+
+// Returns the Triangulated Hexahedron, which is non-convex
+ShapeFixture getTriHexFixture(void);
+
+// Returns the Symmetric Triangular Prism, which is non-convex
+ShapeFixture getSymPrismFixture(void);
+
+// Returns the Symmetric Hexahedron, which is non-convex
+ShapeFixture getSymHexFixture(void);
+
+// Returns the Stellated Dodecahedron of getStelDodecahedronPts
+ShapeFixture getStelDodecahedronFixture(void);
+
+// Returns the Stellated Icosahedron of getStelIcosahedronPts
+ShapeFixture getStelIcosahedronFixture(void);
+
 #endif  // SRC_TIMING_COMP_TIMING_COMP_H_
@@ -0,0 +1,198 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/two_phase_timing.h"
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "src/timing_comp/files.h"
+#include "src/timing_comp/flux_volume_timing.h"
+#include "src/timing_comp/tet_mesh_timing.h"
+#include "src/timing_comp/times.h"
+
+// IRL GVM Timing includes
+#include "src/irl_gvm/compact_mesh.h"
+#include "src/irl_gvm/irl_gvm_distribution.h"
+#include "src/irl_gvm/localized_separator_mesh.h"
+#include "src/irl_gvm/localizer_mesh.h"
+
+// IRL source directory
+#include "src/geometry/general/normal.h"
+#include "src/geometry/general/plane.h"
+#include "src/geometry/polyhedrons/symmetric_hexahedron.h"
+#include "src/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+// Radius of the spherical interface, centered on the origin
+constexpr double kInterfaceRadius = 0.3;
+
+// Reconstruction of the sphere in each cell of a_compact_mesh: the plane
+// tangent to the sphere where it is closest to the center of the cell
+// bounding box, with liquid inside the sphere (below the plane)
+std::vector<IRL::PlanarSeparator> getSphereReconstructions(
+    const CompactMesh& a_compact_mesh) {
+  std::vector<IRL::PlanarSeparator> separators(
+      a_compact_mesh.getNumberOfCells());
+  for (int c = 0; c < a_compact_mesh.getNumberOfCells(); ++c) {
+    const auto box = a_compact_mesh.getCellBoundingBox(c);
+    const IRL::Pt center = 0.5 * (box[0] + box[1]);
+    const double radius = std::sqrt(center[0] * center[0] +
+                                    center[1] * center[1] +
+                                    center[2] * center[2]);
+    const IRL::Normal normal =
+        radius > DBL_EPSILON
+            ? IRL::Normal(center[0] / radius, center[1] / radius,
+                          center[2] / radius)
+            : IRL::Normal(0.0, 0.0, 1.0);
+    separators[c] = IRL::PlanarSeparator::fromOnePlane(
+        IRL::Plane(normal, kInterfaceRadius));
+  }
+  return separators;
+}
+
+// Distributes the a_number_of_faces flux volumes in a_flux_pts, stored
+// as in irl_gvm_symHexFluxVolumesOntoMesh, one at a time onto both a_mesh
+// and a_separated_mesh, which share their cells. Writes the average cells
+// entered, the time per flux volume on the single-phase and two-phase
+// meshes and their ratio, the fraction of the distributed volume
+// magnitude inside the interface, the mean and max difference between the
+// two phases summed and the single-phase volume of a flux volume, the
+// largest such difference in any one cell over all flux volumes, and the
+// mean and max difference between the two phases summed and the volume of
+// the flux volume itself. Flux volumes swept against the face normal are
+// negative, so differences are relative to a_cell_volume.
+void distributeTwoPhase(FILE* a_two_phase_file,
+                        const std::vector<double>& a_flux_pts,
+                        const int a_number_of_faces,
+                        const LocalizerMesh& a_mesh,
+                        const LocalizedSeparatorMesh& a_separated_mesh,
+                        const double a_cell_volume) {
+  const int number_of_cells = a_mesh.getNumberOfCells();
+  std::vector<double> single_phase_cells(number_of_cells, 0.0);
+  std::vector<double> two_phase_cells(2 * number_of_cells, 0.0);
+  // Single-phase and two-phase distribution
+  Times<2> irl_gvm_times;
+  std::size_t cells_entered = 0;
+  double inside_volume = 0.0;
+  double distributed_volume = 0.0;
+  double phase_error = 0.0;
+  double max_phase_error = -DBL_MAX;
+  double volume_error = 0.0;
+  double max_volume_error = -DBL_MAX;
+  for (int f = 0; f < a_number_of_faces; ++f) {
+    const double* pts = a_flux_pts.data() + 42 * f;
+
+    Times<2> face_times;
+    std::size_t face_cells_entered;
+    double single_phase_volume;
+    irl_gvm_symHexOntoMeshCells(pts, a_mesh, single_phase_cells.data(),
+                                &single_phase_volume, face_times.data(),
+                                &face_cells_entered);
+    std::array<double, 2> phase_volumes;
+    irl_gvm_symHexOntoSeparatedMeshCells(
+        pts, a_separated_mesh, two_phase_cells.data(), phase_volumes.data(),
+        face_times.data() + 1, &face_cells_entered);
+
+    const double flux_volume =
+        IRL::SymmetricHexahedron::fromRawDoublePointer(14, pts)
+            .calculateVolume();
+    const double two_phase_volume = phase_volumes[0] + phase_volumes[1];
+    const double error =
+        std::fabs(two_phase_volume - single_phase_volume) / a_cell_volume;
+    phase_error += error;
+    max_phase_error = std::max(max_phase_error, error);
+    const double conservation_error =
+        std::fabs(two_phase_volume - flux_volume) / a_cell_volume;
+    volume_error += conservation_error;
+    max_volume_error = std::max(max_volume_error, conservation_error);
+    inside_volume += std::fabs(phase_volumes[0]);
+    distributed_volume +=
+        std::fabs(phase_volumes[0]) + std::fabs(phase_volumes[1]);
+    irl_gvm_times += face_times;
+    cells_entered += face_cells_entered;
+  }
+
+  double max_cell_error = 0.0;
+  for (int c = 0; c < number_of_cells; ++c) {
+    max_cell_error = std::max(
+        max_cell_error, std::fabs(two_phase_cells[2 * c] +
+                                  two_phase_cells[2 * c + 1] -
+                                  single_phase_cells[c]) /
+                            a_cell_volume);
+  }
+
+  const double faces = static_cast<double>(a_number_of_faces);
+  // Write out time in seconds
+  fprintf(a_two_phase_file,
+          "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+          "%19.13e %19.13e\n",
+          static_cast<double>(cells_entered) / faces,
+          irl_gvm_times[0] / faces, irl_gvm_times[1] / faces,
+          irl_gvm_times[1] / irl_gvm_times[0],
+          inside_volume / distributed_volume, phase_error / faces,
+          max_phase_error, max_cell_error, volume_error / faces,
+          max_volume_error);
+  fflush(a_two_phase_file);
+}
+
+// Distributes the flux volumes onto a_compact_mesh with and without the
+// sphere reconstruction, after writing the number of cells and the setup
+// time and memory of both meshes.
+void distributeTwoPhaseOntoMesh(FILE* a_two_phase_file,
+                                const std::vector<double>& a_flux_pts,
+                                const int a_number_of_faces,
+                                const CompactMesh& a_compact_mesh,
+                                const double a_cell_volume) {
+  const auto mesh = LocalizerMesh::fromCompact(a_compact_mesh);
+  const auto separated_mesh = LocalizedSeparatorMesh::fromLocalizerMesh(
+      mesh, getSphereReconstructions(a_compact_mesh));
+  // Write out time in seconds and memory in bytes
+  fprintf(a_two_phase_file, "%19.13e %19.13e %19.13e %19.13e %19.13e\n",
+          static_cast<double>(mesh.getNumberOfCells()), mesh.getSetupTime(),
+          static_cast<double>(mesh.getMemoryFootprint()),
+          separated_mesh.getSetupTime(),
+          static_cast<double>(separated_mesh.getMemoryFootprint()));
+
+  distributeTwoPhase(a_two_phase_file, a_flux_pts, a_number_of_faces, mesh,
+                     separated_mesh, a_cell_volume);
+}
+
+}  // namespace
+
+void distributeTwoPhaseOntoMeshes(FILE* a_two_phase_file, const int a_ncells,
+                                  const double a_cfl) {
+  const double dx = 1.0 / static_cast<double>(a_ncells);
+  const double cell_volume = dx * dx * dx;
+  std::vector<double> flux_pts;
+  const int number_of_faces = makeSymHexFluxVolumes(a_ncells, a_cfl, &flux_pts);
+  fprintf(a_two_phase_file, "%d\n", number_of_faces);
+
+  std::cout << "Two-Phase Flux Volume Distribution onto Cartesian Mesh"
+            << std::endl;
+  const auto cubic_mesh = CompactMesh::fromCubic(
+      {{IRL::Pt(-0.5, -0.5, -0.5), IRL::Pt(0.5, 0.5, 0.5)}},
+      {{a_ncells, a_ncells, a_ncells}});
+  distributeTwoPhaseOntoMesh(a_two_phase_file, flux_pts, number_of_faces,
+                             cubic_mesh, cell_volume);
+
+  fprintf(a_two_phase_file, "\n");
+
+  std::cout << "Two-Phase Flux Volume Distribution onto Tet Mesh"
+            << std::endl;
+  std::vector<double> nodes;
+  std::vector<int> tets;
+  makeShuffledKuhnMesh(a_ncells, &nodes, &tets);
+  const auto tet_mesh = CompactMesh::fromTets(nodes, tets);
+  distributeTwoPhaseOntoMesh(a_two_phase_file, flux_pts, number_of_faces,
+                             tet_mesh, cell_volume);
+}
@@ -0,0 +1,23 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_TWO_PHASE_TIMING_H_
+#define SRC_TIMING_COMP_TWO_PHASE_TIMING_H_
+
+#include "src/timing_comp/files.h"
+
+// Builds the semi-Lagrangian flux volumes of every interior face of a
+// Cartesian Mesh of [-0.5,0.5]^3 with a_ncells^3 cells for CFL number
+// a_cfl, as timeSymHexFluxVolumes, and distributes them onto that mesh
+// and onto the tet mesh made by splitting each of its cells into 6 tets.
+// Every cell carries a planar reconstruction of a sphere, and each flux
+// volume is distributed both onto the plain LocalizerLink mesh and onto
+// the LocalizedSeparatorLink mesh, which returns the volume on each side
+// of the interface.
+void distributeTwoPhaseOntoMeshes(FILE* a_two_phase_file, const int a_ncells,
+                                  const double a_cfl);
+
+#endif  // SRC_TIMING_COMP_TWO_PHASE_TIMING_H_
@@ -0,0 +1,169 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/voftools_batch_timing.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "src/timing_comp/times.h"
+#include "src/timing_comp/timing_comp.h"
+
+// VOFTools Timing includes
+extern "C" {
+#include "src/voftools/voftools_batch_intersection.h"
+#include "src/voftools/voftools_intersection.h"
+}
+
+namespace {
+
+using ClipFunction = void (*)(const double*, const int, const double*,
+                              double*, double*);
+using BatchClipFunction = void (*)(const double*, const int, const int,
+                                   const int, const double*, double*,
+                                   double*);
+
+// Intersects the polyhedron by the same random planes through the
+// per-call VOFTools functions, one trial at a time, and through the
+// batched Fortran driver. For each number of planes, writes the
+// summed initialization/intersection/volume times and the wall time of
+// all trials, first for the per-call functions and then for the batch,
+// followed by the max difference in volume between the two, scaled by
+// the unclipped volume of a_shape. Exits if the batch does not
+// reproduce the per-call volume of any trial.
+void timeVoftoolsBatch(FILE* a_voftools_batch_file, const ShapeFixture& a_shape,
+                       const int a_number_of_trials, const int a_max_planes,
+                       ClipFunction a_per_call_function,
+                       BatchClipFunction a_batch_function) {
+  const double* pts = a_shape.pts.data();
+  const double scale = a_shape.volume;
+  std::vector<double> plane_set(a_number_of_trials * a_max_planes * 4);
+  std::vector<double> per_call_volumes(a_number_of_trials);
+  std::vector<double> batch_volumes(a_number_of_trials);
+  setRandomPlanes(&plane_set, a_number_of_trials * a_max_planes,
+                  a_shape.centroid);
+
+  for (int p = 1; p <= a_max_planes; ++p) {
+    Times<4> per_call_times;
+    const double start = omp_get_wtime();
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      Times<3> trial_time;
+      a_per_call_function(pts, p, &plane_set[n * a_max_planes * 4],
+                          &per_call_volumes[n], trial_time.data());
+      for (std::size_t s = 0; s < 3; ++s) {
+        per_call_times[s] += trial_time[s];
+      }
+    }
+    per_call_times[3] = omp_get_wtime() - start;
+
+    Times<4> batch_times;
+    a_batch_function(pts, a_number_of_trials, p, a_max_planes,
+                     plane_set.data(), batch_volumes.data(),
+                     batch_times.data());
+
+    double max_error = 0.0;
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      if (!sameVolumesFound(per_call_volumes[n], batch_volumes[n])) {
+        printf("Batch differs from serial result for %d planes in trial %d\n",
+               p, n);
+        for (int rp = 0; rp < p; ++rp) {
+          const double* plane = &plane_set[(n * a_max_planes + rp) * 4];
+          printf("Normal : (%20.15e %20.15e %20.15e) Distance : %20.15e\n",
+                 plane[0], plane[1], plane[2], plane[3]);
+        }
+        std::exit(-1);
+      }
+      max_error = std::max(
+          max_error,
+          std::fabs(batch_volumes[n] - per_call_volumes[n]) / scale);
+    }
+
+    fprintf(a_voftools_batch_file,
+            "%19.13e %19.13e %19.13e %19.13e %19.13e %19.13e %19.13e "
+            "%19.13e %19.13e %19.13e\n",
+            static_cast<double>(p), per_call_times[0], per_call_times[1],
+            per_call_times[2], per_call_times[3], batch_times[0],
+            batch_times[1], batch_times[2], batch_times[3], max_error);
+  }
+}
+
+}  // namespace
+
+void timeVoftoolsBatchPrismByPlanes(FILE* a_voftools_batch_file,
+                                    const int a_number_of_trials,
+                                    const int a_max_planes) {
+  timeVoftoolsBatch(a_voftools_batch_file, getPrismFixture(),
+                    a_number_of_trials, a_max_planes, c_voftools_prismByPlanes,
+                    c_voftools_batch_prismByPlanes);
+}
+
+void timeVoftoolsBatchUnitCubeByPlanes(FILE* a_voftools_batch_file,
+                                       const int a_number_of_trials,
+                                       const int a_max_planes) {
+  timeVoftoolsBatch(a_voftools_batch_file, getUnitCubeFixture(),
+                    a_number_of_trials, a_max_planes,
+                    c_voftools_unitCubeByPlanes,
+                    c_voftools_batch_unitCubeByPlanes);
+}
+
+void timeVoftoolsBatchTriPrismByPlanes(FILE* a_voftools_batch_file,
+                                       const int a_number_of_trials,
+                                       const int a_max_planes) {
+  timeVoftoolsBatch(a_voftools_batch_file, getTriPrismFixture(),
+                    a_number_of_trials, a_max_planes,
+                    c_voftools_triPrismByPlanes,
+                    c_voftools_batch_triPrismByPlanes);
+}
+
+void timeVoftoolsBatchTriHexByPlanes(FILE* a_voftools_batch_file,
+                                     const int a_number_of_trials,
+                                     const int a_max_planes) {
+  timeVoftoolsBatch(a_voftools_batch_file, getTriHexFixture(),
+                    a_number_of_trials, a_max_planes, c_voftools_triHexByPlanes,
+                    c_voftools_batch_triHexByPlanes);
+}
+
+void timeVoftoolsBatchSymPrismByPlanes(FILE* a_voftools_batch_file,
+                                       const int a_number_of_trials,
+                                       const int a_max_planes) {
+  timeVoftoolsBatch(a_voftools_batch_file, getSymPrismFixture(),
+                    a_number_of_trials, a_max_planes,
+                    c_voftools_symPrismByPlanes,
+                    c_voftools_batch_symPrismByPlanes);
+}
+
+void timeVoftoolsBatchSymHexByPlanes(FILE* a_voftools_batch_file,
+                                     const int a_number_of_trials,
+                                     const int a_max_planes) {
+  timeVoftoolsBatch(a_voftools_batch_file, getSymHexFixture(),
+                    a_number_of_trials, a_max_planes, c_voftools_symHexByPlanes,
+                    c_voftools_batch_symHexByPlanes);
+}
+
+void timeVoftoolsBatchStelDodecahedronByPlanes(FILE* a_voftools_batch_file,
+                                               const int a_number_of_trials,
+                                               const int a_max_planes) {
+  timeVoftoolsBatch(a_voftools_batch_file, getStelDodecahedronFixture(),
+                    a_number_of_trials, a_max_planes,
+                    c_voftools_stelDodecahedronByPlanes,
+                    c_voftools_batch_stelDodecahedronByPlanes);
+}
+
+void timeVoftoolsBatchStelIcosahedronByPlanes(FILE* a_voftools_batch_file,
+                                              const int a_number_of_trials,
+                                              const int a_max_planes) {
+  timeVoftoolsBatch(a_voftools_batch_file, getStelIcosahedronFixture(),
+                    a_number_of_trials, a_max_planes,
+                    c_voftools_stelIcosahedronByPlanes,
+                    c_voftools_batch_stelIcosahedronByPlanes);
+}
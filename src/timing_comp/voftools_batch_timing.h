@@ -0,0 +1,54 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_VOFTOOLS_BATCH_TIMING_H_
+#define SRC_TIMING_COMP_VOFTOOLS_BATCH_TIMING_H_
+
+#include <cstdio>
+
+// Time per-call and batched VOFTools intersection of Triangular Prism
+void timeVoftoolsBatchPrismByPlanes(FILE* a_voftools_batch_file,
+                                    const int a_number_of_trials,
+                                    const int a_max_planes);
+
+// Time per-call and batched VOFTools intersection of Unit Cube
+void timeVoftoolsBatchUnitCubeByPlanes(FILE* a_voftools_batch_file,
+                                       const int a_number_of_trials,
+                                       const int a_max_planes);
+
+// Time per-call and batched VOFTools intersection of Triangulated Triangular
+// Prism
+void timeVoftoolsBatchTriPrismByPlanes(FILE* a_voftools_batch_file,
+                                       const int a_number_of_trials,
+                                       const int a_max_planes);
+
+// Time per-call and batched VOFTools intersection of Triangulated Hexahedron
+void timeVoftoolsBatchTriHexByPlanes(FILE* a_voftools_batch_file,
+                                     const int a_number_of_trials,
+                                     const int a_max_planes);
+
+// Time per-call and batched VOFTools intersection of Symmetric Triangular
+// Prism
+void timeVoftoolsBatchSymPrismByPlanes(FILE* a_voftools_batch_file,
+                                       const int a_number_of_trials,
+                                       const int a_max_planes);
+
+// Time per-call and batched VOFTools intersection of Symmetric Hexahedron
+void timeVoftoolsBatchSymHexByPlanes(FILE* a_voftools_batch_file,
+                                     const int a_number_of_trials,
+                                     const int a_max_planes);
+
+// Time per-call and batched VOFTools intersection of Stellated Dodecahedron
+void timeVoftoolsBatchStelDodecahedronByPlanes(FILE* a_voftools_batch_file,
+                                               const int a_number_of_trials,
+                                               const int a_max_planes);
+
+// Time per-call and batched VOFTools intersection of Stellated Icosahedron
+void timeVoftoolsBatchStelIcosahedronByPlanes(FILE* a_voftools_batch_file,
+                                              const int a_number_of_trials,
+                                              const int a_max_planes);
+
+#endif  // SRC_TIMING_COMP_VOFTOOLS_BATCH_TIMING_H_
@@ -0,0 +1,209 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/timing_comp/volume_fraction_timing.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "src/timing_comp/times.h"
+#include "src/timing_comp/timing_comp.h"
+
+// IRL Includes
+#include "src/geometry/general/normal.h"
+
+// IRL GVM Timing includes
+#include "src/irl_gvm/irl_gvm_intersection.h"
+
+// VOFTools Timing includes
+extern "C" {
+#include "src/voftools/voftools_prototype_intersection.h"
+}
+
+// Volume profile includes
+#include "src/volume_profile/volume_profile_intersection.h"
+
+namespace {
+
+using MatchFunction = void (*)(const double*, const double*, const double,
+                               double*, double*, double*);
+using CutFunction = void (*)(const double*, const double*, const int,
+                             const double*, double*, double*);
+
+// IRL, VOFTools, and the VolumeProfile, in that order
+constexpr std::size_t kNumberOfBackends = 3;
+
+// Largest difference allowed between the volume fraction achieved and the
+// target
+constexpr double kVolumeFractionTolerance = 1.0e-10;
+
+// Largest difference allowed between the distance found by a backend and
+// by IRL, relative to the cube root of the polyhedron volume. The distance
+// is less well conditioned than the volume fraction where the plane only
+// grazes the polyhedron, so this is looser.
+constexpr double kDistanceTolerance = 1.0e-8;
+
+// Finds the plane distance matching a_number_of_trials random target
+// volume fractions, each with a random normal, with every backend. The
+// volume fraction achieved by each backend is found by cutting the
+// polyhedron with IRL through a_irl_cut, so no backend checks itself. For
+// each backend, writes the time per search, the search time over the
+// time of a single cut by the plane found (the equivalent number of cuts
+// in a search), and the mean and max difference between the volume
+// fraction achieved and the target. The line ends with the max difference
+// between the distances found by each other backend and by IRL, scaled by
+// the cube root of the polyhedron volume. Exits if a volume fraction or
+// distance differs by more than kVolumeFractionTolerance or
+// kDistanceTolerance.
+void timeMatch(FILE* a_matching_file, const ShapeFixture& a_shape,
+               const int a_number_of_trials,
+               const std::array<MatchFunction, kNumberOfBackends>& a_match,
+               CutFunction a_irl_cut) {
+  const double* pts = a_shape.pts.data();
+  std::vector<double> normals(3 * a_number_of_trials);
+  std::vector<double> volume_fractions(a_number_of_trials);
+  for (int n = 0; n < a_number_of_trials; ++n) {
+    const IRL::Normal normal = randomNormal();
+    for (int d = 0; d < 3; ++d) {
+      normals[3 * n + d] = normal[d];
+    }
+    volume_fractions[n] = 0.5 * (randomDouble() + 1.0);
+  }
+
+  std::vector<double> irl_distances(a_number_of_trials);
+  const double length = std::cbrt(a_shape.volume);
+  std::array<double, kNumberOfBackends> max_distance_differences{};
+  for (std::size_t b = 0; b < kNumberOfBackends; ++b) {
+    // Search then cut time
+    Times<2> times;
+    double volume_fraction_error = 0.0;
+    double max_volume_fraction_error = 0.0;
+    for (int n = 0; n < a_number_of_trials; ++n) {
+      Times<2> trial_times;
+      double distance;
+      double achieved_volume_fraction;
+      a_match[b](pts, &normals[3 * n], volume_fractions[n], &distance,
+                 &achieved_volume_fraction, trial_times.data());
+      times += trial_times;
+
+      Times<2> cut_times;
+      double volume;
+      a_irl_cut(pts, &normals[3 * n], 1, &distance, &volume,
+                cut_times.data());
+      const double error =
+          std::fabs(volume / a_shape.volume - volume_fractions[n]);
+      volume_fraction_error += error;
+      max_volume_fraction_error = std::max(max_volume_fraction_error, error);
+      double distance_difference = 0.0;
+      if (b == 0) {
+        irl_distances[n] = distance;
+      } else {
+        distance_difference = std::fabs(distance - irl_distances[n]) / length;
+        max_distance_differences[b] =
+            std::max(max_distance_differences[b], distance_difference);
+      }
+      if (error > kVolumeFractionTolerance ||
+          distance_difference > kDistanceTolerance) {
+        printf("Backend %d missed volume fraction %20.15e in trial %d\n",
+               static_cast<int>(b), volume_fractions[n], n);
+        printf("Normal : (%20.15e %20.15e %20.15e) Distance : %20.15e\n",
+               normals[3 * n], normals[3 * n + 1], normals[3 * n + 2],
+               distance);
+        printf("Volume fraction error %20.15e, distance difference %20.15e\n",
+               error, distance_difference);
+        std::exit(-1);
+      }
+    }
+    const double trials = static_cast<double>(a_number_of_trials);
+    fprintf(a_matching_file, "%19.13e %19.13e %19.13e %19.13e ",
+            times[0] / trials, times[0] / times[1],
+            volume_fraction_error / trials, max_volume_fraction_error);
+  }
+  for (std::size_t b = 1; b < kNumberOfBackends; ++b) {
+    fprintf(a_matching_file,
+            b + 1 < kNumberOfBackends ? "%19.13e " : "%19.13e\n",
+            max_distance_differences[b]);
+  }
+}
+
+}  // namespace
+
+void timeMatchPrismVolumeFraction(FILE* a_matching_file,
+                                  const int a_number_of_trials) {
+  timeMatch(a_matching_file, getPrismFixture(), a_number_of_trials,
+            {{irl_gvm_prismMatchVolumeFraction,
+              c_voftools_prototype_prismMatchVolumeFraction,
+              volume_profile_prismMatchVolumeFraction}},
+            irl_gvm_prismBySweep);
+}
+
+void timeMatchUnitCubeVolumeFraction(FILE* a_matching_file,
+                                     const int a_number_of_trials) {
+  timeMatch(a_matching_file, getUnitCubeFixture(), a_number_of_trials,
+            {{irl_gvm_unitCubeMatchVolumeFraction,
+              c_voftools_prototype_unitCubeMatchVolumeFraction,
+              volume_profile_unitCubeMatchVolumeFraction}},
+            irl_gvm_unitCubeBySweep);
+}
+
+void timeMatchTriPrismVolumeFraction(FILE* a_matching_file,
+                                     const int a_number_of_trials) {
+  timeMatch(a_matching_file, getTriPrismFixture(), a_number_of_trials,
+            {{irl_gvm_triPrismMatchVolumeFraction,
+              c_voftools_prototype_triPrismMatchVolumeFraction,
+              volume_profile_triPrismMatchVolumeFraction}},
+            irl_gvm_triPrismBySweep);
+}
+
+void timeMatchTriHexVolumeFraction(FILE* a_matching_file,
+                                   const int a_number_of_trials) {
+  timeMatch(a_matching_file, getTriHexFixture(), a_number_of_trials,
+            {{irl_gvm_triHexMatchVolumeFraction,
+              c_voftools_prototype_triHexMatchVolumeFraction,
+              volume_profile_triHexMatchVolumeFraction}},
+            irl_gvm_triHexBySweep);
+}
+
+void timeMatchSymPrismVolumeFraction(FILE* a_matching_file,
+                                     const int a_number_of_trials) {
+  timeMatch(a_matching_file, getSymPrismFixture(), a_number_of_trials,
+            {{irl_gvm_symPrismMatchVolumeFraction,
+              c_voftools_prototype_symPrismMatchVolumeFraction,
+              volume_profile_symPrismMatchVolumeFraction}},
+            irl_gvm_symPrismBySweep);
+}
+
+void timeMatchSymHexVolumeFraction(FILE* a_matching_file,
+                                   const int a_number_of_trials) {
+  timeMatch(a_matching_file, getSymHexFixture(), a_number_of_trials,
+            {{irl_gvm_symHexMatchVolumeFraction,
+              c_voftools_prototype_symHexMatchVolumeFraction,
+              volume_profile_symHexMatchVolumeFraction}},
+            irl_gvm_symHexBySweep);
+}
+
+void timeMatchStelDodecahedronVolumeFraction(FILE* a_matching_file,
+                                             const int a_number_of_trials) {
+  timeMatch(a_matching_file, getStelDodecahedronFixture(), a_number_of_trials,
+            {{irl_gvm_stelDodecahedronMatchVolumeFraction,
+              c_voftools_prototype_stelDodecahedronMatchVolumeFraction,
+              volume_profile_stelDodecahedronMatchVolumeFraction}},
+            irl_gvm_stelDodecahedronBySweep);
+}
+
+void timeMatchStelIcosahedronVolumeFraction(FILE* a_matching_file,
+                                            const int a_number_of_trials) {
+  timeMatch(a_matching_file, getStelIcosahedronFixture(), a_number_of_trials,
+            {{irl_gvm_stelIcosahedronMatchVolumeFraction,
+              c_voftools_prototype_stelIcosahedronMatchVolumeFraction,
+              volume_profile_stelIcosahedronMatchVolumeFraction}},
+            irl_gvm_stelIcosahedronBySweep);
+}
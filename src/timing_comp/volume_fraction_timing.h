@@ -0,0 +1,44 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_TIMING_COMP_VOLUME_FRACTION_TIMING_H_
+#define SRC_TIMING_COMP_VOLUME_FRACTION_TIMING_H_
+
+#include <cstdio>
+
+// Time volume fraction matching in Triangular Prism
+void timeMatchPrismVolumeFraction(FILE* a_matching_file,
+                                  const int a_number_of_trials);
+
+// Time volume fraction matching in Unit Cube
+void timeMatchUnitCubeVolumeFraction(FILE* a_matching_file,
+                                     const int a_number_of_trials);
+
+// Time volume fraction matching in Triangulated Triangular Prism
+void timeMatchTriPrismVolumeFraction(FILE* a_matching_file,
+                                     const int a_number_of_trials);
+
+// Time volume fraction matching in Triangulated Hexahedron
+void timeMatchTriHexVolumeFraction(FILE* a_matching_file,
+                                   const int a_number_of_trials);
+
+// Time volume fraction matching in Symmetric Triangular Prism
+void timeMatchSymPrismVolumeFraction(FILE* a_matching_file,
+                                     const int a_number_of_trials);
+
+// Time volume fraction matching in Symmetric Hexahedron
+void timeMatchSymHexVolumeFraction(FILE* a_matching_file,
+                                   const int a_number_of_trials);
+
+// Time volume fraction matching in Stellated Dodecahedron
+void timeMatchStelDodecahedronVolumeFraction(FILE* a_matching_file,
+                                             const int a_number_of_trials);
+
+// Time volume fraction matching in Stellated Icosahedron
+void timeMatchStelIcosahedronVolumeFraction(FILE* a_matching_file,
+                                            const int a_number_of_trials);
+
+#endif  // SRC_TIMING_COMP_VOLUME_FRACTION_TIMING_H_
@@ -0,0 +1,27 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Cube vertices shared by the clippers that take the unit cube as a
+// general polyhedron (src/vertex_clip, src/tet_clip and
+// src/volume_profile) rather than as its lower/upper bounding points.
+
+#ifndef SRC_VERTEX_CLIP_CUBE_PTS_H_
+#define SRC_VERTEX_CLIP_CUBE_PTS_H_
+
+#include <array>
+
+// Expand lower/upper bounding points of a cube to its 8 vertices,
+// ordered as in VOFTools make_cuboid.
+inline std::array<double, 24> getCubePts(const double* a_cube_pts) {
+  return {{a_cube_pts[3], a_cube_pts[1], a_cube_pts[2], a_cube_pts[3],
+           a_cube_pts[4], a_cube_pts[2], a_cube_pts[3], a_cube_pts[4],
+           a_cube_pts[5], a_cube_pts[3], a_cube_pts[1], a_cube_pts[5],
+           a_cube_pts[0], a_cube_pts[1], a_cube_pts[2], a_cube_pts[0],
+           a_cube_pts[4], a_cube_pts[2], a_cube_pts[0], a_cube_pts[4],
+           a_cube_pts[5], a_cube_pts[0], a_cube_pts[1], a_cube_pts[5]}};
+}
+
+#endif  // SRC_VERTEX_CLIP_CUBE_PTS_H_
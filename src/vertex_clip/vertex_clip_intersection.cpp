@@ -0,0 +1,143 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/vertex_clip/vertex_clip_intersection.h"
+
+#include <omp.h>
+
+#include <array>
+#include <vector>
+
+#include "src/vertex_clip/cube_pts.h"
+#include "src/vertex_clip/vertex_clip_shapes.h"
+#include "src/vertex_clip/vertex_graph_polyhedron.h"
+
+namespace {
+
+template <class ScalarType, std::size_t kFaceFlat, std::size_t kFaces>
+void clipByPlanes(const double* a_pts, const int a_number_of_pts,
+                  const std::array<int, kFaceFlat>& a_faces,
+                  const std::array<int, kFaces>& a_face_sizes,
+                  const int a_number_of_planes, const double* a_planes,
+                  double* a_volume, double* a_times) {
+  std::vector<ScalarType> planes(a_number_of_planes * 4);
+  for (int n = 0; n < a_number_of_planes * 4; ++n) {
+    planes[n] = static_cast<ScalarType>(a_planes[n]);
+  }
+
+  double start = omp_get_wtime();
+  VertexGraphPolyhedron<ScalarType> poly;
+  poly.initialize(a_pts, a_number_of_pts, a_faces.data(), a_face_sizes.data(),
+                  static_cast<int>(kFaces));
+  poly.clip(planes.data(), a_number_of_planes);
+  const ScalarType volume = poly.calculateVolume();
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+  *a_volume = static_cast<double>(volume);
+}
+
+}  // namespace
+
+template <class ScalarType>
+void vertex_clip_prismByPlanes(const double* a_prism_pts,
+                               const int a_number_of_planes,
+                               const double* a_planes, double* a_volume,
+                               double* a_times) {
+  clipByPlanes<ScalarType>(a_prism_pts, 6, prism_faces, prism_face_sizes,
+                           a_number_of_planes, a_planes, a_volume, a_times);
+}
+
+template <class ScalarType>
+void vertex_clip_unitCubeByPlanes(const double* a_cube_pts,
+                                  const int a_number_of_planes,
+                                  const double* a_planes, double* a_volume,
+                                  double* a_times) {
+  const auto cube_pts = getCubePts(a_cube_pts);
+  clipByPlanes<ScalarType>(cube_pts.data(), 8, cube_faces, cube_face_sizes,
+                           a_number_of_planes, a_planes, a_volume, a_times);
+}
+
+template <class ScalarType>
+void vertex_clip_triPrismByPlanes(const double* a_tri_prism_pts,
+                                  const int a_number_of_planes,
+                                  const double* a_planes, double* a_volume,
+                                  double* a_times) {
+  clipByPlanes<ScalarType>(a_tri_prism_pts, 6, tri_prism_faces,
+                           tri_prism_face_sizes, a_number_of_planes, a_planes,
+                           a_volume, a_times);
+}
+
+template <class ScalarType>
+void vertex_clip_triHexByPlanes(const double* a_tri_hex_pts,
+                                const int a_number_of_planes,
+                                const double* a_planes, double* a_volume,
+                                double* a_times) {
+  clipByPlanes<ScalarType>(a_tri_hex_pts, 8, tri_hex_faces, tri_hex_face_sizes,
+                           a_number_of_planes, a_planes, a_volume, a_times);
+}
+
+template <class ScalarType>
+void vertex_clip_symPrismByPlanes(const double* a_sym_prism_pts,
+                                  const int a_number_of_planes,
+                                  const double* a_planes, double* a_volume,
+                                  double* a_times) {
+  clipByPlanes<ScalarType>(a_sym_prism_pts, 11, sym_prism_faces,
+                           sym_prism_face_sizes, a_number_of_planes, a_planes,
+                           a_volume, a_times);
+}
+
+template <class ScalarType>
+void vertex_clip_symHexByPlanes(const double* a_sym_hex_pts,
+                                const int a_number_of_planes,
+                                const double* a_planes, double* a_volume,
+                                double* a_times) {
+  clipByPlanes<ScalarType>(a_sym_hex_pts, 14, sym_hex_faces, sym_hex_face_sizes,
+                           a_number_of_planes, a_planes, a_volume, a_times);
+}
+
+template <class ScalarType>
+void vertex_clip_stelDodecahedronByPlanes(
+    const double* a_stel_dodecahedron_pts, const int a_number_of_planes,
+    const double* a_planes, double* a_volume, double* a_times) {
+  clipByPlanes<ScalarType>(a_stel_dodecahedron_pts, 32,
+                           stel_dodecahedron_faces,
+                           stel_dodecahedron_face_sizes, a_number_of_planes,
+                           a_planes, a_volume, a_times);
+}
+
+template <class ScalarType>
+void vertex_clip_stelIcosahedronByPlanes(const double* a_stel_icosahedron_pts,
+                                         const int a_number_of_planes,
+                                         const double* a_planes,
+                                         double* a_volume, double* a_times) {
+  clipByPlanes<ScalarType>(a_stel_icosahedron_pts, 32, stel_icosahedron_faces,
+                           stel_icosahedron_face_sizes, a_number_of_planes,
+                           a_planes, a_volume, a_times);
+}
+
+// Explicit instantiations for single and double precision
+#define INSTANTIATE_VERTEX_CLIP(ScalarType)                                   \
+  template void vertex_clip_prismByPlanes<ScalarType>(                        \
+      const double*, const int, const double*, double*, double*);             \
+  template void vertex_clip_unitCubeByPlanes<ScalarType>(                     \
+      const double*, const int, const double*, double*, double*);             \
+  template void vertex_clip_triPrismByPlanes<ScalarType>(                     \
+      const double*, const int, const double*, double*, double*);             \
+  template void vertex_clip_triHexByPlanes<ScalarType>(                       \
+      const double*, const int, const double*, double*, double*);             \
+  template void vertex_clip_symPrismByPlanes<ScalarType>(                     \
+      const double*, const int, const double*, double*, double*);             \
+  template void vertex_clip_symHexByPlanes<ScalarType>(                       \
+      const double*, const int, const double*, double*, double*);             \
+  template void vertex_clip_stelDodecahedronByPlanes<ScalarType>(             \
+      const double*, const int, const double*, double*, double*);             \
+  template void vertex_clip_stelIcosahedronByPlanes<ScalarType>(              \
+      const double*, const int, const double*, double*, double*);
+
+INSTANTIATE_VERTEX_CLIP(float)
+INSTANTIATE_VERTEX_CLIP(double)
+
+#undef INSTANTIATE_VERTEX_CLIP
@@ -0,0 +1,71 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Plane-polyhedron intersection using the in-repo VertexGraphPolyhedron.
+// Each function is explicitly instantiated for float and double
+// (see vertex_clip_intersection.cpp). Points and planes are always passed
+// as double, matching the other packages, and are converted to ScalarType
+// before timing starts. Only the total time is recorded in a_times[0].
+
+#ifndef SRC_VERTEX_CLIP_VERTEX_CLIP_INTERSECTION_H_
+#define SRC_VERTEX_CLIP_VERTEX_CLIP_INTERSECTION_H_
+
+// Perform intersection of plane(s) with a Triangular Prism
+template <class ScalarType>
+void vertex_clip_prismByPlanes(const double *a_prism_pts,
+                               const int a_number_of_planes,
+                               const double *a_planes, double *a_volume,
+                               double *a_times);
+
+// Perform intersection of plane(s) with a Unit Cube
+template <class ScalarType>
+void vertex_clip_unitCubeByPlanes(const double *a_cube_pts,
+                                  const int a_number_of_planes,
+                                  const double *a_planes, double *a_volume,
+                                  double *a_times);
+
+// Perform intersection of plane(s) with a Triangulated Triangular Prism
+template <class ScalarType>
+void vertex_clip_triPrismByPlanes(const double *a_tri_prism_pts,
+                                  const int a_number_of_planes,
+                                  const double *a_planes, double *a_volume,
+                                  double *a_times);
+
+// Perform intersection of plane(s) with a Triangulated Hexahedron
+template <class ScalarType>
+void vertex_clip_triHexByPlanes(const double *a_tri_hex_pts,
+                                const int a_number_of_planes,
+                                const double *a_planes, double *a_volume,
+                                double *a_times);
+
+// Perform intersection of plane(s) with a Symmetric Triangular Prism
+template <class ScalarType>
+void vertex_clip_symPrismByPlanes(const double *a_sym_prism_pts,
+                                  const int a_number_of_planes,
+                                  const double *a_planes, double *a_volume,
+                                  double *a_times);
+
+// Perform intersection of plane(s) with a Symmetric Hexahedron
+template <class ScalarType>
+void vertex_clip_symHexByPlanes(const double *a_sym_hex_pts,
+                                const int a_number_of_planes,
+                                const double *a_planes, double *a_volume,
+                                double *a_times);
+
+// Perform intersection of plane(s) with a Stellated Dodecahedron
+template <class ScalarType>
+void vertex_clip_stelDodecahedronByPlanes(
+    const double *a_stel_dodecahedron_pts, const int a_number_of_planes,
+    const double *a_planes, double *a_volume, double *a_times);
+
+// Perform intersection of plane(s) with a Stellated Icosahedron
+template <class ScalarType>
+void vertex_clip_stelIcosahedronByPlanes(const double *a_stel_icosahedron_pts,
+                                         const int a_number_of_planes,
+                                         const double *a_planes,
+                                         double *a_volume, double *a_times);
+
+#endif  // SRC_VERTEX_CLIP_VERTEX_CLIP_INTERSECTION_H_
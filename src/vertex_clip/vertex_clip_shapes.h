@@ -0,0 +1,86 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Boundary representations of the polyhedra used in the benchmarks, as
+// given to VertexGraphPolyhedron::initialize. Vertex ordering matches the
+// points given to the other packages in
+// src/timing_comp/intersection_timing.cpp.
+
+#ifndef SRC_VERTEX_CLIP_VERTEX_CLIP_SHAPES_H_
+#define SRC_VERTEX_CLIP_VERTEX_CLIP_SHAPES_H_
+
+#include <array>
+
+// Face lists (counter-clockwise from outside, 0-based), matching
+// the BREPs given to R3D in src/r3d/r3d_intersection.c
+constexpr std::array<int, 18> prism_faces{{
+    0, 1, 2, 0, 3, 4, 1, 0, 2, 5, 3, 1, 4, 5, 2, 3, 5, 4}};
+constexpr std::array<int, 5> prism_face_sizes{{
+    3, 4, 4, 4, 3}};
+
+constexpr std::array<int, 24> tri_prism_faces{{
+    0, 1, 2, 4, 3, 5, 4, 5, 2, 4, 2, 1, 4, 1, 0, 4, 0, 3, 0, 2, 5, 0, 5, 3}};
+constexpr std::array<int, 8> tri_prism_face_sizes{{
+    3, 3, 3, 3, 3, 3, 3, 3}};
+
+constexpr std::array<int, 36> tri_hex_faces{{
+    5, 7, 6, 5, 4, 7, 3, 0, 1, 3, 1, 2, 4, 3, 7, 4, 0, 3, 2, 5, 6, 2, 1, 5,
+    0, 5, 1, 0, 4, 5, 3, 6, 7, 3, 2, 6}};
+constexpr std::array<int, 12> tri_hex_face_sizes{{
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3}};
+
+constexpr std::array<int, 54> sym_prism_faces{{
+    6, 0, 1, 6, 1, 2, 6, 2, 0, 7, 1, 0, 7, 4, 1, 7, 3, 4, 7, 0, 3, 8, 2, 1,
+    8, 1, 4, 8, 4, 5, 8, 5, 2, 9, 0, 2, 9, 3, 0, 9, 5, 3, 9, 2, 5, 10, 4, 3,
+    10, 3, 5, 10, 5, 4}};
+constexpr std::array<int, 18> sym_prism_face_sizes{{
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3}};
+
+constexpr std::array<int, 72> sym_hex_faces{{
+    0, 1, 8, 1, 2, 8, 2, 3, 8, 3, 0, 8, 5, 1, 9, 1, 0, 9, 0, 4, 9, 4, 5, 9,
+    1, 5, 10, 5, 6, 10, 6, 2, 10, 2, 1, 10, 2, 6, 11, 6, 7, 11, 7, 3, 11,
+    3, 2, 11, 0, 3, 12, 3, 7, 12, 7, 4, 12, 4, 0, 12, 5, 4, 13, 4, 7, 13,
+    7, 6, 13, 6, 5, 13}};
+constexpr std::array<int, 24> sym_hex_face_sizes{{
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3}};
+
+constexpr std::array<int, 180> stel_dodecahedron_faces{{
+    0, 8, 20, 8, 9, 20, 9, 4, 20, 4, 16, 20, 16, 0, 20, 0, 16, 21, 16, 17, 21,
+    17, 2, 21, 2, 12, 21, 12, 0, 21, 12, 2, 22, 2, 10, 22, 10, 3, 22,
+    3, 13, 22, 13, 12, 22, 9, 5, 23, 5, 15, 23, 15, 14, 23, 14, 4, 23,
+    4, 9, 23, 3, 19, 24, 19, 18, 24, 18, 1, 24, 1, 13, 24, 13, 3, 24,
+    7, 11, 25, 11, 6, 25, 6, 14, 25, 14, 15, 25, 15, 7, 25, 0, 12, 26,
+    12, 13, 26, 13, 1, 26, 1, 8, 26, 8, 0, 26, 8, 1, 27, 1, 18, 27, 18, 5, 27,
+    5, 9, 27, 9, 8, 27, 16, 4, 28, 4, 14, 28, 14, 6, 28, 6, 17, 28, 17, 16, 28,
+    6, 11, 29, 11, 10, 29, 10, 2, 29, 2, 17, 29, 17, 6, 29, 7, 15, 30,
+    15, 5, 30, 5, 18, 30, 18, 19, 30, 19, 7, 30, 7, 19, 31, 19, 3, 31,
+    3, 10, 31, 10, 11, 31, 11, 7, 31}};
+constexpr std::array<int, 60> stel_dodecahedron_face_sizes{{
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3}};
+
+constexpr std::array<int, 180> stel_icosahedron_faces{{
+    0, 8, 12, 8, 4, 12, 4, 0, 12, 0, 5, 13, 5, 10, 13, 10, 0, 13, 2, 4, 14,
+    4, 9, 14, 9, 2, 14, 2, 11, 15, 11, 5, 15, 5, 2, 15, 1, 6, 16, 6, 8, 16,
+    8, 1, 16, 1, 10, 17, 10, 7, 17, 7, 1, 17, 3, 9, 18, 9, 6, 18, 6, 3, 18,
+    3, 7, 19, 7, 11, 19, 11, 3, 19, 0, 10, 20, 10, 8, 20, 8, 0, 20, 1, 8, 21,
+    8, 10, 21, 10, 1, 21, 2, 9, 22, 9, 11, 22, 11, 2, 22, 3, 11, 23, 11, 9, 23,
+    9, 3, 23, 4, 2, 24, 2, 0, 24, 0, 4, 24, 5, 0, 25, 0, 2, 25, 2, 5, 25,
+    6, 1, 26, 1, 3, 26, 3, 6, 26, 7, 3, 27, 3, 1, 27, 1, 7, 27, 8, 6, 28,
+    6, 4, 28, 4, 8, 28, 9, 4, 29, 4, 6, 29, 6, 9, 29, 10, 5, 30, 5, 7, 30,
+    7, 10, 30, 11, 7, 31, 7, 5, 31, 5, 11, 31}};
+constexpr std::array<int, 60> stel_icosahedron_face_sizes{{
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3}};
+
+constexpr std::array<int, 24> cube_faces{{0, 1, 2, 3, 1, 0, 4, 5,
+                                          2, 1, 5, 6, 3, 2, 6, 7,
+                                          0, 3, 7, 4, 7, 6, 5, 4}};
+constexpr std::array<int, 6> cube_face_sizes{{4, 4, 4, 4, 4, 4}};
+
+#endif  // SRC_VERTEX_CLIP_VERTEX_CLIP_SHAPES_H_
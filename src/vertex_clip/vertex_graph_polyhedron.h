@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// A small in-repo polyhedron clipper, templated on the scalar type used
+// for vertex locations and plane data. The polyhedron is stored as a
+// graph of degree-3 vertices (the same representation R3D uses), with
+// vertices of higher degree split into coincident copies during
+// initialization. This allows the same clipping algorithm to be
+// instantiated with both float and double, so the throughput gained by
+// single precision can be weighed against the volume error it introduces.
+
+#ifndef SRC_VERTEX_CLIP_VERTEX_GRAPH_POLYHEDRON_H_
+#define SRC_VERTEX_CLIP_VERTEX_GRAPH_POLYHEDRON_H_
+
+#include <array>
+#include <cstddef>
+
+template <class ScalarType, std::size_t kMaxVertices = 512>
+class VertexGraphPolyhedron {
+ public:
+  using value_type = ScalarType;
+
+  VertexGraphPolyhedron(void) : number_of_vertices_m(0) {}
+
+  // Build the vertex graph from a boundary representation.
+  // Points are ordered Pt 1 X/Y/Z, Pt 2 X/Y/Z, ... and faces are
+  // stored contiguously in a_face_flat, each ordered counter-clockwise
+  // when viewed from outside the polyhedron.
+  void initialize(const double* a_pts, const int a_number_of_pts,
+                  const int* a_face_flat, const int* a_verts_per_face,
+                  const int a_number_of_faces);
+
+  // Keep only the portion of the polyhedron below the plane, where the
+  // plane is given as Normx, Normy, Normz, Dist (IRL convention).
+  void clip(const ScalarType* a_plane);
+
+  // Apply clip(...) for a set of planes stacked contiguously.
+  void clip(const ScalarType* a_planes, const int a_number_of_planes);
+
+  // Volume of the (possibly clipped) polyhedron.
+  ScalarType calculateVolume(void) const;
+
+  int getNumberOfVertices(void) const { return number_of_vertices_m; }
+
+  const std::array<ScalarType, 3>& getVertexLocation(const int a_vertex) const {
+    return vertices_m[a_vertex].location;
+  }
+
+ private:
+  struct Vertex {
+    std::array<int, 3> neighbors;
+    std::array<ScalarType, 3> location;
+  };
+
+  std::array<Vertex, kMaxVertices> vertices_m;
+  int number_of_vertices_m;
+};
+
+#include "src/vertex_clip/vertex_graph_polyhedron.tpp"
+
+#endif  // SRC_VERTEX_CLIP_VERTEX_GRAPH_POLYHEDRON_H_
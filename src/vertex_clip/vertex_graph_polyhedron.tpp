@@ -0,0 +1,254 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef SRC_VERTEX_CLIP_VERTEX_GRAPH_POLYHEDRON_TPP_
+#define SRC_VERTEX_CLIP_VERTEX_GRAPH_POLYHEDRON_TPP_
+
+#include <cassert>
+
+template <class ScalarType, std::size_t kMaxVertices>
+void VertexGraphPolyhedron<ScalarType, kMaxVertices>::initialize(
+    const double* a_pts, const int a_number_of_pts, const int* a_face_flat,
+    const int* a_verts_per_face, const int a_number_of_faces) {
+  // Small, fixed upper bounds for the shapes in this benchmark.
+  static constexpr int max_pts = 64;
+  static constexpr int max_degree = 16;
+  assert(a_number_of_pts <= max_pts);
+
+  // For each point, gather the (previous, next) points of every face
+  // it belongs to. Walking these pairs orders the neighbors of the point
+  // such that a face a->v->b makes b follow a around v.
+  std::array<int, max_pts> degree;
+  std::array<std::array<std::array<int, 2>, max_degree>, max_pts> wedges;
+  degree.fill(0);
+  int face_start = 0;
+  for (int f = 0; f < a_number_of_faces; ++f) {
+    const int* face = a_face_flat + face_start;
+    const int size = a_verts_per_face[f];
+    for (int v = 0; v < size; ++v) {
+      const int pt = face[v];
+      assert(degree[pt] < max_degree);
+      wedges[pt][degree[pt]][0] = face[(v + size - 1) % size];
+      wedges[pt][degree[pt]][1] = face[(v + 1) % size];
+      ++degree[pt];
+    }
+    face_start += size;
+  }
+
+  std::array<std::array<int, max_degree>, max_pts> ring;
+  std::array<int, max_pts> first_copy;
+  number_of_vertices_m = 0;
+  for (int pt = 0; pt < a_number_of_pts; ++pt) {
+    assert(degree[pt] >= 3);
+    ring[pt][0] = wedges[pt][0][0];
+    for (int n = 1; n < degree[pt]; ++n) {
+      for (int w = 0; w < degree[pt]; ++w) {
+        if (wedges[pt][w][0] == ring[pt][n - 1]) {
+          ring[pt][n] = wedges[pt][w][1];
+          break;
+        }
+      }
+    }
+    first_copy[pt] = number_of_vertices_m;
+    number_of_vertices_m += degree[pt] == 3 ? 1 : degree[pt];
+  }
+  assert(number_of_vertices_m <= static_cast<int>(kMaxVertices));
+
+  // Vertex (copy) that the edge from a_pt towards a_other starts at.
+  auto copy_towards = [&](const int a_pt, const int a_other) {
+    for (int n = 0; n < degree[a_pt]; ++n) {
+      if (ring[a_pt][n] == a_other) {
+        return degree[a_pt] == 3 ? first_copy[a_pt] : first_copy[a_pt] + n;
+      }
+    }
+    assert(false);
+    return -1;
+  };
+
+  for (int pt = 0; pt < a_number_of_pts; ++pt) {
+    const int d = degree[pt];
+    if (d == 3) {
+      Vertex& vertex = vertices_m[first_copy[pt]];
+      for (int n = 0; n < 3; ++n) {
+        vertex.neighbors[n] = copy_towards(ring[pt][n], pt);
+      }
+    } else {
+      // Higher degree points are replaced by a ring of coincident
+      // degree-3 vertices joined by a degenerate (zero area) face.
+      for (int n = 0; n < d; ++n) {
+        Vertex& vertex = vertices_m[first_copy[pt] + n];
+        vertex.neighbors[0] = copy_towards(ring[pt][n], pt);
+        vertex.neighbors[1] = first_copy[pt] + (n + 1) % d;
+        vertex.neighbors[2] = first_copy[pt] + (n + d - 1) % d;
+      }
+    }
+    const int copies = d == 3 ? 1 : d;
+    for (int n = 0; n < copies; ++n) {
+      for (int dim = 0; dim < 3; ++dim) {
+        vertices_m[first_copy[pt] + n].location[dim] =
+            static_cast<ScalarType>(a_pts[pt * 3 + dim]);
+      }
+    }
+  }
+}
+
+template <class ScalarType, std::size_t kMaxVertices>
+void VertexGraphPolyhedron<ScalarType, kMaxVertices>::clip(
+    const ScalarType* a_plane) {
+  if (number_of_vertices_m == 0) {
+    return;
+  }
+
+  // Positive distance is kept, so flip sign relative to IRL plane
+  std::array<ScalarType, kMaxVertices> distance;
+  int number_clipped = 0;
+  for (int v = 0; v < number_of_vertices_m; ++v) {
+    const auto& location = vertices_m[v].location;
+    distance[v] = a_plane[3] - (a_plane[0] * location[0] +
+                                a_plane[1] * location[1] +
+                                a_plane[2] * location[2]);
+    number_clipped += distance[v] < static_cast<ScalarType>(0) ? 1 : 0;
+  }
+  if (number_clipped == 0) {
+    return;
+  }
+  if (number_clipped == number_of_vertices_m) {
+    number_of_vertices_m = 0;
+    return;
+  }
+
+  // Place a new vertex on every edge crossing the plane
+  const int original_vertices = number_of_vertices_m;
+  for (int v = 0; v < original_vertices; ++v) {
+    if (distance[v] < static_cast<ScalarType>(0)) {
+      continue;
+    }
+    for (int n = 0; n < 3; ++n) {
+      const int neighbor = vertices_m[v].neighbors[n];
+      if (distance[neighbor] >= static_cast<ScalarType>(0)) {
+        continue;
+      }
+      assert(number_of_vertices_m < static_cast<int>(kMaxVertices));
+      const ScalarType weight_kept = -distance[neighbor];
+      const ScalarType weight_clipped = distance[v];
+      const ScalarType inv_total =
+          static_cast<ScalarType>(1) / (weight_kept + weight_clipped);
+      Vertex& new_vertex = vertices_m[number_of_vertices_m];
+      for (int dim = 0; dim < 3; ++dim) {
+        new_vertex.location[dim] =
+            (weight_kept * vertices_m[v].location[dim] +
+             weight_clipped * vertices_m[neighbor].location[dim]) *
+            inv_total;
+      }
+      new_vertex.neighbors[0] = v;
+      vertices_m[v].neighbors[n] = number_of_vertices_m;
+      ++number_of_vertices_m;
+    }
+  }
+
+  // Connect the new vertices by walking each cut face until reaching
+  // the next new vertex.
+  for (int start = original_vertices; start < number_of_vertices_m; ++start) {
+    int current = start;
+    int next = vertices_m[current].neighbors[0];
+    do {
+      int n = 0;
+      while (vertices_m[next].neighbors[n] != current) {
+        ++n;
+      }
+      current = next;
+      next = vertices_m[current].neighbors[(n + 1) % 3];
+    } while (current < original_vertices);
+    vertices_m[start].neighbors[2] = current;
+    vertices_m[current].neighbors[1] = start;
+  }
+
+  // Compact storage, removing clipped vertices
+  std::array<int, kMaxVertices> new_index;
+  int kept = 0;
+  for (int v = 0; v < number_of_vertices_m; ++v) {
+    if (v < original_vertices && distance[v] < static_cast<ScalarType>(0)) {
+      continue;
+    }
+    vertices_m[kept] = vertices_m[v];
+    new_index[v] = kept;
+    ++kept;
+  }
+  number_of_vertices_m = kept;
+  for (int v = 0; v < number_of_vertices_m; ++v) {
+    for (auto& neighbor : vertices_m[v].neighbors) {
+      neighbor = new_index[neighbor];
+    }
+  }
+}
+
+template <class ScalarType, std::size_t kMaxVertices>
+void VertexGraphPolyhedron<ScalarType, kMaxVertices>::clip(
+    const ScalarType* a_planes, const int a_number_of_planes) {
+  for (int p = 0; p < a_number_of_planes; ++p) {
+    this->clip(a_planes + 4 * p);
+  }
+}
+
+template <class ScalarType, std::size_t kMaxVertices>
+ScalarType VertexGraphPolyhedron<ScalarType, kMaxVertices>::calculateVolume(
+    void) const {
+  if (number_of_vertices_m == 0) {
+    return static_cast<ScalarType>(0);
+  }
+
+  // Faces are found by walking unvisited half-edges (vertex, slot),
+  // and triangulated as a fan. Locations are taken relative to
+  // the first vertex to limit round-off in single precision.
+  const auto& datum = vertices_m[0].location;
+  auto relative = [&](const int a_vertex) {
+    const auto& location = vertices_m[a_vertex].location;
+    return std::array<ScalarType, 3>{{location[0] - datum[0],
+                                      location[1] - datum[1],
+                                      location[2] - datum[2]}};
+  };
+
+  std::array<std::array<bool, 3>, kMaxVertices> visited;
+  for (int v = 0; v < number_of_vertices_m; ++v) {
+    visited[v].fill(false);
+  }
+
+  ScalarType six_volume = static_cast<ScalarType>(0);
+  for (int start = 0; start < number_of_vertices_m; ++start) {
+    for (int slot = 0; slot < 3; ++slot) {
+      if (visited[start][slot]) {
+        continue;
+      }
+      const auto v0 = relative(start);
+      int current = start;
+      int current_slot = slot;
+      int next = vertices_m[current].neighbors[current_slot];
+      visited[current][current_slot] = true;
+      auto advance = [&](void) {
+        int n = 0;
+        while (vertices_m[next].neighbors[n] != current) {
+          ++n;
+        }
+        current = next;
+        current_slot = (n + 1) % 3;
+        visited[current][current_slot] = true;
+        next = vertices_m[current].neighbors[current_slot];
+      };
+      advance();
+      while (next != start) {
+        const auto v1 = relative(current);
+        const auto v2 = relative(next);
+        six_volume += v0[0] * (v1[1] * v2[2] - v1[2] * v2[1]) +
+                      v0[1] * (v1[2] * v2[0] - v1[0] * v2[2]) +
+                      v0[2] * (v1[0] * v2[1] - v1[1] * v2[0]);
+        advance();
+      }
+    }
+  }
+  return six_volume / static_cast<ScalarType>(6);
+}
+
+#endif  // SRC_VERTEX_CLIP_VERTEX_GRAPH_POLYHEDRON_TPP_
@@ -0,0 +1,266 @@
+module VOFtools_batch_mod
+  use, intrinsic :: iso_fortran_env, only: r8 => REAL64
+  use VOFtools_wrapper
+  use omp_lib
+  use iso_c_binding
+
+  ! Shapes that can be intersected in a batch
+  integer, parameter :: PRISM = 1
+  integer, parameter :: UNIT_CUBE = 2
+  integer, parameter :: TRI_PRISM = 3
+  integer, parameter :: TRI_HEX = 4
+  integer, parameter :: SYM_PRISM = 5
+  integer, parameter :: SYM_HEX = 6
+  integer, parameter :: STEL_DODECAHEDRON = 7
+  integer, parameter :: STEL_ICOSAHEDRON = 8
+
+contains
+
+  ! Build a polyhedron of shape a_shape with the same make_* routine
+  ! used by the per-call functions in VOFtools_mod.
+  subroutine make_shape(a_shape, poly, a_pts)
+    implicit none
+
+    integer, intent(in) :: a_shape
+    type(polyhedron), intent(out) :: poly
+    real(C_DOUBLE), intent(in) :: a_pts(*)
+
+    select case(a_shape)
+    case(PRISM)
+       call make_prism(poly, a_pts)
+    case(UNIT_CUBE)
+       call make_cuboid(poly, a_pts)
+    case(TRI_PRISM)
+       call make_tri_prism(poly, a_pts)
+    case(TRI_HEX)
+       call make_tri_hex(poly, a_pts)
+    case(SYM_PRISM)
+       call make_sym_prism(poly, a_pts)
+    case(SYM_HEX)
+       call make_sym_hex(poly, a_pts)
+    case(STEL_DODECAHEDRON)
+       call make_stellated_dodecahedron(poly, a_pts)
+    case(STEL_ICOSAHEDRON)
+       call make_stellated_icosahedron(poly, a_pts)
+    end select
+
+  end subroutine make_shape
+
+  ! Intersect a_number_of_trials polyhedra of shape a_shape, each by
+  ! a_number_of_planes planes. The planes of trial n (from 0) start at
+  ! a_planes(n*a_max_planes*4+1), each stored as Normx, Normy, Normz, Dist
+  ! as in VOFtools_mod. Trials are split among OpenMP threads, each with
+  ! its own polyhedron. a_times(1:3) are the init/clip/volume times summed
+  ! over all trials and a_times(4) is the wall time of the whole batch.
+  subroutine intersect_batch(a_shape, a_pts, a_number_of_trials, &
+       a_number_of_planes, a_max_planes, a_planes, a_volumes, a_times)
+    implicit none
+
+    integer, intent(in) :: a_shape
+    real(C_DOUBLE), intent(in) :: a_pts(*)
+    integer(C_INT), intent(in) :: a_number_of_trials
+    integer(C_INT), intent(in) :: a_number_of_planes
+    integer(C_INT), intent(in) :: a_max_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(*)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: batch_start, start, end
+    real(r8) :: init_time, clip_time, volume_time
+    type(polyhedron) :: poly
+    integer :: n, p, offset
+
+    init_time = 0.0_r8
+    clip_time = 0.0_r8
+    volume_time = 0.0_r8
+
+    batch_start = omp_get_wtime()
+    !$omp parallel do schedule(static) private(poly, p, offset, start, end) &
+    !$omp reduction(+:init_time, clip_time, volume_time)
+    do n = 0, a_number_of_trials-1
+       start = omp_get_wtime()
+       call make_shape(a_shape, poly, a_pts)
+       end = omp_get_wtime()
+       init_time = init_time + (end - start)
+
+       start = omp_get_wtime()
+       offset = n*a_max_planes*4
+       do p = 0, a_number_of_planes-1
+          ! Multiply normal by -1.0 due to difference in convention.
+          ! Makes consistent with IRL convention
+          call VOFtools_INTE3D_wrapper(poly, &
+               [-a_planes(offset+p*4+1:offset+p*4+3),a_planes(offset+p*4+4)])
+          if(poly%NTS == 0) then
+             exit
+          end if
+       end do
+       end = omp_get_wtime()
+       clip_time = clip_time + (end - start)
+
+       start = omp_get_wtime()
+       a_volumes(n+1) = VOFtools_TOOLV3D_wrapper(poly)
+       end = omp_get_wtime()
+       volume_time = volume_time + (end - start)
+    end do
+    !$omp end parallel do
+    a_times(4) = omp_get_wtime() - batch_start
+
+    a_times(1) = init_time
+    a_times(2) = clip_time
+    a_times(3) = volume_time
+
+  end subroutine intersect_batch
+
+  subroutine voftools_batch_prismByPlanes(a_prism_pts, &
+       a_number_of_trials, a_number_of_planes, a_max_planes, a_planes, &
+       a_volumes, a_times) bind(C, name = "c_voftools_batch_prismByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_trials
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    integer(C_INT), intent(in), value :: a_max_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(*)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    call intersect_batch(PRISM, a_prism_pts, a_number_of_trials, &
+         a_number_of_planes, a_max_planes, a_planes, a_volumes, a_times)
+
+  end subroutine voftools_batch_prismByPlanes
+
+  subroutine voftools_batch_unitCubeByPlanes(a_cube_pts, &
+       a_number_of_trials, a_number_of_planes, a_max_planes, a_planes, &
+       a_volumes, a_times) bind(C, name = "c_voftools_batch_unitCubeByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_cube_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_trials
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    integer(C_INT), intent(in), value :: a_max_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(*)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    call intersect_batch(UNIT_CUBE, a_cube_pts, a_number_of_trials, &
+         a_number_of_planes, a_max_planes, a_planes, a_volumes, a_times)
+
+  end subroutine voftools_batch_unitCubeByPlanes
+
+  subroutine voftools_batch_triPrismByPlanes(a_tri_prism_pts, &
+       a_number_of_trials, a_number_of_planes, a_max_planes, a_planes, &
+       a_volumes, a_times) bind(C, name = "c_voftools_batch_triPrismByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_tri_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_trials
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    integer(C_INT), intent(in), value :: a_max_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(*)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    call intersect_batch(TRI_PRISM, a_tri_prism_pts, a_number_of_trials, &
+         a_number_of_planes, a_max_planes, a_planes, a_volumes, a_times)
+
+  end subroutine voftools_batch_triPrismByPlanes
+
+  subroutine voftools_batch_triHexByPlanes(a_tri_hex_pts, &
+       a_number_of_trials, a_number_of_planes, a_max_planes, a_planes, &
+       a_volumes, a_times) bind(C, name = "c_voftools_batch_triHexByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_tri_hex_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_trials
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    integer(C_INT), intent(in), value :: a_max_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(*)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    call intersect_batch(TRI_HEX, a_tri_hex_pts, a_number_of_trials, &
+         a_number_of_planes, a_max_planes, a_planes, a_volumes, a_times)
+
+  end subroutine voftools_batch_triHexByPlanes
+
+  subroutine voftools_batch_symPrismByPlanes(a_sym_prism_pts, &
+       a_number_of_trials, a_number_of_planes, a_max_planes, a_planes, &
+       a_volumes, a_times) bind(C, name = "c_voftools_batch_symPrismByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_sym_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_trials
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    integer(C_INT), intent(in), value :: a_max_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(*)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    call intersect_batch(SYM_PRISM, a_sym_prism_pts, a_number_of_trials, &
+         a_number_of_planes, a_max_planes, a_planes, a_volumes, a_times)
+
+  end subroutine voftools_batch_symPrismByPlanes
+
+  subroutine voftools_batch_symHexByPlanes(a_sym_hex_pts, &
+       a_number_of_trials, a_number_of_planes, a_max_planes, a_planes, &
+       a_volumes, a_times) bind(C, name = "c_voftools_batch_symHexByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_sym_hex_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_trials
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    integer(C_INT), intent(in), value :: a_max_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(*)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    call intersect_batch(SYM_HEX, a_sym_hex_pts, a_number_of_trials, &
+         a_number_of_planes, a_max_planes, a_planes, a_volumes, a_times)
+
+  end subroutine voftools_batch_symHexByPlanes
+
+  subroutine voftools_batch_stelDodecahedronByPlanes(a_stel_dodecahedron_pts, &
+       a_number_of_trials, a_number_of_planes, a_max_planes, a_planes, &
+       a_volumes, a_times) bind(C, name = "c_voftools_batch_stelDodecahedronByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_stel_dodecahedron_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_trials
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    integer(C_INT), intent(in), value :: a_max_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(*)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    call intersect_batch(STEL_DODECAHEDRON, a_stel_dodecahedron_pts, a_number_of_trials, &
+         a_number_of_planes, a_max_planes, a_planes, a_volumes, a_times)
+
+  end subroutine voftools_batch_stelDodecahedronByPlanes
+
+  subroutine voftools_batch_stelIcosahedronByPlanes(a_stel_icosahedron_pts, &
+       a_number_of_trials, a_number_of_planes, a_max_planes, a_planes, &
+       a_volumes, a_times) bind(C, name = "c_voftools_batch_stelIcosahedronByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_stel_icosahedron_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_trials
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    integer(C_INT), intent(in), value :: a_max_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(*)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    call intersect_batch(STEL_ICOSAHEDRON, a_stel_icosahedron_pts, a_number_of_trials, &
+         a_number_of_planes, a_max_planes, a_planes, a_volumes, a_times)
+
+  end subroutine voftools_batch_stelIcosahedronByPlanes
+
+end module VOFtools_batch_mod
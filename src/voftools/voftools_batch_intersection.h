@@ -0,0 +1,90 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// C interface to batched VOFTools intersections. Unlike the functions
+// in voftools_intersection.h, which cross into Fortran once per
+// polyhedron, each call here intersects a whole set of trials in a
+// Fortran OpenMP loop, so VOFTools is timed without per-call overhead.
+//
+// The planes of trial n start at a_planes[n*a_max_planes*4], and the
+// first a_number_of_planes of them are used. Volumes are written to
+// a_volumes[0:a_number_of_trials]. a_times[0:3] are the
+// initialization/intersection/volume times summed over all trials and
+// a_times[3] is the wall time of the whole batch.
+
+#ifndef SRC_VOFTOOLS_VOFTOOLS_BATCH_INTERSECTION_H_
+#define SRC_VOFTOOLS_VOFTOOLS_BATCH_INTERSECTION_H_
+
+// Perform intersection of plane(s) with a batch of Triangular Prisms
+void c_voftools_batch_prismByPlanes(const double *a_prism_pts,
+                                    const int a_number_of_trials,
+                                    const int a_number_of_planes,
+                                    const int a_max_planes,
+                                    const double *a_planes, double *a_volumes,
+                                    double *a_times);
+
+// Perform intersection of plane(s) with a batch of Unit Cubes
+void c_voftools_batch_unitCubeByPlanes(const double *a_cube_pts,
+                                       const int a_number_of_trials,
+                                       const int a_number_of_planes,
+                                       const int a_max_planes,
+                                       const double *a_planes,
+                                       double *a_volumes, double *a_times);
+
+// Perform intersection of plane(s) with a batch of Triangulated Prisms
+void c_voftools_batch_triPrismByPlanes(const double *a_tri_prism_pts,
+                                       const int a_number_of_trials,
+                                       const int a_number_of_planes,
+                                       const int a_max_planes,
+                                       const double *a_planes,
+                                       double *a_volumes, double *a_times);
+
+// Perform intersection of plane(s) with a batch of Triangulated Hexahedra
+void c_voftools_batch_triHexByPlanes(const double *a_tri_hex_pts,
+                                     const int a_number_of_trials,
+                                     const int a_number_of_planes,
+                                     const int a_max_planes,
+                                     const double *a_planes, double *a_volumes,
+                                     double *a_times);
+
+// Perform intersection of plane(s) with a batch of Symmetric Triangular Prisms
+void c_voftools_batch_symPrismByPlanes(const double *a_sym_prism_pts,
+                                       const int a_number_of_trials,
+                                       const int a_number_of_planes,
+                                       const int a_max_planes,
+                                       const double *a_planes,
+                                       double *a_volumes, double *a_times);
+
+// Perform intersection of plane(s) with a batch of Symmetric Hexahedra
+void c_voftools_batch_symHexByPlanes(const double *a_sym_hex_pts,
+                                     const int a_number_of_trials,
+                                     const int a_number_of_planes,
+                                     const int a_max_planes,
+                                     const double *a_planes, double *a_volumes,
+                                     double *a_times);
+
+// Perform intersection of plane(s) with a batch of Stellated Dodecahedra
+void c_voftools_batch_stelDodecahedronByPlanes(const double *a_stel_dodecahedron_pts,
+                                               const int a_number_of_trials,
+                                               const int a_number_of_planes,
+                                               const int a_max_planes,
+                                               const double *a_planes,
+                                               double *a_volumes,
+                                               double *a_times);
+
+// Perform intersection of plane(s) with a batch of Stellated Icosahedra
+void c_voftools_batch_stelIcosahedronByPlanes(const double *a_stel_icosahedron_pts,
+                                              const int a_number_of_trials,
+                                              const int a_number_of_planes,
+                                              const int a_max_planes,
+                                              const double *a_planes,
+                                              double *a_volumes,
+                                              double *a_times);
+
+#endif // SRC_VOFTOOLS_VOFTOOLS_BATCH_INTERSECTION_H_
@@ -602,7 +602,20 @@ contains
     a_times(1) = end - start
 
   end subroutine voftools_stelIcosahedronByPlanes_total
-  
 
+  ! Bytes occupied by one polyhedron with the configured NS/NV,
+  ! used to report the memory footprint being timed.
+  function voftools_polyhedronBytes() result(a_bytes) &
+       bind(C, name = "c_voftools_polyhedronBytes")
+
+    implicit none
+
+    integer(C_INT) :: a_bytes
+
+    type(polyhedron) :: poly
+
+    a_bytes = int(storage_size(poly) / 8, C_INT)
+
+  end function voftools_polyhedronBytes
 
 end module VOFtools_mod
@@ -117,4 +117,8 @@ void c_voftools_stelIcosahedronByPlanes_total(const double *a_stel_icosahedron_p
 					      const double *a_planes, double *a_volume,
 					      double *a_times);
 
+// Size in bytes of one VOFTools polyhedron, set by VOFTOOLS_NS and
+// VOFTOOLS_NV in config.cmake
+int c_voftools_polyhedronBytes(void);
+
 #endif // SRC_VOFTOOLS_VOFTOOLS_INTERSECTION_H_
@@ -0,0 +1,1279 @@
+module VOFtools_prototype_mod
+  use, intrinsic :: iso_fortran_env, only: r8 => REAL64
+  use VOFtools_wrapper
+  use omp_lib
+  use iso_c_binding
+
+  ! A polyhedron built once with the make_* routines. Its connectivity
+  ! and face normals are reused by every later polyhedron of the same
+  ! shape, which only differ from it by translation.
+  type prototype
+     logical :: initialized = .false.
+     integer :: max_nipv = 0 ! Most vertices on any one face
+     type(polyhedron) :: poly
+  end type prototype
+
+  type(prototype), save :: prism_prototype, unit_cube_prototype, tri_prism_prototype, &
+       tri_hex_prototype, sym_prism_prototype, sym_hex_prototype, &
+       stel_dodecahedron_prototype, stel_icosahedron_prototype
+
+contains
+
+  ! Mark a_prototype as built, recording its widest face so only the
+  ! used columns of IPV are copied when cloning.
+  subroutine finish_prototype(a_prototype)
+    implicit none
+
+    type(prototype), intent(inout) :: a_prototype
+
+    a_prototype%max_nipv = maxval(a_prototype%poly%NIPV(1:a_prototype%poly%NTS))
+    a_prototype%initialized = .true.
+
+  end subroutine finish_prototype
+
+  ! Copy the used part of the prototype's connectivity and normals
+  ! into poly. Vertex locations are taken from a_pts (ordered Pt 1 X/Y/Z,
+  ! Pt 2 X/Y/Z, ...) when present, otherwise from the prototype.
+  subroutine clone_prototype(a_prototype, poly, a_pts)
+    implicit none
+
+    type(prototype), intent(in) :: a_prototype
+    type(polyhedron), intent(inout) :: poly
+    real(r8), intent(in), optional :: a_pts(3,*)
+
+    integer :: n, nts
+
+    nts = a_prototype%poly%NTS
+    poly%NTS = nts
+    poly%NTP = a_prototype%poly%NTP
+    poly%NTV = a_prototype%poly%NTV
+    poly%NIPV(1:nts) = a_prototype%poly%NIPV(1:nts)
+    poly%IPV(1:nts,1:a_prototype%max_nipv) = &
+         a_prototype%poly%IPV(1:nts,1:a_prototype%max_nipv)
+    poly%NORMAL(1:nts,:) = a_prototype%poly%NORMAL(1:nts,:)
+
+    if(present(a_pts)) then
+       do n = 1, poly%NTV
+          poly%VERTP(n,:) = a_pts(:,n)
+       end do
+    else
+       poly%VERTP(1:poly%NTV,:) = a_prototype%poly%VERTP(1:poly%NTV,:)
+    end if
+
+  end subroutine clone_prototype
+
+  ! Copy the used faces and vertices of a_source into poly, which is
+  ! cheaper than assigning the whole NS by NV storage. Vertices are
+  ! copied up to NTP, since clipping leaves unused slots below it.
+  subroutine copy_polyhedron(a_source, poly)
+    implicit none
+
+    type(polyhedron), intent(in) :: a_source
+    type(polyhedron), intent(inout) :: poly
+
+    integer :: nts, max_nipv
+
+    nts = a_source%NTS
+    poly%NTS = nts
+    poly%NTP = a_source%NTP
+    poly%NTV = a_source%NTV
+    if(nts == 0) then
+       return
+    end if
+    max_nipv = maxval(a_source%NIPV(1:nts))
+    poly%NIPV(1:nts) = a_source%NIPV(1:nts)
+    poly%IPV(1:nts,1:max_nipv) = a_source%IPV(1:nts,1:max_nipv)
+    poly%NORMAL(1:nts,:) = a_source%NORMAL(1:nts,:)
+    poly%VERTP(1:a_source%NTP,:) = a_source%VERTP(1:a_source%NTP,:)
+
+  end subroutine copy_polyhedron
+
+  subroutine voftools_prototype_prismByPlanes(a_prism_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_prismByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. prism_prototype%initialized) then
+       call make_prism(prism_prototype%poly, a_prism_pts)
+       call finish_prototype(prism_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(prism_prototype, poly, a_prism_pts)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+    start = omp_get_wtime()
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+    end = omp_get_wtime()
+    a_times(2) = end - start
+
+    start = omp_get_wtime()
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(3) = end - start
+
+  end subroutine voftools_prototype_prismByPlanes
+
+  subroutine voftools_prototype_unitCubeByPlanes(a_cube_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_unitCubeByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_cube_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. unit_cube_prototype%initialized) then
+       call make_cuboid(unit_cube_prototype%poly, a_cube_pts)
+       call finish_prototype(unit_cube_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(unit_cube_prototype, poly)
+    call set_cuboid_vertices(poly, a_cube_pts)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+    start = omp_get_wtime()
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+    end = omp_get_wtime()
+    a_times(2) = end - start
+
+    start = omp_get_wtime()
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(3) = end - start
+
+  end subroutine voftools_prototype_unitCubeByPlanes
+
+  subroutine voftools_prototype_triPrismByPlanes(a_tri_prism_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_triPrismByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_tri_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. tri_prism_prototype%initialized) then
+       call make_tri_prism(tri_prism_prototype%poly, a_tri_prism_pts)
+       call finish_prototype(tri_prism_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(tri_prism_prototype, poly, a_tri_prism_pts)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+    start = omp_get_wtime()
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+    end = omp_get_wtime()
+    a_times(2) = end - start
+
+    start = omp_get_wtime()
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(3) = end - start
+
+  end subroutine voftools_prototype_triPrismByPlanes
+
+  subroutine voftools_prototype_triHexByPlanes(a_tri_hex_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_triHexByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_tri_hex_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. tri_hex_prototype%initialized) then
+       call make_tri_hex(tri_hex_prototype%poly, a_tri_hex_pts)
+       call finish_prototype(tri_hex_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(tri_hex_prototype, poly, a_tri_hex_pts)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+    start = omp_get_wtime()
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+    end = omp_get_wtime()
+    a_times(2) = end - start
+
+    start = omp_get_wtime()
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(3) = end - start
+
+  end subroutine voftools_prototype_triHexByPlanes
+
+  subroutine voftools_prototype_symPrismByPlanes(a_sym_prism_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_symPrismByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_sym_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. sym_prism_prototype%initialized) then
+       call make_sym_prism(sym_prism_prototype%poly, a_sym_prism_pts)
+       call finish_prototype(sym_prism_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(sym_prism_prototype, poly, a_sym_prism_pts)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+    start = omp_get_wtime()
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+    end = omp_get_wtime()
+    a_times(2) = end - start
+
+    start = omp_get_wtime()
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(3) = end - start
+
+  end subroutine voftools_prototype_symPrismByPlanes
+
+  subroutine voftools_prototype_symHexByPlanes(a_sym_hex_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_symHexByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_sym_hex_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. sym_hex_prototype%initialized) then
+       call make_sym_hex(sym_hex_prototype%poly, a_sym_hex_pts)
+       call finish_prototype(sym_hex_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(sym_hex_prototype, poly, a_sym_hex_pts)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+    start = omp_get_wtime()
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+    end = omp_get_wtime()
+    a_times(2) = end - start
+
+    start = omp_get_wtime()
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(3) = end - start
+
+  end subroutine voftools_prototype_symHexByPlanes
+
+  subroutine voftools_prototype_stelDodecahedronByPlanes(a_stel_dodecahedron_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_stelDodecahedronByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_stel_dodecahedron_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. stel_dodecahedron_prototype%initialized) then
+       call make_stellated_dodecahedron(stel_dodecahedron_prototype%poly, a_stel_dodecahedron_pts)
+       call finish_prototype(stel_dodecahedron_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(stel_dodecahedron_prototype, poly)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+    start = omp_get_wtime()
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+    end = omp_get_wtime()
+    a_times(2) = end - start
+
+    start = omp_get_wtime()
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(3) = end - start
+
+  end subroutine voftools_prototype_stelDodecahedronByPlanes
+
+  subroutine voftools_prototype_stelIcosahedronByPlanes(a_stel_icosahedron_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_stelIcosahedronByPlanes")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_stel_icosahedron_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. stel_icosahedron_prototype%initialized) then
+       call make_stellated_icosahedron(stel_icosahedron_prototype%poly, a_stel_icosahedron_pts)
+       call finish_prototype(stel_icosahedron_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(stel_icosahedron_prototype, poly)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+    start = omp_get_wtime()
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+    end = omp_get_wtime()
+    a_times(2) = end - start
+
+    start = omp_get_wtime()
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(3) = end - start
+
+  end subroutine voftools_prototype_stelIcosahedronByPlanes
+
+
+!!!! Implementation of same functions from above but timing everything at once !!!!
+
+  subroutine voftools_prototype_prismByPlanes_total(a_prism_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_prismByPlanes_total")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. prism_prototype%initialized) then
+       call make_prism(prism_prototype%poly, a_prism_pts)
+       call finish_prototype(prism_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(prism_prototype, poly, a_prism_pts)
+
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_prismByPlanes_total
+
+  subroutine voftools_prototype_unitCubeByPlanes_total(a_cube_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_unitCubeByPlanes_total")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_cube_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. unit_cube_prototype%initialized) then
+       call make_cuboid(unit_cube_prototype%poly, a_cube_pts)
+       call finish_prototype(unit_cube_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(unit_cube_prototype, poly)
+    call set_cuboid_vertices(poly, a_cube_pts)
+
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_unitCubeByPlanes_total
+
+  subroutine voftools_prototype_triPrismByPlanes_total(a_tri_prism_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_triPrismByPlanes_total")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_tri_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. tri_prism_prototype%initialized) then
+       call make_tri_prism(tri_prism_prototype%poly, a_tri_prism_pts)
+       call finish_prototype(tri_prism_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(tri_prism_prototype, poly, a_tri_prism_pts)
+
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_triPrismByPlanes_total
+
+  subroutine voftools_prototype_triHexByPlanes_total(a_tri_hex_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_triHexByPlanes_total")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_tri_hex_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. tri_hex_prototype%initialized) then
+       call make_tri_hex(tri_hex_prototype%poly, a_tri_hex_pts)
+       call finish_prototype(tri_hex_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(tri_hex_prototype, poly, a_tri_hex_pts)
+
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_triHexByPlanes_total
+
+  subroutine voftools_prototype_symPrismByPlanes_total(a_sym_prism_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_symPrismByPlanes_total")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_sym_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. sym_prism_prototype%initialized) then
+       call make_sym_prism(sym_prism_prototype%poly, a_sym_prism_pts)
+       call finish_prototype(sym_prism_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(sym_prism_prototype, poly, a_sym_prism_pts)
+
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_symPrismByPlanes_total
+
+  subroutine voftools_prototype_symHexByPlanes_total(a_sym_hex_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_symHexByPlanes_total")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_sym_hex_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. sym_hex_prototype%initialized) then
+       call make_sym_hex(sym_hex_prototype%poly, a_sym_hex_pts)
+       call finish_prototype(sym_hex_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(sym_hex_prototype, poly, a_sym_hex_pts)
+
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_symHexByPlanes_total
+
+  subroutine voftools_prototype_stelDodecahedronByPlanes_total(a_stel_dodecahedron_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_stelDodecahedronByPlanes_total")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_stel_dodecahedron_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. stel_dodecahedron_prototype%initialized) then
+       call make_stellated_dodecahedron(stel_dodecahedron_prototype%poly, a_stel_dodecahedron_pts)
+       call finish_prototype(stel_dodecahedron_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(stel_dodecahedron_prototype, poly)
+
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_stelDodecahedronByPlanes_total
+
+  subroutine voftools_prototype_stelIcosahedronByPlanes_total(a_stel_icosahedron_pts, &
+       a_number_of_planes, a_planes, a_volume, a_times) &
+       bind(C, name = "c_voftools_prototype_stelIcosahedronByPlanes_total")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_stel_icosahedron_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volume
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+    integer(C_INT) :: p
+
+    if(.not. stel_icosahedron_prototype%initialized) then
+       call make_stellated_icosahedron(stel_icosahedron_prototype%poly, a_stel_icosahedron_pts)
+       call finish_prototype(stel_icosahedron_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(stel_icosahedron_prototype, poly)
+
+    do p = 0, a_number_of_planes-1
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+
+    a_volume = VOFtools_TOOLV3D_wrapper(poly)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_stelIcosahedronByPlanes_total
+
+!!!! Splitting by planes, keeping the volume on both sides !!!!
+
+  ! Cut poly by each plane in turn. INTE3D only keeps the part below a
+  ! plane, so before each cut a copy of poly is clipped by the flipped
+  ! plane to find the part above it. a_volumes(1) is the volume below
+  ! every plane and a_volumes(2) the rest of the polyhedron.
+  subroutine split_by_planes(poly, a_number_of_planes, a_planes, a_volumes)
+    implicit none
+
+    type(polyhedron), intent(inout) :: poly
+    integer(C_INT), intent(in) :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(2)
+
+    type(polyhedron) :: above
+    integer(C_INT) :: p
+
+    a_volumes(2) = 0.0_r8
+    do p = 0, a_number_of_planes-1
+       ! Both sides come from their own clip, so their sum is not
+       ! conserved by construction
+       call copy_polyhedron(poly, above)
+       call VOFtools_INTE3D_wrapper(above, [a_planes(p*4+1:p*4+3),-a_planes(p*4+4)])
+       a_volumes(2) = a_volumes(2) + VOFtools_TOOLV3D_wrapper(above)
+       ! Multiply normal by -1.0 due to difference in convention.
+       ! Makes consistent with IRL convention
+       call VOFtools_INTE3D_wrapper(poly, [-a_planes(p*4+1:p*4+3),a_planes(p*4+4)])
+       if(poly%NTS == 0) then
+          exit
+       end if
+    end do
+    a_volumes(1) = VOFtools_TOOLV3D_wrapper(poly)
+
+  end subroutine split_by_planes
+
+  subroutine voftools_prototype_prismBySplit(a_prism_pts, &
+       a_number_of_planes, a_planes, a_volumes, a_times) &
+       bind(C, name = "c_voftools_prototype_prismBySplit")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(2)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+
+    if(.not. prism_prototype%initialized) then
+       call make_prism(prism_prototype%poly, a_prism_pts)
+       call finish_prototype(prism_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(prism_prototype, poly, a_prism_pts)
+    call split_by_planes(poly, a_number_of_planes, a_planes, a_volumes)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_prismBySplit
+
+  subroutine voftools_prototype_unitCubeBySplit(a_cube_pts, &
+       a_number_of_planes, a_planes, a_volumes, a_times) &
+       bind(C, name = "c_voftools_prototype_unitCubeBySplit")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_cube_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(2)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+
+    if(.not. unit_cube_prototype%initialized) then
+       call make_cuboid(unit_cube_prototype%poly, a_cube_pts)
+       call finish_prototype(unit_cube_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(unit_cube_prototype, poly)
+    call set_cuboid_vertices(poly, a_cube_pts)
+    call split_by_planes(poly, a_number_of_planes, a_planes, a_volumes)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_unitCubeBySplit
+
+  subroutine voftools_prototype_triPrismBySplit(a_tri_prism_pts, &
+       a_number_of_planes, a_planes, a_volumes, a_times) &
+       bind(C, name = "c_voftools_prototype_triPrismBySplit")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_tri_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(2)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+
+    if(.not. tri_prism_prototype%initialized) then
+       call make_tri_prism(tri_prism_prototype%poly, a_tri_prism_pts)
+       call finish_prototype(tri_prism_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(tri_prism_prototype, poly, a_tri_prism_pts)
+    call split_by_planes(poly, a_number_of_planes, a_planes, a_volumes)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_triPrismBySplit
+
+  subroutine voftools_prototype_triHexBySplit(a_tri_hex_pts, &
+       a_number_of_planes, a_planes, a_volumes, a_times) &
+       bind(C, name = "c_voftools_prototype_triHexBySplit")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_tri_hex_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(2)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+
+    if(.not. tri_hex_prototype%initialized) then
+       call make_tri_hex(tri_hex_prototype%poly, a_tri_hex_pts)
+       call finish_prototype(tri_hex_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(tri_hex_prototype, poly, a_tri_hex_pts)
+    call split_by_planes(poly, a_number_of_planes, a_planes, a_volumes)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_triHexBySplit
+
+  subroutine voftools_prototype_symPrismBySplit(a_sym_prism_pts, &
+       a_number_of_planes, a_planes, a_volumes, a_times) &
+       bind(C, name = "c_voftools_prototype_symPrismBySplit")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_sym_prism_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(2)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+
+    if(.not. sym_prism_prototype%initialized) then
+       call make_sym_prism(sym_prism_prototype%poly, a_sym_prism_pts)
+       call finish_prototype(sym_prism_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(sym_prism_prototype, poly, a_sym_prism_pts)
+    call split_by_planes(poly, a_number_of_planes, a_planes, a_volumes)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_symPrismBySplit
+
+  subroutine voftools_prototype_symHexBySplit(a_sym_hex_pts, &
+       a_number_of_planes, a_planes, a_volumes, a_times) &
+       bind(C, name = "c_voftools_prototype_symHexBySplit")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_sym_hex_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(2)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+
+    if(.not. sym_hex_prototype%initialized) then
+       call make_sym_hex(sym_hex_prototype%poly, a_sym_hex_pts)
+       call finish_prototype(sym_hex_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(sym_hex_prototype, poly, a_sym_hex_pts)
+    call split_by_planes(poly, a_number_of_planes, a_planes, a_volumes)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_symHexBySplit
+
+  subroutine voftools_prototype_stelDodecahedronBySplit(a_stel_dodecahedron_pts, &
+       a_number_of_planes, a_planes, a_volumes, a_times) &
+       bind(C, name = "c_voftools_prototype_stelDodecahedronBySplit")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_stel_dodecahedron_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(2)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+
+    if(.not. stel_dodecahedron_prototype%initialized) then
+       call make_stellated_dodecahedron(stel_dodecahedron_prototype%poly, a_stel_dodecahedron_pts)
+       call finish_prototype(stel_dodecahedron_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(stel_dodecahedron_prototype, poly)
+    call split_by_planes(poly, a_number_of_planes, a_planes, a_volumes)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_stelDodecahedronBySplit
+
+  subroutine voftools_prototype_stelIcosahedronBySplit(a_stel_icosahedron_pts, &
+       a_number_of_planes, a_planes, a_volumes, a_times) &
+       bind(C, name = "c_voftools_prototype_stelIcosahedronBySplit")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_stel_icosahedron_pts(*)
+    integer(C_INT), intent(in), value :: a_number_of_planes
+    real(C_DOUBLE), intent(in) :: a_planes(*)
+    real(C_DOUBLE), intent(out) :: a_volumes(2)
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    type(polyhedron) :: poly
+
+    if(.not. stel_icosahedron_prototype%initialized) then
+       call make_stellated_icosahedron(stel_icosahedron_prototype%poly, a_stel_icosahedron_pts)
+       call finish_prototype(stel_icosahedron_prototype)
+    end if
+
+    start = omp_get_wtime()
+    call clone_prototype(stel_icosahedron_prototype, poly)
+    call split_by_planes(poly, a_number_of_planes, a_planes, a_volumes)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+  end subroutine voftools_prototype_stelIcosahedronBySplit
+
+!!!! Volume fraction matching, finding the plane distance that leaves a given !!!!
+!!!! volume fraction of the polyhedron below the plane                        !!!!
+
+  ! Find the distance of the plane with normal a_normal (IRL convention)
+  ! leaving a_volume_fraction of poly below it with ENFORV3D, timed in
+  ! a_times(1) together with the volume of poly it needs. The polyhedron
+  ! is then cut once by the plane found, timed in a_times(2), giving the
+  ! volume fraction achieved.
+  subroutine match_volume_fraction(poly, a_normal, a_volume_fraction, &
+       a_distance, a_achieved_volume_fraction, a_times)
+    implicit none
+
+    type(polyhedron), intent(inout) :: poly
+    real(C_DOUBLE), intent(in) :: a_normal(3)
+    real(C_DOUBLE), intent(in) :: a_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_distance
+    real(C_DOUBLE), intent(out) :: a_achieved_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    real(r8) :: start, end
+    real(r8) :: total_volume
+    type(polyhedron) :: cut_poly
+
+    cut_poly = poly
+
+    ! Multiply normal by -1.0 due to difference in convention.
+    ! Makes consistent with IRL convention
+    ! IRL finds the volume inside setDistanceToMatchVolumeFraction
+    start = omp_get_wtime()
+    total_volume = VOFtools_TOOLV3D_wrapper(poly)
+    a_distance = VOFtools_ENFORV3D_wrapper(poly, -a_normal, a_volume_fraction, total_volume)
+    end = omp_get_wtime()
+    a_times(1) = end - start
+
+    start = omp_get_wtime()
+    call VOFtools_INTE3D_wrapper(cut_poly, [-a_normal, a_distance])
+    a_achieved_volume_fraction = VOFtools_TOOLV3D_wrapper(cut_poly) / total_volume
+    end = omp_get_wtime()
+    a_times(2) = end - start
+
+  end subroutine match_volume_fraction
+
+  subroutine voftools_prototype_prismMatchVolumeFraction(a_prism_pts, &
+       a_normal, a_volume_fraction, a_distance, a_achieved_volume_fraction, a_times) &
+       bind(C, name = "c_voftools_prototype_prismMatchVolumeFraction")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_prism_pts(*)
+    real(C_DOUBLE), intent(in) :: a_normal(3)
+    real(C_DOUBLE), intent(in), value :: a_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_distance
+    real(C_DOUBLE), intent(out) :: a_achieved_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    type(polyhedron) :: poly
+
+    if(.not. prism_prototype%initialized) then
+       call make_prism(prism_prototype%poly, a_prism_pts)
+       call finish_prototype(prism_prototype)
+    end if
+
+    call clone_prototype(prism_prototype, poly, a_prism_pts)
+    call match_volume_fraction(poly, a_normal, a_volume_fraction, &
+         a_distance, a_achieved_volume_fraction, a_times)
+
+  end subroutine voftools_prototype_prismMatchVolumeFraction
+
+  subroutine voftools_prototype_unitCubeMatchVolumeFraction(a_cube_pts, &
+       a_normal, a_volume_fraction, a_distance, a_achieved_volume_fraction, a_times) &
+       bind(C, name = "c_voftools_prototype_unitCubeMatchVolumeFraction")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_cube_pts(*)
+    real(C_DOUBLE), intent(in) :: a_normal(3)
+    real(C_DOUBLE), intent(in), value :: a_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_distance
+    real(C_DOUBLE), intent(out) :: a_achieved_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    type(polyhedron) :: poly
+
+    if(.not. unit_cube_prototype%initialized) then
+       call make_cuboid(unit_cube_prototype%poly, a_cube_pts)
+       call finish_prototype(unit_cube_prototype)
+    end if
+
+    call clone_prototype(unit_cube_prototype, poly)
+    call set_cuboid_vertices(poly, a_cube_pts)
+    call match_volume_fraction(poly, a_normal, a_volume_fraction, &
+         a_distance, a_achieved_volume_fraction, a_times)
+
+  end subroutine voftools_prototype_unitCubeMatchVolumeFraction
+
+  subroutine voftools_prototype_triPrismMatchVolumeFraction(a_tri_prism_pts, &
+       a_normal, a_volume_fraction, a_distance, a_achieved_volume_fraction, a_times) &
+       bind(C, name = "c_voftools_prototype_triPrismMatchVolumeFraction")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_tri_prism_pts(*)
+    real(C_DOUBLE), intent(in) :: a_normal(3)
+    real(C_DOUBLE), intent(in), value :: a_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_distance
+    real(C_DOUBLE), intent(out) :: a_achieved_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    type(polyhedron) :: poly
+
+    if(.not. tri_prism_prototype%initialized) then
+       call make_tri_prism(tri_prism_prototype%poly, a_tri_prism_pts)
+       call finish_prototype(tri_prism_prototype)
+    end if
+
+    call clone_prototype(tri_prism_prototype, poly, a_tri_prism_pts)
+    call match_volume_fraction(poly, a_normal, a_volume_fraction, &
+         a_distance, a_achieved_volume_fraction, a_times)
+
+  end subroutine voftools_prototype_triPrismMatchVolumeFraction
+
+  subroutine voftools_prototype_triHexMatchVolumeFraction(a_tri_hex_pts, &
+       a_normal, a_volume_fraction, a_distance, a_achieved_volume_fraction, a_times) &
+       bind(C, name = "c_voftools_prototype_triHexMatchVolumeFraction")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_tri_hex_pts(*)
+    real(C_DOUBLE), intent(in) :: a_normal(3)
+    real(C_DOUBLE), intent(in), value :: a_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_distance
+    real(C_DOUBLE), intent(out) :: a_achieved_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    type(polyhedron) :: poly
+
+    if(.not. tri_hex_prototype%initialized) then
+       call make_tri_hex(tri_hex_prototype%poly, a_tri_hex_pts)
+       call finish_prototype(tri_hex_prototype)
+    end if
+
+    call clone_prototype(tri_hex_prototype, poly, a_tri_hex_pts)
+    call match_volume_fraction(poly, a_normal, a_volume_fraction, &
+         a_distance, a_achieved_volume_fraction, a_times)
+
+  end subroutine voftools_prototype_triHexMatchVolumeFraction
+
+  subroutine voftools_prototype_symPrismMatchVolumeFraction(a_sym_prism_pts, &
+       a_normal, a_volume_fraction, a_distance, a_achieved_volume_fraction, a_times) &
+       bind(C, name = "c_voftools_prototype_symPrismMatchVolumeFraction")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_sym_prism_pts(*)
+    real(C_DOUBLE), intent(in) :: a_normal(3)
+    real(C_DOUBLE), intent(in), value :: a_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_distance
+    real(C_DOUBLE), intent(out) :: a_achieved_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    type(polyhedron) :: poly
+
+    if(.not. sym_prism_prototype%initialized) then
+       call make_sym_prism(sym_prism_prototype%poly, a_sym_prism_pts)
+       call finish_prototype(sym_prism_prototype)
+    end if
+
+    call clone_prototype(sym_prism_prototype, poly, a_sym_prism_pts)
+    call match_volume_fraction(poly, a_normal, a_volume_fraction, &
+         a_distance, a_achieved_volume_fraction, a_times)
+
+  end subroutine voftools_prototype_symPrismMatchVolumeFraction
+
+  subroutine voftools_prototype_symHexMatchVolumeFraction(a_sym_hex_pts, &
+       a_normal, a_volume_fraction, a_distance, a_achieved_volume_fraction, a_times) &
+       bind(C, name = "c_voftools_prototype_symHexMatchVolumeFraction")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_sym_hex_pts(*)
+    real(C_DOUBLE), intent(in) :: a_normal(3)
+    real(C_DOUBLE), intent(in), value :: a_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_distance
+    real(C_DOUBLE), intent(out) :: a_achieved_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    type(polyhedron) :: poly
+
+    if(.not. sym_hex_prototype%initialized) then
+       call make_sym_hex(sym_hex_prototype%poly, a_sym_hex_pts)
+       call finish_prototype(sym_hex_prototype)
+    end if
+
+    call clone_prototype(sym_hex_prototype, poly, a_sym_hex_pts)
+    call match_volume_fraction(poly, a_normal, a_volume_fraction, &
+         a_distance, a_achieved_volume_fraction, a_times)
+
+  end subroutine voftools_prototype_symHexMatchVolumeFraction
+
+  subroutine voftools_prototype_stelDodecahedronMatchVolumeFraction(a_stel_dodecahedron_pts, &
+       a_normal, a_volume_fraction, a_distance, a_achieved_volume_fraction, a_times) &
+       bind(C, name = "c_voftools_prototype_stelDodecahedronMatchVolumeFraction")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_stel_dodecahedron_pts(*)
+    real(C_DOUBLE), intent(in) :: a_normal(3)
+    real(C_DOUBLE), intent(in), value :: a_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_distance
+    real(C_DOUBLE), intent(out) :: a_achieved_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    type(polyhedron) :: poly
+
+    if(.not. stel_dodecahedron_prototype%initialized) then
+       call make_stellated_dodecahedron(stel_dodecahedron_prototype%poly, a_stel_dodecahedron_pts)
+       call finish_prototype(stel_dodecahedron_prototype)
+    end if
+
+    call clone_prototype(stel_dodecahedron_prototype, poly)
+    call match_volume_fraction(poly, a_normal, a_volume_fraction, &
+         a_distance, a_achieved_volume_fraction, a_times)
+
+  end subroutine voftools_prototype_stelDodecahedronMatchVolumeFraction
+
+  subroutine voftools_prototype_stelIcosahedronMatchVolumeFraction(a_stel_icosahedron_pts, &
+       a_normal, a_volume_fraction, a_distance, a_achieved_volume_fraction, a_times) &
+       bind(C, name = "c_voftools_prototype_stelIcosahedronMatchVolumeFraction")
+
+    implicit none
+
+    real(C_DOUBLE), intent(in) :: a_stel_icosahedron_pts(*)
+    real(C_DOUBLE), intent(in) :: a_normal(3)
+    real(C_DOUBLE), intent(in), value :: a_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_distance
+    real(C_DOUBLE), intent(out) :: a_achieved_volume_fraction
+    real(C_DOUBLE), intent(out) :: a_times(*)
+
+    type(polyhedron) :: poly
+
+    if(.not. stel_icosahedron_prototype%initialized) then
+       call make_stellated_icosahedron(stel_icosahedron_prototype%poly, a_stel_icosahedron_pts)
+       call finish_prototype(stel_icosahedron_prototype)
+    end if
+
+    call clone_prototype(stel_icosahedron_prototype, poly)
+    call match_volume_fraction(poly, a_normal, a_volume_fraction, &
+         a_distance, a_achieved_volume_fraction, a_times)
+
+  end subroutine voftools_prototype_stelIcosahedronMatchVolumeFraction
+
+end module VOFtools_prototype_mod
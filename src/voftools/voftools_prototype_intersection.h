@@ -0,0 +1,259 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// C interface to the same VOFTools intersections as in
+// voftools_intersection.h, except each polyhedron is cloned from
+// a prototype built on the first call. The face connectivity and
+// normals of the prototype are reused, so only vertex locations are
+// set per call, which is valid since the polyhedra of each shape
+// only differ by translation. This separates the cost of VOFTools
+// setup (make_* in voftools_wrapper.f90) from its clipping.
+
+#ifndef SRC_VOFTOOLS_VOFTOOLS_PROTOTYPE_INTERSECTION_H_
+#define SRC_VOFTOOLS_VOFTOOLS_PROTOTYPE_INTERSECTION_H_
+
+// Perform intersection of plane(s) with a Triangular Prism
+void c_voftools_prototype_prismByPlanes(const double *a_prism_pts,
+                                        const int a_number_of_planes,
+                                        const double *a_planes,
+                                        double *a_volume, double *a_times);
+
+// Perform intersection of plane(s) with a Unit Cube
+void c_voftools_prototype_unitCubeByPlanes(const double *a_cube_pts,
+                                           const int a_number_of_planes,
+                                           const double *a_planes,
+                                           double *a_volume, double *a_times);
+
+// Perform intersection of plane(s) with a Triangulated Triangular Prism
+void c_voftools_prototype_triPrismByPlanes(const double *a_tri_prism_pts,
+                                           const int a_number_of_planes,
+                                           const double *a_planes,
+                                           double *a_volume, double *a_times);
+
+// Perform intersection of plane(s) with a Triangulated Hexahedron
+void c_voftools_prototype_triHexByPlanes(const double *a_tri_hex_pts,
+                                         const int a_number_of_planes,
+                                         const double *a_planes,
+                                         double *a_volume, double *a_times);
+
+// Perform intersection of plane(s) with a Symmetric Triangular Prism
+void c_voftools_prototype_symPrismByPlanes(const double *a_sym_prism_pts,
+                                           const int a_number_of_planes,
+                                           const double *a_planes,
+                                           double *a_volume, double *a_times);
+
+// Perform intersection of plane(s) with a Symmetric Hexahedron
+void c_voftools_prototype_symHexByPlanes(const double *a_sym_hex_pts,
+                                         const int a_number_of_planes,
+                                         const double *a_planes,
+                                         double *a_volume, double *a_times);
+
+// Perform intersection of plane(s) with a Stellated Dodecahedron
+void c_voftools_prototype_stelDodecahedronByPlanes(const double *a_stel_dodecahedron_pts,
+                                                   const int a_number_of_planes,
+                                                   const double *a_planes,
+                                                   double *a_volume,
+                                                   double *a_times);
+
+// Perform intersection of plane(s) with a Stellated Icosahedron
+void c_voftools_prototype_stelIcosahedronByPlanes(const double *a_stel_icosahedron_pts,
+                                                  const int a_number_of_planes,
+                                                  const double *a_planes,
+                                                  double *a_volume,
+                                                  double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void c_voftools_prototype_prismByPlanes_total(const double *a_prism_pts,
+                                              const int a_number_of_planes,
+                                              const double *a_planes,
+                                              double *a_volume,
+                                              double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void c_voftools_prototype_unitCubeByPlanes_total(const double *a_cube_pts,
+                                                 const int a_number_of_planes,
+                                                 const double *a_planes,
+                                                 double *a_volume,
+                                                 double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void c_voftools_prototype_triPrismByPlanes_total(const double *a_tri_prism_pts,
+                                                 const int a_number_of_planes,
+                                                 const double *a_planes,
+                                                 double *a_volume,
+                                                 double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void c_voftools_prototype_triHexByPlanes_total(const double *a_tri_hex_pts,
+                                               const int a_number_of_planes,
+                                               const double *a_planes,
+                                               double *a_volume,
+                                               double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void c_voftools_prototype_symPrismByPlanes_total(const double *a_sym_prism_pts,
+                                                 const int a_number_of_planes,
+                                                 const double *a_planes,
+                                                 double *a_volume,
+                                                 double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void c_voftools_prototype_symHexByPlanes_total(const double *a_sym_hex_pts,
+                                               const int a_number_of_planes,
+                                               const double *a_planes,
+                                               double *a_volume,
+                                               double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void c_voftools_prototype_stelDodecahedronByPlanes_total(const double *a_stel_dodecahedron_pts,
+                                                         const int a_number_of_planes,
+                                                         const double *a_planes,
+                                                         double *a_volume,
+                                                         double *a_times);
+
+// Same function as equivalent above, but only total timed for less overhead
+void c_voftools_prototype_stelIcosahedronByPlanes_total(const double *a_stel_icosahedron_pts,
+                                                        const int a_number_of_planes,
+                                                        const double *a_planes,
+                                                        double *a_volume,
+                                                        double *a_times);
+
+// Split functions. Each plane is cut in turn, and since VOFTools only
+// keeps the part below a plane, the part above is clipped from a copy of
+// the polyhedron by the flipped plane before each cut. a_volumes[0] is the volume below every plane and
+// a_volumes[1] the rest of the polyhedron. Only the total is timed, in
+// a_times[0].
+// Split a Triangular Prism by plane(s)
+void c_voftools_prototype_prismBySplit(const double *a_prism_pts,
+                                       const int a_number_of_planes,
+                                       const double *a_planes,
+                                       double *a_volumes,
+                                       double *a_times);
+
+// Split a Unit Cube by plane(s)
+void c_voftools_prototype_unitCubeBySplit(const double *a_cube_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes,
+                                          double *a_volumes,
+                                          double *a_times);
+
+// Split a Triangulated Triangular Prism by plane(s)
+void c_voftools_prototype_triPrismBySplit(const double *a_tri_prism_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes,
+                                          double *a_volumes,
+                                          double *a_times);
+
+// Split a Triangulated Hexahedron by plane(s)
+void c_voftools_prototype_triHexBySplit(const double *a_tri_hex_pts,
+                                        const int a_number_of_planes,
+                                        const double *a_planes,
+                                        double *a_volumes,
+                                        double *a_times);
+
+// Split a Symmetric Triangular Prism by plane(s)
+void c_voftools_prototype_symPrismBySplit(const double *a_sym_prism_pts,
+                                          const int a_number_of_planes,
+                                          const double *a_planes,
+                                          double *a_volumes,
+                                          double *a_times);
+
+// Split a Symmetric Hexahedron by plane(s)
+void c_voftools_prototype_symHexBySplit(const double *a_sym_hex_pts,
+                                        const int a_number_of_planes,
+                                        const double *a_planes,
+                                        double *a_volumes,
+                                        double *a_times);
+
+// Split a Stellated Dodecahedron by plane(s)
+void c_voftools_prototype_stelDodecahedronBySplit(const double *a_stel_dodecahedron_pts,
+                                                  const int a_number_of_planes,
+                                                  const double *a_planes,
+                                                  double *a_volumes,
+                                                  double *a_times);
+
+// Split a Stellated Icosahedron by plane(s)
+void c_voftools_prototype_stelIcosahedronBySplit(const double *a_stel_icosahedron_pts,
+                                                 const int a_number_of_planes,
+                                                 const double *a_planes,
+                                                 double *a_volumes,
+                                                 double *a_times);
+
+// Volume fraction matching functions. The distance of the plane with
+// normal a_normal (IRL convention) leaving a_volume_fraction of the
+// polyhedron below it is found with ENFORV3D and returned in a_distance,
+// with the search and the volume of the polyhedron it needs timed in
+// a_times[0], as IRL finds that volume inside its search. The polyhedron is then cut
+// once by that plane, timed in a_times[1], and the volume fraction below
+// it returned in a_achieved_volume_fraction.
+// Match a volume fraction in a Triangular Prism
+void c_voftools_prototype_prismMatchVolumeFraction(const double *a_prism_pts,
+                                                   const double *a_normal,
+                                                   const double a_volume_fraction,
+                                                   double *a_distance,
+                                                   double *a_achieved_volume_fraction,
+                                                   double *a_times);
+
+// Match a volume fraction in a Unit Cube
+void c_voftools_prototype_unitCubeMatchVolumeFraction(const double *a_cube_pts,
+                                                      const double *a_normal,
+                                                      const double a_volume_fraction,
+                                                      double *a_distance,
+                                                      double *a_achieved_volume_fraction,
+                                                      double *a_times);
+
+// Match a volume fraction in a Triangulated Triangular Prism
+void c_voftools_prototype_triPrismMatchVolumeFraction(const double *a_tri_prism_pts,
+                                                      const double *a_normal,
+                                                      const double a_volume_fraction,
+                                                      double *a_distance,
+                                                      double *a_achieved_volume_fraction,
+                                                      double *a_times);
+
+// Match a volume fraction in a Triangulated Hexahedron
+void c_voftools_prototype_triHexMatchVolumeFraction(const double *a_tri_hex_pts,
+                                                    const double *a_normal,
+                                                    const double a_volume_fraction,
+                                                    double *a_distance,
+                                                    double *a_achieved_volume_fraction,
+                                                    double *a_times);
+
+// Match a volume fraction in a Symmetric Triangular Prism
+void c_voftools_prototype_symPrismMatchVolumeFraction(const double *a_sym_prism_pts,
+                                                      const double *a_normal,
+                                                      const double a_volume_fraction,
+                                                      double *a_distance,
+                                                      double *a_achieved_volume_fraction,
+                                                      double *a_times);
+
+// Match a volume fraction in a Symmetric Hexahedron
+void c_voftools_prototype_symHexMatchVolumeFraction(const double *a_sym_hex_pts,
+                                                    const double *a_normal,
+                                                    const double a_volume_fraction,
+                                                    double *a_distance,
+                                                    double *a_achieved_volume_fraction,
+                                                    double *a_times);
+
+// Match a volume fraction in a Stellated Dodecahedron
+void c_voftools_prototype_stelDodecahedronMatchVolumeFraction(const double *a_stel_dodecahedron_pts,
+                                                              const double *a_normal,
+                                                              const double a_volume_fraction,
+                                                              double *a_distance,
+                                                              double *a_achieved_volume_fraction,
+                                                              double *a_times);
+
+// Match a volume fraction in a Stellated Icosahedron
+void c_voftools_prototype_stelIcosahedronMatchVolumeFraction(const double *a_stel_icosahedron_pts,
+                                                             const double *a_normal,
+                                                             const double a_volume_fraction,
+                                                             double *a_distance,
+                                                             double *a_achieved_volume_fraction,
+                                                             double *a_times);
+
+#endif // SRC_VOFTOOLS_VOFTOOLS_PROTOTYPE_INTERSECTION_H_
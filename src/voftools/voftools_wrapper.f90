@@ -1,9 +1,7 @@
 module VOFtools_wrapper
   use, intrinsic :: iso_fortran_env, only: r8 => REAL64
   use iso_c_binding
-
-  integer, parameter :: NS = 100 ! Value should match that in VOFTools/dim.h
-  integer, parameter :: NV = 140 ! Value should match that in VOFTools/dim.h
+  use VOFtools_dim, only: NS, NV
   
   type polyhedron
      integer, public :: NTS ! Number of faces
@@ -23,6 +21,14 @@ contains
 
     integer :: ICONTN, ICONTP
 
+    ! VOFTools does not check its storage bounds, so stop before clipping
+    ! if the configured NS/NV could be outgrown. A plane adds at most one
+    ! face, and at most one vertex per edge, with the edges of a closed
+    ! polyhedron numbering NTV + NTS - 2 from Euler's formula.
+    if(poly%NTS + 1 > NS .or. poly%NTP + poly%NTV + poly%NTS - 2 > NV) then
+       error stop "Polyhedron may exceed VOFTOOLS_NS/VOFTOOLS_NV storage"
+    end if
+
     call INTE3D(plane(4),ICONTN,ICONTP,poly%IPV,poly%NIPV,poly%NTP,poly%NTS,poly%NTV, &
          poly%VERTP,plane(1),poly%NORMAL(:,1),plane(2),poly%NORMAL(:,2),plane(3),poly%NORMAL(:,3))
     
@@ -46,6 +52,21 @@ contains
     
   end function VOFtools_TOOLV3D_wrapper
 
+  ! Find the constant C of the plane with normal (normal(1:3), C) that
+  ! leaves a_volume_fraction of the polyhedron, of volume a_total_volume,
+  ! on the side kept by INTE3D.
+  function VOFtools_ENFORV3D_wrapper(poly, normal, a_volume_fraction, a_total_volume) result(c)
+    type(polyhedron), intent(inout) :: poly
+    real(r8), intent(in) :: normal(3)
+    real(r8), intent(in) :: a_volume_fraction
+    real(r8), intent(in) :: a_total_volume
+    real(r8) :: c
+
+    call ENFORV3D(c,poly%IPV,poly%NIPV,poly%NTP,poly%NTS,poly%NTV,a_volume_fraction,poly%VERTP, &
+         a_total_volume,normal(1),poly%NORMAL(:,1),normal(2),poly%NORMAL(:,2),normal(3),poly%NORMAL(:,3))
+
+  end function VOFtools_ENFORV3D_wrapper
+
   pure function cross_product(vector1, vector2) result(cp_value)
     implicit none
     
@@ -132,14 +153,7 @@ contains
     poly%IPV(6,1:4) = [8,7,6,5]        
 
     ! Copy over vertex locations
-    poly%VERTP(1,:) = [a_cuboid_pts(4), a_cuboid_pts(2), a_cuboid_pts(3)]
-    poly%VERTP(2,:) = [a_cuboid_pts(4), a_cuboid_pts(5), a_cuboid_pts(3)]
-    poly%VERTP(3,:) = [a_cuboid_pts(4), a_cuboid_pts(5), a_cuboid_pts(6)]
-    poly%VERTP(4,:) = [a_cuboid_pts(4), a_cuboid_pts(2), a_cuboid_pts(6)]
-    poly%VERTP(5,:) = [a_cuboid_pts(1), a_cuboid_pts(2), a_cuboid_pts(3)]
-    poly%VERTP(6,:) = [a_cuboid_pts(1), a_cuboid_pts(5), a_cuboid_pts(3)]
-    poly%VERTP(7,:) = [a_cuboid_pts(1), a_cuboid_pts(5), a_cuboid_pts(6)]
-    poly%VERTP(8,:) = [a_cuboid_pts(1), a_cuboid_pts(2), a_cuboid_pts(6)]        
+    call set_cuboid_vertices(poly, a_cuboid_pts)
 
     ! Calculate and set normal for each face
     poly%NORMAL(1,:) = [1.0, 0.0, 0.0]
@@ -151,6 +165,25 @@ contains
 
   end subroutine make_cuboid
 
+  ! Place the 8 cuboid vertices from its bounds, given as
+  ! min X/Y/Z followed by max X/Y/Z.
+  subroutine set_cuboid_vertices(poly, a_cuboid_pts)
+    implicit none
+
+    type(polyhedron), intent(inout) :: poly
+    real(C_DOUBLE), intent(in) :: a_cuboid_pts(6)
+
+    poly%VERTP(1,:) = [a_cuboid_pts(4), a_cuboid_pts(2), a_cuboid_pts(3)]
+    poly%VERTP(2,:) = [a_cuboid_pts(4), a_cuboid_pts(5), a_cuboid_pts(3)]
+    poly%VERTP(3,:) = [a_cuboid_pts(4), a_cuboid_pts(5), a_cuboid_pts(6)]
+    poly%VERTP(4,:) = [a_cuboid_pts(4), a_cuboid_pts(2), a_cuboid_pts(6)]
+    poly%VERTP(5,:) = [a_cuboid_pts(1), a_cuboid_pts(2), a_cuboid_pts(3)]
+    poly%VERTP(6,:) = [a_cuboid_pts(1), a_cuboid_pts(5), a_cuboid_pts(3)]
+    poly%VERTP(7,:) = [a_cuboid_pts(1), a_cuboid_pts(5), a_cuboid_pts(6)]
+    poly%VERTP(8,:) = [a_cuboid_pts(1), a_cuboid_pts(2), a_cuboid_pts(6)]
+
+  end subroutine set_cuboid_vertices
+
   subroutine make_tri_prism(poly, a_pts)
 
     type(polyhedron), intent(out) :: poly
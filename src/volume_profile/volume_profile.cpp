@@ -0,0 +1,155 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/volume_profile/volume_profile.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace {
+
+// Volume of a_polyhedron below the plane a_normal.x = a_distance
+double clipVolume(const VertexGraphPolyhedron<double>& a_polyhedron,
+                  const double* a_normal, const double a_distance) {
+  VertexGraphPolyhedron<double> clipped = a_polyhedron;
+  const std::array<double, 4> plane{
+      {a_normal[0], a_normal[1], a_normal[2], a_distance}};
+  clipped.clip(plane.data());
+  return clipped.calculateVolume();
+}
+
+// Cubic in s with coefficients a_coefficients, lowest order first
+double evaluateCubic(const std::array<double, 4>& a_coefficients,
+                     const double a_s) {
+  return a_coefficients[0] +
+         a_s * (a_coefficients[1] +
+                a_s * (a_coefficients[2] + a_s * a_coefficients[3]));
+}
+
+}  // namespace
+
+void VolumeProfile::build(const VertexGraphPolyhedron<double>& a_polyhedron,
+                          const double* a_normal) {
+  const int number_of_vertices = a_polyhedron.getNumberOfVertices();
+  breakpoints_m.resize(number_of_vertices);
+  for (int v = 0; v < number_of_vertices; ++v) {
+    const auto& location = a_polyhedron.getVertexLocation(v);
+    breakpoints_m[v] = a_normal[0] * location[0] +
+                       a_normal[1] * location[1] +
+                       a_normal[2] * location[2];
+  }
+  std::sort(breakpoints_m.begin(), breakpoints_m.end());
+
+  // Merge projections closer than round-off, which includes the
+  // coincident copies of vertices with more than three edges
+  const double tolerance =
+      64.0 * DBL_EPSILON *
+      std::max(std::fabs(breakpoints_m.front()),
+               std::max(std::fabs(breakpoints_m.back()),
+                        breakpoints_m.back() - breakpoints_m.front()));
+  const double highest = breakpoints_m.back();
+  int number_of_breakpoints = 1;
+  for (int v = 1; v < number_of_vertices; ++v) {
+    if (breakpoints_m[v] - breakpoints_m[number_of_breakpoints - 1] >
+        tolerance) {
+      breakpoints_m[number_of_breakpoints] = breakpoints_m[v];
+      ++number_of_breakpoints;
+    }
+  }
+  breakpoints_m[number_of_breakpoints - 1] = highest;
+  breakpoints_m.resize(number_of_breakpoints);
+
+  const int number_of_intervals = number_of_breakpoints - 1;
+  volumes_m.resize(number_of_breakpoints);
+  scales_m.resize(number_of_intervals);
+  coefficients_m.resize(number_of_intervals);
+  volumes_m[0] = 0.0;
+  volumes_m[number_of_intervals] = a_polyhedron.calculateVolume();
+  for (int i = 1; i < number_of_intervals; ++i) {
+    volumes_m[i] = clipVolume(a_polyhedron, a_normal, breakpoints_m[i]);
+  }
+
+  // Newton form of the cubic through s = 0, 1, 2, 3, expanded in s
+  for (int i = 0; i < number_of_intervals; ++i) {
+    const double width = breakpoints_m[i + 1] - breakpoints_m[i];
+    const double v0 = volumes_m[i];
+    const double v1 = clipVolume(a_polyhedron, a_normal,
+                                 breakpoints_m[i] + width / 3.0);
+    const double v2 = clipVolume(a_polyhedron, a_normal,
+                                 breakpoints_m[i] + 2.0 * width / 3.0);
+    const double v3 = volumes_m[i + 1];
+    const double first = v1 - v0;
+    const double second = v2 - 2.0 * v1 + v0;
+    const double third = v3 - 3.0 * v2 + 3.0 * v1 - v0;
+    scales_m[i] = 3.0 / width;
+    coefficients_m[i] = {{v0, first - 0.5 * second + third / 3.0,
+                          0.5 * second - 0.5 * third, third / 6.0}};
+  }
+}
+
+double VolumeProfile::calculateVolume(const double a_distance) const {
+  if (a_distance <= breakpoints_m.front()) {
+    return 0.0;
+  }
+  if (a_distance >= breakpoints_m.back()) {
+    return volumes_m.back();
+  }
+  const int i = static_cast<int>(std::upper_bound(breakpoints_m.begin(),
+                                                  breakpoints_m.end(),
+                                                  a_distance) -
+                                 breakpoints_m.begin()) -
+                1;
+  return evaluateCubic(coefficients_m[i],
+                       (a_distance - breakpoints_m[i]) * scales_m[i]);
+}
+
+double VolumeProfile::findDistance(const double a_volume) const {
+  if (a_volume <= 0.0) {
+    return breakpoints_m.front();
+  }
+  if (a_volume >= volumes_m.back()) {
+    return breakpoints_m.back();
+  }
+  const int i = std::min(
+      static_cast<int>(std::upper_bound(volumes_m.begin(), volumes_m.end(),
+                                        a_volume) -
+                       volumes_m.begin()) -
+          1,
+      getNumberOfIntervals() - 1);
+  const auto& coefficients = coefficients_m[i];
+
+  // Newton's method on the cubic, which increases over s in [0,3],
+  // falling back to bisection whenever a step leaves the bracket
+  double lower = 0.0;
+  double upper = 3.0;
+  const double span = volumes_m[i + 1] - volumes_m[i];
+  double s = span > 0.0 ? 3.0 * (a_volume - volumes_m[i]) / span : 0.0;
+  for (int iteration = 0; iteration < 64; ++iteration) {
+    const double residual = evaluateCubic(coefficients, s) - a_volume;
+    if (residual == 0.0) {
+      break;
+    }
+    if (residual < 0.0) {
+      lower = s;
+    } else {
+      upper = s;
+    }
+    const double slope =
+        coefficients[1] +
+        s * (2.0 * coefficients[2] + 3.0 * s * coefficients[3]);
+    double next = slope > 0.0 ? s - residual / slope : 0.5 * (lower + upper);
+    if (next <= lower || next >= upper) {
+      next = 0.5 * (lower + upper);
+    }
+    if (std::fabs(next - s) <= 4.0 * DBL_EPSILON * 3.0) {
+      s = next;
+      break;
+    }
+    s = next;
+  }
+  return breakpoints_m[i] + s / scales_m[i];
+}
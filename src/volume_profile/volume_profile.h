@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Volume of a polyhedron below the plane n.x = d as a function of d, for
+// one fixed normal n. Between two consecutive vertex projections n.x_v the
+// cross-section of the polyhedron changes linearly along each edge, so
+// its area is quadratic and the volume below the plane a cubic in d. The
+// profile sorts the vertex projections once, and fits the cubic of each
+// interval exactly from four clips of the polyhedron (two shared with the
+// neighboring intervals). Afterwards, the volume below any plane of that
+// normal, and the distance leaving any given volume below the plane, are
+// found with a binary search over the intervals and the evaluation (or
+// root) of a single cubic, without clipping the polyhedron again.
+
+#ifndef SRC_VOLUME_PROFILE_VOLUME_PROFILE_H_
+#define SRC_VOLUME_PROFILE_VOLUME_PROFILE_H_
+
+#include <array>
+#include <vector>
+
+#include "src/vertex_clip/vertex_graph_polyhedron.h"
+
+class VolumeProfile {
+ public:
+  VolumeProfile(void) = default;
+
+  // Build the profile of a_polyhedron along the unit normal a_normal,
+  // reusing the storage of any earlier profile.
+  void build(const VertexGraphPolyhedron<double>& a_polyhedron,
+             const double* a_normal);
+
+  // Volume of the polyhedron below the plane a_normal.x = a_distance
+  double calculateVolume(const double a_distance) const;
+
+  // Distance of the plane leaving a_volume of the polyhedron below it,
+  // with a_volume clamped to [0, getTotalVolume()]
+  double findDistance(const double a_volume) const;
+
+  double getTotalVolume(void) const { return volumes_m.back(); }
+
+  int getNumberOfIntervals(void) const {
+    return static_cast<int>(coefficients_m.size());
+  }
+
+ private:
+  // Vertex projections, increasing, with coincident ones merged
+  std::vector<double> breakpoints_m;
+  // Volume below each breakpoint
+  std::vector<double> volumes_m;
+  // 3 / width of each interval, mapping it onto s in [0,3]
+  std::vector<double> scales_m;
+  // Cubic of each interval in s, lowest order first
+  std::vector<std::array<double, 4>> coefficients_m;
+};
+
+#endif  // SRC_VOLUME_PROFILE_VOLUME_PROFILE_H_
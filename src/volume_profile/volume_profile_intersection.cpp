@@ -0,0 +1,226 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "src/volume_profile/volume_profile_intersection.h"
+
+#include <omp.h>
+
+#include <array>
+#include <cstddef>
+
+#include "src/vertex_clip/cube_pts.h"
+#include "src/vertex_clip/vertex_clip_shapes.h"
+#include "src/vertex_clip/vertex_graph_polyhedron.h"
+#include "src/volume_profile/volume_profile.h"
+
+namespace {
+
+template <std::size_t kFaceFlat, std::size_t kFaces>
+void sweepByPlanes(const double* a_pts, const int a_number_of_pts,
+                   const std::array<int, kFaceFlat>& a_faces,
+                   const std::array<int, kFaces>& a_face_sizes,
+                   const double* a_normal, const int a_number_of_distances,
+                   const double* a_distances, double* a_volumes,
+                   double* a_times) {
+  VertexGraphPolyhedron<double> poly;
+  poly.initialize(a_pts, a_number_of_pts, a_faces.data(), a_face_sizes.data(),
+                  static_cast<int>(kFaces));
+
+  double start = omp_get_wtime();
+  VolumeProfile profile;
+  profile.build(poly, a_normal);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+
+  start = omp_get_wtime();
+  for (int n = 0; n < a_number_of_distances; ++n) {
+    a_volumes[n] = profile.calculateVolume(a_distances[n]);
+  }
+  end = omp_get_wtime();
+  a_times[1] = end - start;
+}
+
+template <std::size_t kFaceFlat, std::size_t kFaces>
+void matchVolumeFraction(const double* a_pts, const int a_number_of_pts,
+                         const std::array<int, kFaceFlat>& a_faces,
+                         const std::array<int, kFaces>& a_face_sizes,
+                         const double* a_normal,
+                         const double a_volume_fraction, double* a_distance,
+                         double* a_achieved_volume_fraction,
+                         double* a_times) {
+  VertexGraphPolyhedron<double> poly;
+  poly.initialize(a_pts, a_number_of_pts, a_faces.data(), a_face_sizes.data(),
+                  static_cast<int>(kFaces));
+
+  double start = omp_get_wtime();
+  VolumeProfile profile;
+  profile.build(poly, a_normal);
+  const double total_volume = profile.getTotalVolume();
+  *a_distance = profile.findDistance(a_volume_fraction * total_volume);
+  double end = omp_get_wtime();
+  a_times[0] = end - start;
+
+  start = omp_get_wtime();
+  const std::array<double, 4> plane{
+      {a_normal[0], a_normal[1], a_normal[2], *a_distance}};
+  poly.clip(plane.data());
+  *a_achieved_volume_fraction = poly.calculateVolume() / total_volume;
+  end = omp_get_wtime();
+  a_times[1] = end - start;
+}
+
+}  // namespace
+
+void volume_profile_prismBySweep(const double* a_prism_pts,
+                                 const double* a_normal,
+                                 const int a_number_of_distances,
+                                 const double* a_distances, double* a_volumes,
+                                 double* a_times) {
+  sweepByPlanes(a_prism_pts, 6, prism_faces, prism_face_sizes, a_normal,
+                a_number_of_distances, a_distances, a_volumes, a_times);
+}
+
+void volume_profile_unitCubeBySweep(const double* a_cube_pts,
+                                    const double* a_normal,
+                                    const int a_number_of_distances,
+                                    const double* a_distances,
+                                    double* a_volumes, double* a_times) {
+  const auto cube_pts = getCubePts(a_cube_pts);
+  sweepByPlanes(cube_pts.data(), 8, cube_faces, cube_face_sizes, a_normal,
+                a_number_of_distances, a_distances, a_volumes, a_times);
+}
+
+void volume_profile_triPrismBySweep(const double* a_tri_prism_pts,
+                                    const double* a_normal,
+                                    const int a_number_of_distances,
+                                    const double* a_distances,
+                                    double* a_volumes, double* a_times) {
+  sweepByPlanes(a_tri_prism_pts, 6, tri_prism_faces, tri_prism_face_sizes,
+                a_normal, a_number_of_distances, a_distances, a_volumes,
+                a_times);
+}
+
+void volume_profile_triHexBySweep(const double* a_tri_hex_pts,
+                                  const double* a_normal,
+                                  const int a_number_of_distances,
+                                  const double* a_distances, double* a_volumes,
+                                  double* a_times) {
+  sweepByPlanes(a_tri_hex_pts, 8, tri_hex_faces, tri_hex_face_sizes, a_normal,
+                a_number_of_distances, a_distances, a_volumes, a_times);
+}
+
+void volume_profile_symPrismBySweep(const double* a_sym_prism_pts,
+                                    const double* a_normal,
+                                    const int a_number_of_distances,
+                                    const double* a_distances,
+                                    double* a_volumes, double* a_times) {
+  sweepByPlanes(a_sym_prism_pts, 11, sym_prism_faces, sym_prism_face_sizes,
+                a_normal, a_number_of_distances, a_distances, a_volumes,
+                a_times);
+}
+
+void volume_profile_symHexBySweep(const double* a_sym_hex_pts,
+                                  const double* a_normal,
+                                  const int a_number_of_distances,
+                                  const double* a_distances, double* a_volumes,
+                                  double* a_times) {
+  sweepByPlanes(a_sym_hex_pts, 14, sym_hex_faces, sym_hex_face_sizes, a_normal,
+                a_number_of_distances, a_distances, a_volumes, a_times);
+}
+
+void volume_profile_stelDodecahedronBySweep(
+    const double* a_stel_dodecahedron_pts, const double* a_normal,
+    const int a_number_of_distances, const double* a_distances,
+    double* a_volumes, double* a_times) {
+  sweepByPlanes(a_stel_dodecahedron_pts, 32, stel_dodecahedron_faces,
+                stel_dodecahedron_face_sizes, a_normal, a_number_of_distances,
+                a_distances, a_volumes, a_times);
+}
+
+void volume_profile_stelIcosahedronBySweep(const double* a_stel_icosahedron_pts,
+                                           const double* a_normal,
+                                           const int a_number_of_distances,
+                                           const double* a_distances,
+                                           double* a_volumes, double* a_times) {
+  sweepByPlanes(a_stel_icosahedron_pts, 32, stel_icosahedron_faces,
+                stel_icosahedron_face_sizes, a_normal, a_number_of_distances,
+                a_distances, a_volumes, a_times);
+}
+
+void volume_profile_prismMatchVolumeFraction(const double* a_prism_pts,
+                                             const double* a_normal,
+                                             const double a_volume_fraction,
+                                             double* a_distance,
+                                             double* a_achieved_volume_fraction,
+                                             double* a_times) {
+  matchVolumeFraction(a_prism_pts, 6, prism_faces, prism_face_sizes, a_normal,
+                      a_volume_fraction, a_distance, a_achieved_volume_fraction,
+                      a_times);
+}
+
+void volume_profile_unitCubeMatchVolumeFraction(
+    const double* a_cube_pts, const double* a_normal,
+    const double a_volume_fraction, double* a_distance,
+    double* a_achieved_volume_fraction, double* a_times) {
+  const auto cube_pts = getCubePts(a_cube_pts);
+  matchVolumeFraction(cube_pts.data(), 8, cube_faces, cube_face_sizes, a_normal,
+                      a_volume_fraction, a_distance, a_achieved_volume_fraction,
+                      a_times);
+}
+
+void volume_profile_triPrismMatchVolumeFraction(
+    const double* a_tri_prism_pts, const double* a_normal,
+    const double a_volume_fraction, double* a_distance,
+    double* a_achieved_volume_fraction, double* a_times) {
+  matchVolumeFraction(a_tri_prism_pts, 6, tri_prism_faces, tri_prism_face_sizes,
+                      a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void volume_profile_triHexMatchVolumeFraction(
+    const double* a_tri_hex_pts, const double* a_normal,
+    const double a_volume_fraction, double* a_distance,
+    double* a_achieved_volume_fraction, double* a_times) {
+  matchVolumeFraction(a_tri_hex_pts, 8, tri_hex_faces, tri_hex_face_sizes,
+                      a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void volume_profile_symPrismMatchVolumeFraction(
+    const double* a_sym_prism_pts, const double* a_normal,
+    const double a_volume_fraction, double* a_distance,
+    double* a_achieved_volume_fraction, double* a_times) {
+  matchVolumeFraction(a_sym_prism_pts, 11, sym_prism_faces,
+                      sym_prism_face_sizes, a_normal, a_volume_fraction,
+                      a_distance, a_achieved_volume_fraction, a_times);
+}
+
+void volume_profile_symHexMatchVolumeFraction(
+    const double* a_sym_hex_pts, const double* a_normal,
+    const double a_volume_fraction, double* a_distance,
+    double* a_achieved_volume_fraction, double* a_times) {
+  matchVolumeFraction(a_sym_hex_pts, 14, sym_hex_faces, sym_hex_face_sizes,
+                      a_normal, a_volume_fraction, a_distance,
+                      a_achieved_volume_fraction, a_times);
+}
+
+void volume_profile_stelDodecahedronMatchVolumeFraction(
+    const double* a_stel_dodecahedron_pts, const double* a_normal,
+    const double a_volume_fraction, double* a_distance,
+    double* a_achieved_volume_fraction, double* a_times) {
+  matchVolumeFraction(a_stel_dodecahedron_pts, 32, stel_dodecahedron_faces,
+                      stel_dodecahedron_face_sizes, a_normal, a_volume_fraction,
+                      a_distance, a_achieved_volume_fraction, a_times);
+}
+
+void volume_profile_stelIcosahedronMatchVolumeFraction(
+    const double* a_stel_icosahedron_pts, const double* a_normal,
+    const double a_volume_fraction, double* a_distance,
+    double* a_achieved_volume_fraction, double* a_times) {
+  matchVolumeFraction(a_stel_icosahedron_pts, 32, stel_icosahedron_faces,
+                      stel_icosahedron_face_sizes, a_normal, a_volume_fraction,
+                      a_distance, a_achieved_volume_fraction, a_times);
+}
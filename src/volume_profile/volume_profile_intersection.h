@@ -0,0 +1,131 @@
+// Copyright (C) 2020 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Plane sweeps and volume fraction matching at a fixed normal using a
+// VolumeProfile of each polyhedron, built from the in-repo
+// VertexGraphPolyhedron. Points are ordered as for the other packages,
+// and the normal a_normal must be of unit length (IRL convention, volume
+// kept below the plane).
+
+#ifndef SRC_VOLUME_PROFILE_VOLUME_PROFILE_INTERSECTION_H_
+#define SRC_VOLUME_PROFILE_VOLUME_PROFILE_INTERSECTION_H_
+
+// Sweep functions. The volume below each of the a_number_of_distances
+// planes a_normal.x = a_distances[n] is returned in a_volumes[n]. Building
+// the profile is timed in a_times[0], and all queries together in
+// a_times[1].
+// Sweep a plane through a Triangular Prism
+void volume_profile_prismBySweep(const double *a_prism_pts,
+                                 const double *a_normal,
+                                 const int a_number_of_distances,
+                                 const double *a_distances, double *a_volumes,
+                                 double *a_times);
+
+// Sweep a plane through a Unit Cube
+void volume_profile_unitCubeBySweep(const double *a_cube_pts,
+                                    const double *a_normal,
+                                    const int a_number_of_distances,
+                                    const double *a_distances,
+                                    double *a_volumes, double *a_times);
+
+// Sweep a plane through a Triangulated Triangular Prism
+void volume_profile_triPrismBySweep(const double *a_tri_prism_pts,
+                                    const double *a_normal,
+                                    const int a_number_of_distances,
+                                    const double *a_distances,
+                                    double *a_volumes, double *a_times);
+
+// Sweep a plane through a Triangulated Hexahedron
+void volume_profile_triHexBySweep(const double *a_tri_hex_pts,
+                                  const double *a_normal,
+                                  const int a_number_of_distances,
+                                  const double *a_distances, double *a_volumes,
+                                  double *a_times);
+
+// Sweep a plane through a Symmetric Triangular Prism
+void volume_profile_symPrismBySweep(const double *a_sym_prism_pts,
+                                    const double *a_normal,
+                                    const int a_number_of_distances,
+                                    const double *a_distances,
+                                    double *a_volumes, double *a_times);
+
+// Sweep a plane through a Symmetric Hexahedron
+void volume_profile_symHexBySweep(const double *a_sym_hex_pts,
+                                  const double *a_normal,
+                                  const int a_number_of_distances,
+                                  const double *a_distances, double *a_volumes,
+                                  double *a_times);
+
+// Sweep a plane through a Stellated Dodecahedron
+void volume_profile_stelDodecahedronBySweep(
+    const double *a_stel_dodecahedron_pts, const double *a_normal,
+    const int a_number_of_distances, const double *a_distances,
+    double *a_volumes, double *a_times);
+
+// Sweep a plane through a Stellated Icosahedron
+void volume_profile_stelIcosahedronBySweep(const double *a_stel_icosahedron_pts,
+                                           const double *a_normal,
+                                           const int a_number_of_distances,
+                                           const double *a_distances,
+                                           double *a_volumes, double *a_times);
+
+// Volume fraction matching functions. The distance of the plane with
+// normal a_normal leaving a_volume_fraction of the polyhedron below it is
+// returned in a_distance, with building the profile and inverting it
+// timed in a_times[0]. The polyhedron is then clipped once by that plane,
+// timed in a_times[1], and the volume fraction below it returned in
+// a_achieved_volume_fraction.
+// Match a volume fraction in a Triangular Prism
+void volume_profile_prismMatchVolumeFraction(const double *a_prism_pts,
+                                             const double *a_normal,
+                                             const double a_volume_fraction,
+                                             double *a_distance,
+                                             double *a_achieved_volume_fraction,
+                                             double *a_times);
+
+// Match a volume fraction in a Unit Cube
+void volume_profile_unitCubeMatchVolumeFraction(
+    const double *a_cube_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times);
+
+// Match a volume fraction in a Triangulated Triangular Prism
+void volume_profile_triPrismMatchVolumeFraction(
+    const double *a_tri_prism_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times);
+
+// Match a volume fraction in a Triangulated Hexahedron
+void volume_profile_triHexMatchVolumeFraction(
+    const double *a_tri_hex_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times);
+
+// Match a volume fraction in a Symmetric Triangular Prism
+void volume_profile_symPrismMatchVolumeFraction(
+    const double *a_sym_prism_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times);
+
+// Match a volume fraction in a Symmetric Hexahedron
+void volume_profile_symHexMatchVolumeFraction(
+    const double *a_sym_hex_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times);
+
+// Match a volume fraction in a Stellated Dodecahedron
+void volume_profile_stelDodecahedronMatchVolumeFraction(
+    const double *a_stel_dodecahedron_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times);
+
+// Match a volume fraction in a Stellated Icosahedron
+void volume_profile_stelIcosahedronMatchVolumeFraction(
+    const double *a_stel_icosahedron_pts, const double *a_normal,
+    const double a_volume_fraction, double *a_distance,
+    double *a_achieved_volume_fraction, double *a_times);
+
+#endif  // SRC_VOLUME_PROFILE_VOLUME_PROFILE_INTERSECTION_H_